@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+// LAGr_BellmanFord: Bellman-Ford single-source shortest paths
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm.  G->AT is used for the pull step if G is
+// directed, and G->emin is used for early detection of negative-weight cycles;
+// neither is computed if not present.
+
+// LAGr_BellmanFord computes the shortest path lengths from a source vertex to
+// all other vertices in a graph that may have negative edge weights, and
+// optionally the shortest-path tree (parent) and the number of edges in each
+// path (hops).  It consolidates the LAGraph_BF_* variants, which remain
+// in experimental/algorithm as benchmark baselines (see bf_demo).
+
+// Unlike LAGraph_BF_basic and LAGraph_BF_full, A need not have explicit zeros
+// on its diagonal, and A can be of any real type; the path lengths are
+// computed in GrB_FP64.
+
+// Only the vertices whose distance decreased in the last iteration (the
+// frontier f, as in the SPFA variant of Bellman-Ford) are relaxed in the next
+// one:
+//
+//      t = f min.+ A           (push: vxm, or pull: mxv with AT)
+//      f<t .< d, replace> = t  (the vertices whose distance decreased)
+//      d<struct(f)> = f
+//
+// The push step takes time proportional to the number of edges leaving the
+// frontier.  The pull step computes a dot product for every vertex, and is
+// used once the frontier holds at least n/LG_BF_PULL vertices, if AT is
+// available.
+
+// If the frontier is still not empty after n iterations, there is a
+// negative-weight cycle reachable from the source.  Two cheaper tests find
+// most cycles much sooner: a negative-weight cycle through the source is found
+// as soon as d(source) becomes negative, and since every simple path has at
+// most n-1 edges, each of weight at least emin, any distance below
+// (n-1)*min(emin,0) implies a negative-weight cycle.  If a negative-weight
+// cycle is found, GrB_NO_VALUE is returned, as in LAGraph_BF_*, and all
+// outputs are NULL.
+
+// If the parent or hops are requested, they are found after the path lengths
+// are known, with a breadth-first search from the source of the subgraph of
+// "tight" edges (i,j) with d(i) + A(i,j) == d(j).  Every shortest path
+// consists of tight edges, so the BFS tree is a shortest-path tree, and
+// hops (i) is the fewest edges of any shortest path from the source to i.
+// parent (source) is the source itself, as in LAGr_BreadthFirstSearch.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&f) ;                 \
+    GrB_free (&t) ;                 \
+    GrB_free (&tless) ;             \
+    GrB_free (&dreach) ;            \
+    GrB_free (&D) ;                 \
+    GrB_free (&C) ;                 \
+    GrB_free (&B) ;                 \
+    GrB_free (&E) ;                 \
+    LAGraph_Delete (&Tight, NULL) ; \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&d) ;                 \
+    GrB_free (parent) ;             \
+    GrB_free (hops) ;               \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// pull once the frontier holds at least n/LG_BF_PULL vertices
+#define LG_BF_PULL 16
+
+int LAGr_BellmanFord
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    GrB_Vector *parent,         // optional: parent (i) of vertex i in the
+                                // shortest-path tree (NULL if not needed)
+    GrB_Vector *hops,           // optional: hops (i) is the # of edges in the
+                                // shortest path to vertex i (NULL if not needed)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector d = NULL, f = NULL, t = NULL, tless = NULL, dreach = NULL ;
+    GrB_Matrix D = NULL, C = NULL, B = NULL, E = NULL ;
+    LAGraph_Graph Tight = NULL ;
+
+    if (parent != NULL) (*parent) = NULL ;
+    if (hops   != NULL) (*hops  ) = NULL ;
+    LG_ASSERT (path_length != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (source < n, GrB_INVALID_INDEX, "invalid source node") ;
+
+    // AT is used for the pull step, if available.  If G is directed, G->AT
+    // is required even if G has a symmetric structure, since the values of A
+    // and A' can differ.
+    GrB_Matrix AT = (G->kind == LAGraph_ADJACENCY_UNDIRECTED) ? A : G->AT ;
+
+    // lower bound on any distance, if there is no negative-weight cycle
+    double dmin = -INFINITY ;
+    if (G->emin != NULL &&
+        (G->emin_state == LAGraph_VALUE || G->emin_state == LAGraph_BOUND))
+    {
+        double emin = 0 ;
+        GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+        dmin = ((double) (n-1)) * LAGRAPH_MIN (emin, 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // d (:) = inf, d (source) = 0
+    GRB_TRY (GrB_Vector_new (&d, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (d, NULL, NULL, (double) INFINITY, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_Vector_setElement (d, (double) 0, source)) ;
+
+    // f (source) = 0
+    GRB_TRY (GrB_Vector_new (&f, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_setElement (f, (double) 0, source)) ;
+
+    GRB_TRY (GrB_Vector_new (&t, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&tless, GrB_BOOL, n)) ;
+
+#if LAGRAPH_SUITESPARSE
+    // optional hints for SuiteSparse:GraphBLAS
+    GRB_TRY (GxB_set (d, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+#endif
+
+    //--------------------------------------------------------------------------
+    // relax the edges leaving the frontier, until the frontier is empty
+    //--------------------------------------------------------------------------
+
+    bool negative_cycle = false ;
+    GrB_Index fnvals = 1 ;
+    for (GrB_Index iter = 0 ; fnvals > 0 ; iter++)
+    {
+
+        if (iter == n)
+        {
+            // the frontier is not empty after n iterations
+            negative_cycle = true ;
+            break ;
+        }
+
+        // t = f min.+ A, using push or pull
+        if (AT != NULL && fnvals >= n / LG_BF_PULL)
+        {
+            GRB_TRY (GrB_mxv (t, NULL, NULL, GrB_MIN_PLUS_SEMIRING_FP64,
+                AT, f, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GrB_vxm (t, NULL, NULL, GrB_MIN_PLUS_SEMIRING_FP64,
+                f, A, NULL)) ;
+        }
+
+        // tless = (t .< d)
+        GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, GrB_LT_FP64, t, d, NULL)) ;
+
+        // f<tless,replace> = t: the new frontier
+        GRB_TRY (GrB_assign (f, tless, NULL, t, GrB_ALL, n, GrB_DESC_R)) ;
+        GRB_TRY (GrB_Vector_nvals (&fnvals, f)) ;
+        if (fnvals == 0) break ;
+
+        // d<struct(f)> = f
+        GRB_TRY (GrB_assign (d, f, NULL, f, GrB_ALL, n, GrB_DESC_S)) ;
+
+        // early check for a negative-weight cycle
+        double fmin = 0 ;
+        GRB_TRY (GrB_reduce (&fmin, NULL, GrB_MIN_MONOID_FP64, f, NULL)) ;
+        double dsource = 0 ;
+        GRB_TRY (GrB_Vector_extractElement (&dsource, d, source)) ;
+        if (fmin < dmin || dsource < 0)
+        {
+            negative_cycle = true ;
+            break ;
+        }
+    }
+
+    if (negative_cycle)
+    {
+        LG_FREE_ALL ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the parent and hops, if requested
+    //--------------------------------------------------------------------------
+
+    if (parent != NULL || hops != NULL)
+    {
+        // dreach = the finite entries of d
+        GRB_TRY (GrB_Vector_new (&dreach, GrB_FP64, n)) ;
+        GRB_TRY (GrB_select (dreach, NULL, NULL, GrB_VALUELT_FP64, d,
+            (double) INFINITY, NULL)) ;
+        GRB_TRY (GrB_Matrix_diag (&D, dreach, 0)) ;
+
+        // C(i,j) = d(i) + A(i,j), for each reachable i
+        GRB_TRY (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+        GRB_TRY (GrB_mxm (C, NULL, NULL, GrB_MIN_PLUS_SEMIRING_FP64, D, A,
+            NULL)) ;
+
+        // B(i,j) = d(j), for each edge (i,j) with reachable j
+        GRB_TRY (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+        GRB_TRY (GrB_mxm (B, NULL, NULL, GrB_MIN_SECOND_SEMIRING_FP64, A, D,
+            NULL)) ;
+
+        // E = the tight edges: (C == B)
+        GRB_TRY (GrB_Matrix_new (&E, GrB_BOOL, n, n)) ;
+        GRB_TRY (GrB_eWiseMult (E, NULL, NULL, GrB_EQ_FP64, C, B, NULL)) ;
+        GRB_TRY (GrB_select (E, NULL, NULL, GrB_VALUEEQ_BOOL, E, true, NULL)) ;
+        GrB_free (&C) ;
+        GrB_free (&B) ;
+        GrB_free (&D) ;
+
+        // BFS of the tight subgraph from the source
+        LG_TRY (LAGraph_New (&Tight, &E, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        LG_TRY (LAGr_BreadthFirstSearch (hops, parent, Tight, source, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*path_length) = d ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+// LAGr_BetweennessApprox: betweenness centrality with an error guarantee
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is required).
+
+// LAGr_BetweennessApprox estimates the betweenness centrality of all nodes,
+// the value that LAGr_Betweenness computes when all n nodes are used as
+// sources, with an error guarantee: with probability at least 1-delta,
+
+//      abs (centrality (v) - bc (v)) <= epsilon * n * (n-1)
+
+// for all nodes v at once, where n*(n-1) is the number of (s,t) pairs.  This
+// is enough to find the nodes with the top-k betweenness, if the gaps between
+// their scores are larger than 2*epsilon*n*(n-1).
+
+// Sources are sampled uniformly at random (with replacement), in batches of
+// batch_size, and each batch is handled by a single call to LAGr_Betweenness,
+// which does all of its breadth-first searches at once.  For a source s, the
+// dependency delta_s(v) of v on s (the sum of LAGr_Betweenness over the batch)
+// is in the range 0 to n-2, and bc(v) = n * E [delta_s(v)].  So each batch
+// gives an independent sample m(v) in the range [0,1]: the mean of
+// delta_s(v) / (n-2) over the batch.
+
+// Sampling is adaptive.  After k = 2, 4, 8, ... batches, the empirical
+// Bernstein bound of Maurer and Pontil ("Empirical Bernstein bounds and
+// sample variance penalization", COLT 2009) is found for the mean of the k
+// samples of each node,
+
+//      sqrt (2 * V * L / k) + 7 * L / (3 * (k-1)),  L = log (2 / delta'),
+
+// where V is the largest sample variance over all nodes, and delta' = delta /
+// (2 * n * T), for T possible checkpoints.  Sampling stops once the bound
+// is at most epsilon.  Graphs where few shortest paths go through most nodes
+// have a small variance and stop early.  Otherwise sampling stops after
+// log (4*n/delta) / (2*epsilon^2) sources, which meets the bound by the
+// Hoeffding inequality (with the other delta/2).
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&bc) ;                                \
+    GrB_free (&sum) ;                               \
+    GrB_free (&sumsq) ;                             \
+    GrB_free (&t) ;                                 \
+    LAGraph_Free ((void **) &sources, NULL) ;       \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (centrality) ;                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_BetweennessApprox
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): estimated betweenness of i
+    GrB_Index *nsamples,        // number of sources sampled
+    // input:
+    const LAGraph_Graph G,      // input graph
+    double epsilon,             // error bound, relative to n*(n-1)
+    double delta,               // probability that the bound fails
+    int32_t batch_size,         // sources per batch (typically 32)
+    uint64_t seed,              // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector bc = NULL, sum = NULL, sumsq = NULL, t = NULL ;
+    GrB_Index *sources = NULL ;
+    LG_ASSERT (centrality != NULL && nsamples != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    (*nsamples) = 0 ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (epsilon > 0 && epsilon < 1, GrB_INVALID_VALUE,
+        "epsilon must be in the range (0,1)") ;
+    LG_ASSERT_MSG (delta > 0 && delta < 1, GrB_INVALID_VALUE,
+        "delta must be in the range (0,1)") ;
+    LG_ASSERT_MSG (batch_size > 0, GrB_INVALID_VALUE,
+        "batch_size must be > 0") ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP64, n)) ;
+    if (n <= 2)
+    {
+        // no node can be between two others
+        GRB_TRY (GrB_assign (*centrality, NULL, NULL, (double) 0, GrB_ALL, n,
+            NULL)) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sample sizes
+    //--------------------------------------------------------------------------
+
+    // Hoeffding: enough sources for the bound, with probability 1-delta/2
+    double smax = ceil (log (4 * (double) n / delta) /
+        (2 * epsilon * epsilon)) ;
+    int64_t kmax = (int64_t) ceil (smax / batch_size) ;
+    kmax = LAGRAPH_MAX (kmax, 2) ;
+
+    // T checkpoints, at k = 2, 4, 8, ... batches, share the other delta/2
+    int T = (int) ceil (log2 ((double) kmax)) ;
+    const double L = log (4 * (double) n * T / delta) ;
+
+    //--------------------------------------------------------------------------
+    // sample batches of sources until the bound is met
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&sum, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&sumsq, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&t, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (sum, NULL, NULL, (double) 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_assign (sumsq, NULL, NULL, (double) 0, GrB_ALL, n, NULL)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &sources, batch_size,
+        sizeof (GrB_Index), msg)) ;
+    const double scale = 1.0 / ((double) batch_size * (double) (n-2)) ;
+
+    int64_t k = 0 ;
+    int64_t checkpoint = 2 ;
+    while (k < kmax)
+    {
+
+        //----------------------------------------------------------------------
+        // m = the mean of delta_s / (n-2) over a batch of random sources
+        //----------------------------------------------------------------------
+
+        for (int32_t i = 0 ; i < batch_size ; i++)
+        {
+            sources [i] = LG_Random60 (&seed) % n ;
+        }
+        LG_TRY (LAGr_Betweenness (&bc, G, sources, batch_size, msg)) ;
+        GRB_TRY (GrB_apply (bc, NULL, NULL, GrB_TIMES_FP64, bc, scale, NULL)) ;
+
+        // sum += m, sumsq += m.^2
+        GRB_TRY (GrB_assign (sum, NULL, GrB_PLUS_FP64, bc, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_eWiseMult (t, NULL, NULL, GrB_TIMES_FP64, bc, bc, NULL)) ;
+        GRB_TRY (GrB_assign (sumsq, NULL, GrB_PLUS_FP64, t, GrB_ALL, n,
+            NULL)) ;
+        GrB_free (&bc) ;
+        k++ ;
+
+        //----------------------------------------------------------------------
+        // check the empirical Bernstein bound at each checkpoint
+        //----------------------------------------------------------------------
+
+        if (k == checkpoint && k < kmax)
+        {
+            checkpoint *= 2 ;
+            // t = (sumsq - sum.^2 / k) / (k-1), the sample variance
+            GRB_TRY (GrB_eWiseMult (t, NULL, NULL, GrB_TIMES_FP64, sum, sum,
+                NULL)) ;
+            GRB_TRY (GrB_apply (t, NULL, NULL, GrB_DIV_FP64, t, (double) k,
+                NULL)) ;
+            GRB_TRY (GrB_eWiseAdd (t, NULL, NULL, GrB_MINUS_FP64, sumsq, t,
+                NULL)) ;
+            double vmax = 0 ;
+            GRB_TRY (GrB_reduce (&vmax, NULL, GrB_MAX_MONOID_FP64, t, NULL)) ;
+            vmax = LAGRAPH_MAX (vmax, 0) / (k-1) ;
+            double bound = sqrt (2 * vmax * L / k) + 7 * L / (3.0 * (k-1)) ;
+            if (bound <= epsilon) break ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // centrality = n * (n-2) * sum / k
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_apply (*centrality, NULL, NULL, GrB_TIMES_FP64, sum,
+        ((double) n) * ((double) (n-2)) / k, NULL)) ;
+    (*nsamples) = k * batch_size ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
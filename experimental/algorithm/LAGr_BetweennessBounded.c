@@ -0,0 +1,405 @@
+//------------------------------------------------------------------------------
+// LAGr_BetweennessBounded: betweenness centrality in bounded memory
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is required).
+
+// LAGr_BetweennessBounded computes the same result as LAGr_Betweenness, with
+// the same push-pull breadth-first searches and backward sweep, but it does
+// not keep one matrix S [i] for each BFS level through the whole
+// computation.  On graphs with a high diameter (road networks, with thousands
+// of levels), those matrices can use far more memory than the rest of the
+// method.
+
+// Instead, the forward phase records the level of each node in each search in
+// a single ns-by-n GrB_INT32 matrix D, where D (s,v) = i if v is in S [i] for
+// the search from sources [s].  The backward sweep needs the levels in
+// decreasing order.  It rebuilds them from D in blocks of consecutive levels:
+// the entries of the block are removed from D with GrB_select, bucket-sorted by
+// level, and each S [i] in the block is built with GrB_Matrix_build.  Once a
+// level has been used, it is freed.
+
+// The size of each block is chosen so that the workspace for its levels is no
+// more than max_bytes, using the level sizes found in the forward phase.  A
+// block has at least one level.  Each block costs one pass over the part of D
+// that remains, so a smaller limit gives more blocks and more work:
+
+//  max_bytes = 0:          one level at a time, least memory, most work.
+//  max_bytes = SIZE_MAX:   one block of all levels, built in a single pass
+//                          over D; the same memory as LAGr_Betweenness.
+
+// The ns-by-n paths and bc_update matrices are also needed, as in
+// LAGr_Betweenness, and are not counted in max_bytes.
+
+#define LG_FREE_WORK                            \
+{                                               \
+    GrB_free (&frontier) ;                      \
+    GrB_free (&paths) ;                         \
+    GrB_free (&bc_update) ;                     \
+    GrB_free (&W) ;                             \
+    GrB_free (&D) ;                             \
+    GrB_free (&Dblock) ;                        \
+    if (S != NULL)                              \
+    {                                           \
+        for (int64_t i = 0 ; i <= n ; i++)      \
+        {                                       \
+            GrB_free (&(S [i])) ;               \
+        }                                       \
+        LAGraph_Free ((void **) &S, NULL) ;     \
+    }                                           \
+    LAGraph_Free ((void **) &level_size, NULL) ;\
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &J, NULL) ;         \
+    LAGraph_Free ((void **) &X, NULL) ;         \
+    LAGraph_Free ((void **) &I2, NULL) ;        \
+    LAGraph_Free ((void **) &J2, NULL) ;        \
+    LAGraph_Free ((void **) &ones, NULL) ;      \
+    LAGraph_Free ((void **) &count, NULL) ;     \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (centrality) ;         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// bytes of workspace for each entry of a block of levels: the tuples of the
+// block (I, J, and X), their sorted copy (I2 and J2), and the S [i] matrices
+#define LG_BYTES_PER_ENTRY \
+    (5 * sizeof (GrB_Index) + sizeof (int32_t) + sizeof (bool))
+
+int LAGr_BetweennessBounded
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source vertices to compute shortest paths
+    int32_t ns,                 // number of source vertices
+    size_t max_bytes,           // workspace limit for the BFS levels
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix *S = NULL, frontier = NULL, paths = NULL, bc_update = NULL,
+        W = NULL, D = NULL, Dblock = NULL ;
+    GrB_Index *I = NULL, *J = NULL, *I2 = NULL, *J2 = NULL ;
+    int32_t *X = NULL ;
+    bool *ones = NULL ;
+    int64_t *level_size = NULL, *count = NULL ;
+    GrB_Index n = 0 ;
+
+    LG_ASSERT (centrality != NULL && sources != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+
+    // =========================================================================
+    // === initializations =====================================================
+    // =========================================================================
+
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (n < INT32_MAX, GrB_NOT_IMPLEMENTED,
+        "graph too large for an int32 level matrix") ;
+    GRB_TRY (GrB_Matrix_new (&paths,    GrB_FP64, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&frontier, GrB_FP64, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&D,        GrB_INT32, ns, n)) ;
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_set (paths, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
+    #endif
+    for (GrB_Index i = 0 ; i < ns ; i++)
+    {
+        // paths (i,s(i)) = 1
+        // frontier (i,s(i)) = 1
+        double one = 1 ;
+        GrB_Index src = sources [i] ;
+        LG_ASSERT_MSG (src < n, GrB_INVALID_INDEX, "invalid source node") ;
+        GRB_TRY (GrB_Matrix_setElement (paths,    one, i, src)) ;
+        GRB_TRY (GrB_Matrix_setElement (frontier, one, i, src)) ;
+    }
+
+    // Initial frontier: frontier<!paths>= frontier*A
+    GRB_TRY (GrB_mxm (frontier, paths, NULL, LAGraph_plus_first_fp64,
+        frontier, A, GrB_DESC_RSC)) ;
+
+    // the number of entries in each level; S [i] are created in blocks later
+    LG_TRY (LAGraph_Calloc ((void **) &level_size, n+1, sizeof (int64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &S, n+1, sizeof (GrB_Matrix), msg)) ;
+
+    // =========================================================================
+    // === Breadth-first search stage ==========================================
+    // =========================================================================
+
+    bool last_was_pull = false ;
+    GrB_Index frontier_size ;
+    GRB_TRY (GrB_Matrix_nvals (&frontier_size, frontier)) ;
+
+    int64_t depth ;
+    for (depth = 0 ; frontier_size > 0 && depth < n ; depth++)
+    {
+
+        //----------------------------------------------------------------------
+        // D<struct(frontier)> = depth, instead of S [depth]
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_assign (D, frontier, NULL, (int32_t) depth, GrB_ALL, ns,
+            GrB_ALL, n, GrB_DESC_S)) ;
+        level_size [depth] = frontier_size ;
+
+        //----------------------------------------------------------------------
+        // Accumulate path counts: paths += frontier
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_assign (paths, NULL, GrB_PLUS_FP64, frontier, GrB_ALL, ns,
+            GrB_ALL, n, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // Update frontier: frontier<!paths> = frontier*A
+        //----------------------------------------------------------------------
+
+        // pull if frontier is more than 10% dense,
+        // or > 6% dense and last step was pull
+        double frontier_density = ((double) frontier_size) / (double) (ns*n) ;
+        bool do_pull = frontier_density > (last_was_pull ? 0.06 : 0.10 ) ;
+
+        if (do_pull)
+        {
+            // frontier<!paths> = frontier*AT'
+            #if LAGRAPH_SUITESPARSE
+            GRB_TRY (GxB_set (frontier, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+            #endif
+            GRB_TRY (GrB_mxm (frontier, paths, NULL, LAGraph_plus_first_fp64,
+                frontier, AT, GrB_DESC_RSCT1)) ;
+        }
+        else // push
+        {
+            // frontier<!paths> = frontier*A
+            #if LAGRAPH_SUITESPARSE
+            GRB_TRY (GxB_set (frontier, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+            #endif
+            GRB_TRY (GrB_mxm (frontier, paths, NULL, LAGraph_plus_first_fp64,
+                frontier, A, GrB_DESC_RSC)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // Get size of current frontier: frontier_size = nvals(frontier)
+        //----------------------------------------------------------------------
+
+        last_was_pull = do_pull ;
+        GRB_TRY (GrB_Matrix_nvals (&frontier_size, frontier)) ;
+    }
+
+    GRB_TRY (GrB_free (&frontier)) ;
+
+    // =========================================================================
+    // === Betweenness centrality computation phase ============================
+    // =========================================================================
+
+    // bc_update = ones (ns, n) ; a full matrix (and stays full)
+    GRB_TRY (GrB_Matrix_new (&bc_update, GrB_FP64, ns, n)) ;
+    GRB_TRY (GrB_assign (bc_update, NULL, NULL, 1, GrB_ALL, ns, GrB_ALL, n,
+        NULL)) ;
+    // W: empty ns-by-n array, as workspace
+    GRB_TRY (GrB_Matrix_new (&W, GrB_FP64, ns, n)) ;
+
+    // the largest number of level entries in a block
+    const double block_limit = ((double) max_bytes) / LG_BYTES_PER_ENTRY ;
+
+    // Backtrack through the BFS and compute centrality updates for each vertex
+    for (int64_t i = depth-1 ; i > 0 ; i--)
+    {
+
+        //----------------------------------------------------------------------
+        // build the next block of levels from D, if S [i] is not present
+        //----------------------------------------------------------------------
+
+        // The backward sweep needs S [i] and S [i-1].  S [i] is normally in
+        // the current block, so a new block is needed when S [i-1] is not yet
+        // built.  Both are missing at the first step (i = depth-1).  D holds
+        // the levels 0:top that have not yet been built.
+
+        while (S [i] == NULL || S [i-1] == NULL)
+        {
+            int64_t top = (S [i] == NULL) ? i : (i-1) ;
+
+            // find the levels lo:top of the block
+            int64_t lo = top ;
+            double block_entries = level_size [top] ;
+            while (lo > 0 &&
+                block_entries + level_size [lo-1] <= block_limit)
+            {
+                lo-- ;
+                block_entries += level_size [lo] ;
+            }
+
+            // Dblock = entries of D with level >= lo, and remove them from D
+            GRB_TRY (GrB_Matrix_new (&Dblock, GrB_INT32, ns, n)) ;
+            GRB_TRY (GrB_select (Dblock, NULL, NULL, GrB_VALUEGE_INT32, D,
+                (int32_t) lo, NULL)) ;
+            GRB_TRY (GrB_select (D, NULL, NULL, GrB_VALUELT_INT32, D,
+                (int32_t) lo, NULL)) ;
+
+            // extract the tuples of the block
+            GrB_Index nblock ;
+            GRB_TRY (GrB_Matrix_nvals (&nblock, Dblock)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &I, nblock, sizeof (GrB_Index),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &J, nblock, sizeof (GrB_Index),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &X, nblock, sizeof (int32_t),
+                msg)) ;
+            GRB_TRY (GrB_Matrix_extractTuples (I, J, X, &nblock, Dblock)) ;
+            GrB_free (&Dblock) ;
+
+            // bucket sort the tuples by level
+            int64_t nlevels = top - lo + 1, maxcount = 0 ;
+            LG_TRY (LAGraph_Calloc ((void **) &count, nlevels + 1,
+                sizeof (int64_t), msg)) ;
+            for (GrB_Index k = 0 ; k < nblock ; k++)
+            {
+                count [X [k] - lo + 1]++ ;
+            }
+            for (int64_t l = 0 ; l < nlevels ; l++)
+            {
+                maxcount = LAGRAPH_MAX (maxcount, count [l+1]) ;
+                count [l+1] += count [l] ;
+            }
+            LG_TRY (LAGraph_Malloc ((void **) &I2, nblock, sizeof (GrB_Index),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &J2, nblock, sizeof (GrB_Index),
+                msg)) ;
+            for (GrB_Index k = 0 ; k < nblock ; k++)
+            {
+                int64_t p = count [X [k] - lo]++ ;
+                I2 [p] = I [k] ;
+                J2 [p] = J [k] ;
+            }
+            LAGraph_Free ((void **) &I, NULL) ;
+            LAGraph_Free ((void **) &J, NULL) ;
+            LAGraph_Free ((void **) &X, NULL) ;
+
+            // S [l] = the structure of level l, for each level in the block
+            LG_TRY (LAGraph_Malloc ((void **) &ones, LAGRAPH_MAX (maxcount, 1),
+                sizeof (bool), msg)) ;
+            for (int64_t k = 0 ; k < maxcount ; k++)
+            {
+                ones [k] = true ;
+            }
+            int64_t p = 0 ;
+            for (int64_t l = lo ; l <= top ; l++)
+            {
+                // count [l-lo] is now the end of level l
+                int64_t pend = count [l - lo] ;
+                GRB_TRY (GrB_Matrix_new (&(S [l]), GrB_BOOL, ns, n)) ;
+                GRB_TRY (GrB_Matrix_build (S [l], I2 + p, J2 + p, ones,
+                    pend - p, GrB_LOR)) ;
+                p = pend ;
+            }
+            LAGraph_Free ((void **) &I2, NULL) ;
+            LAGraph_Free ((void **) &J2, NULL) ;
+            LAGraph_Free ((void **) &ones, NULL) ;
+            LAGraph_Free ((void **) &count, NULL) ;
+        }
+
+        //----------------------------------------------------------------------
+        // W<S[i]> = bc_update ./ paths
+        //----------------------------------------------------------------------
+
+        // Add contributions by successors and mask with that level's frontier
+        GRB_TRY (GrB_eWiseMult (W, S [i], NULL, GrB_DIV_FP64, bc_update, paths,
+            GrB_DESC_RS)) ;
+
+        //----------------------------------------------------------------------
+        // W<S[i−1]> = W * A'
+        //----------------------------------------------------------------------
+
+        // pull if W is more than 10% dense and nnz(W)/nnz(S[i-1]) > 1
+        // or if W is more than 1% dense and nnz(W)/nnz(S[i-1]) > 10
+        GrB_Index wsize, ssize ;
+        GRB_TRY (GrB_Matrix_nvals (&wsize, W)) ;
+        GRB_TRY (GrB_Matrix_nvals (&ssize, S [i-1])) ;
+        double w_density    = ((double) wsize) / ((double) (ns*n)) ;
+        double w_to_s_ratio = ((double) wsize) / ((double) ssize) ;
+        bool do_pull = (w_density > 0.1  && w_to_s_ratio > 1.) ||
+                       (w_density > 0.01 && w_to_s_ratio > 10.) ;
+
+        if (do_pull)
+        {
+            // W<S[i−1]> = W * A'
+            #if LAGRAPH_SUITESPARSE
+            GRB_TRY (GxB_set (W, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+            #endif
+            GRB_TRY (GrB_mxm (W, S [i-1], NULL, LAGraph_plus_first_fp64, W, A,
+                GrB_DESC_RST1)) ;
+        }
+        else // push
+        {
+            // W<S[i−1]> = W * AT
+            #if LAGRAPH_SUITESPARSE
+            GRB_TRY (GxB_set (W, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+            #endif
+            GRB_TRY (GrB_mxm (W, S [i-1], NULL, LAGraph_plus_first_fp64, W, AT,
+                GrB_DESC_RS)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // bc_update += W .* paths
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_eWiseMult (bc_update, NULL, GrB_PLUS_FP64, GrB_TIMES_FP64,
+            W, paths, NULL)) ;
+
+        // S [i] is no longer needed
+        GrB_free (&(S [i])) ;
+    }
+
+    // =========================================================================
+    // === finalize the centrality =============================================
+    // =========================================================================
+
+    // Initialize the centrality array with -ns to avoid counting
+    // zero length paths
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (*centrality, NULL, NULL, -ns, GrB_ALL, n, NULL)) ;
+
+    // centrality (i) += sum (bc_update (:,i)) for all nodes i
+    GRB_TRY (GrB_reduce (*centrality, NULL, GrB_PLUS_FP64, GrB_PLUS_MONOID_FP64,
+        bc_update, GrB_DESC_T0)) ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
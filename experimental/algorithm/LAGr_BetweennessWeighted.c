@@ -0,0 +1,323 @@
+//------------------------------------------------------------------------------
+// LAGr_BetweennessWeighted: betweenness centrality of a weighted graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (the light/heavy split of G->A is required,
+// from LAGraph_DeltaSplit_New).
+
+// LAGr_BetweennessWeighted computes the same metric as LAGr_Betweenness,
+// summed over the given sources, but with shortest paths measured by the edge
+// weights of G->A rather than by the number of edges.  Edge weights must be
+// positive.
+
+// The shortest path lengths from all ns sources are found at once, with the
+// batched delta-stepping of LAGr_MultiSourceShortestPath.  For the source s,
+// the shortest-path DAG holds each edge (u,v) with dist(s,u) + A(u,v) =
+// dist(s,v).  The DAG is not stored: an edge is tested when it is used.  The
+// dependencies are then accumulated as in Brandes' method ("A faster
+// algorithm for betweenness centrality", J. Math. Sociology, 2001).  The nodes
+// reached from s are sorted by their distance, and
+
+//      sigma (v) = sum of sigma (u) for each DAG edge (u,v)
+
+// in increasing order of distance, with sigma (s) = 1, counts the shortest
+// paths from s, and then
+
+//      delta (u) = sum of sigma (u) / sigma (v) * (1 + delta (v))
+
+// over the DAG edges (u,v), in decreasing order of distance, is the
+// dependency of s on u.  Sources are handled in parallel, each by a single
+// thread.  The lengths are compared in double precision; for floating-point
+// weights, a slack of a few ulps of dist(s,v) is allowed, since two paths of
+// the same length may be summed in a different order (see LG_dag_edge).
+
+// The workspace is O(|E| + ns * n + nthreads * n).
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&T) ;                                 \
+    GrB_free (&TF) ;                                \
+    GrB_free (&AF) ;                                \
+    LAGraph_Free ((void **) &Ap, NULL) ;            \
+    LAGraph_Free ((void **) &Aj, NULL) ;            \
+    LAGraph_Free ((void **) &Ax, NULL) ;            \
+    LAGraph_Free ((void **) &Tp, NULL) ;            \
+    LAGraph_Free ((void **) &Tj, NULL) ;            \
+    LAGraph_Free ((void **) &Tx, NULL) ;            \
+    LAGraph_Free ((void **) &Dist, NULL) ;          \
+    LAGraph_Free ((void **) &Sigma, NULL) ;         \
+    LAGraph_Free ((void **) &Delta, NULL) ;         \
+    LAGraph_Free ((void **) &Key, NULL) ;           \
+    LAGraph_Free ((void **) &Node, NULL) ;          \
+    LAGraph_Free ((void **) &bc, NULL) ;            \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (centrality) ;                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+#include <float.h>
+
+//------------------------------------------------------------------------------
+// LG_dag_edge: true if (u,v) is an edge of the shortest-path DAG
+//------------------------------------------------------------------------------
+
+// The edge (u,v) with weight w > 0 is in the DAG if du + w = dv, where du and
+// dv are the distances of u and v from the source.  The distances of
+// floating-point weights are rounded, so du + w may exceed dv by a few ulps
+// (eps is the machine epsilon of the type of G->A, or zero for integers).
+// The slack is capped at w/2, and dv > du is required, so that an edge
+// between two nodes at the same distance is never taken as a DAG edge, even
+// if w is small compared with dv.  An edge whose weight is below the rounding
+// error of dv itself cannot be resolved, and is not in the DAG.
+
+static inline bool LG_dag_edge (double du, double dv, double w, double eps)
+{
+    if (!(dv > du)) return (false) ;
+    double slack = LAGRAPH_MIN (4 * eps * dv, w / 2) ;
+    return (du + w <= dv + slack) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_BetweennessWeighted
+//------------------------------------------------------------------------------
+
+int LAGr_BetweennessWeighted
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source vertices to compute shortest paths
+    int32_t ns,                 // number of source vertices
+    const LAGraph_DeltaSplit Split, // light/heavy split of G->A
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix T = NULL, TF = NULL, AF = NULL ;
+    GrB_Index *Ap = NULL, *Aj = NULL, *Tp = NULL, *Tj = NULL, *I = NULL ;
+    double *Ax = NULL, *Tx = NULL, *Dist = NULL, *Sigma = NULL, *Delta = NULL,
+        *bc = NULL ;
+    int64_t *Key = NULL, *Node = NULL ;
+
+    LG_ASSERT (centrality != NULL && sources != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (ns > 0, GrB_INVALID_VALUE, "ns must be > 0") ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    // get the type of G->A, and the value used for infinity in T
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G->A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+    double infinity = INFINITY, eps = 0 ;
+    if      (etype == GrB_INT32 ) infinity = (double) INT32_MAX ;
+    else if (etype == GrB_INT64 ) infinity = (double) INT64_MAX ;
+    else if (etype == GrB_UINT32) infinity = (double) UINT32_MAX ;
+    else if (etype == GrB_UINT64) infinity = (double) UINT64_MAX ;
+    else if (etype == GrB_FP32  ) eps = FLT_EPSILON ;
+    else if (etype == GrB_FP64  ) eps = DBL_EPSILON ;
+    else
+    {
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+
+    // edge weights must be positive
+    double emin = 0 ;
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    if (nvals > 0)
+    {
+        GRB_TRY (GrB_reduce (&emin, NULL, GrB_MIN_MONOID_FP64, G->A, NULL)) ;
+        LG_ASSERT_MSG (emin > 0, GrB_INVALID_VALUE,
+            "edge weights must be positive") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T = the shortest path lengths from all sources, with delta-stepping
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGr_MultiSourceShortestPath (&T, G, sources, ns, Split, msg)) ;
+
+    // T = T (T < infinity), typecasted to double, and exported in CSR form
+    GRB_TRY (GrB_Matrix_new (&TF, GrB_FP64, ns, n)) ;
+    GRB_TRY (GrB_select (TF, NULL, NULL, GrB_VALUELT_FP64, T, infinity,
+        NULL)) ;
+    GrB_free (&T) ;
+    GrB_Index Tp_len, Tj_len, Tx_len ;
+    GRB_TRY (GrB_Matrix_exportSize (&Tp_len, &Tj_len, &Tx_len,
+        GrB_CSR_FORMAT, TF)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Tp, Tp_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Tj, Tj_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Tx, Tx_len, sizeof (double), msg)) ;
+    GRB_TRY (GrB_Matrix_export (Tp, Tj, Tx, &Tp_len, &Tj_len, &Tx_len,
+        GrB_CSR_FORMAT, TF)) ;
+    GrB_free (&TF) ;
+
+    // AF = (double) G->A, exported in CSR form
+    GRB_TRY (GrB_Matrix_new (&AF, GrB_FP64, n, n)) ;
+    GRB_TRY (GrB_apply (AF, NULL, NULL, GrB_IDENTITY_FP64, G->A, NULL)) ;
+    GrB_Index Ap_len, Aj_len, Ax_len ;
+    GRB_TRY (GrB_Matrix_exportSize (&Ap_len, &Aj_len, &Ax_len,
+        GrB_CSR_FORMAT, AF)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ap, Ap_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Aj, Aj_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ax, Ax_len, sizeof (double), msg)) ;
+    GRB_TRY (GrB_Matrix_export (Ap, Aj, Ax, &Ap_len, &Aj_len, &Ax_len,
+        GrB_CSR_FORMAT, AF)) ;
+    GrB_free (&AF) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for each thread
+    //--------------------------------------------------------------------------
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, ns) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    size_t nwork = ((size_t) nthreads) * n ;
+    LG_TRY (LAGraph_Malloc ((void **) &Dist,  nwork, sizeof (double), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Sigma, nwork, sizeof (double), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Delta, nwork, sizeof (double), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Key,   nwork, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Node,  nwork, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &bc, n, sizeof (double), msg)) ;
+    for (size_t k = 0 ; k < nwork ; k++)
+    {
+        Dist [k] = INFINITY ;
+    }
+
+    //--------------------------------------------------------------------------
+    // accumulate the dependencies of each source
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        double  *LG_RESTRICT dist  = Dist  + ((size_t) tid) * n ;
+        double  *LG_RESTRICT sigma = Sigma + ((size_t) tid) * n ;
+        double  *LG_RESTRICT delta = Delta + ((size_t) tid) * n ;
+        int64_t *LG_RESTRICT key   = Key   + ((size_t) tid) * n ;
+        int64_t *LG_RESTRICT node  = Node  + ((size_t) tid) * n ;
+
+        for (int64_t k = tid ; k < ns ; k += nthreads)
+        {
+
+            //------------------------------------------------------------------
+            // sort the nodes reached from sources [k] by their distance
+            //------------------------------------------------------------------
+
+            // The distances are not negative, so their bit patterns, as
+            // int64_t, sort in the same order as their values.
+            int64_t nreach = 0 ;
+            for (GrB_Index p = Tp [k] ; p < Tp [k+1] ; p++)
+            {
+                int64_t v = Tj [p] ;
+                dist [v] = Tx [p] ;
+                sigma [v] = 0 ;
+                delta [v] = 0 ;
+                memcpy (&(key [nreach]), &(Tx [p]), sizeof (double)) ;
+                node [nreach] = v ;
+                nreach++ ;
+            }
+            LG_qsort_2 (key, node, nreach) ;
+            sigma [sources [k]] = 1 ;
+
+            //------------------------------------------------------------------
+            // count the shortest paths, in increasing order of distance
+            //------------------------------------------------------------------
+
+            for (int64_t t = 0 ; t < nreach ; t++)
+            {
+                int64_t u = node [t] ;
+                double du = dist [u] ;
+                for (GrB_Index p = Ap [u] ; p < Ap [u+1] ; p++)
+                {
+                    int64_t v = Aj [p] ;
+                    if (v == u) continue ;  // a self-edge is never in the DAG
+                    if (LG_dag_edge (du, dist [v], Ax [p], eps))
+                    {
+                        // (u,v) is an edge of the shortest-path DAG
+                        sigma [v] += sigma [u] ;
+                    }
+                }
+            }
+
+            //------------------------------------------------------------------
+            // accumulate the dependencies, in decreasing order of distance
+            //------------------------------------------------------------------
+
+            for (int64_t t = nreach - 1 ; t >= 0 ; t--)
+            {
+                int64_t u = node [t] ;
+                double du = dist [u] ;
+                double d = 0 ;
+                for (GrB_Index p = Ap [u] ; p < Ap [u+1] ; p++)
+                {
+                    int64_t v = Aj [p] ;
+                    if (v == u) continue ;
+                    if (LG_dag_edge (du, dist [v], Ax [p], eps) &&
+                        sigma [v] > 0)
+                    {
+                        d += (1 + delta [v]) / sigma [v] ;
+                    }
+                }
+                delta [u] = sigma [u] * d ;
+                if (u != (int64_t) sources [k] && delta [u] != 0)
+                {
+                    #pragma omp atomic
+                    bc [u] += delta [u] ;
+                }
+            }
+
+            // clear the distances for the next source
+            for (GrB_Index p = Tp [k] ; p < Tp [k+1] ; p++)
+            {
+                dist [Tj [p]] = INFINITY ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (n, 1),
+        sizeof (GrB_Index), msg)) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        I [i] = i ;
+    }
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_build (*centrality, I, bc, n, GrB_PLUS_FP64)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,342 @@
+//------------------------------------------------------------------------------
+// LAGr_ClosenessCentrality: closeness and harmonic centrality
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is required).
+
+// LAGr_ClosenessCentrality and LAGr_HarmonicCentrality compute the closeness
+// and harmonic centrality of all nodes, from the lengths d(v,u) of the
+// shortest paths from each node v to the other nodes u, following the
+// direction of the edges.  The values of G->A are ignored.  If r(v) is the
+// number of nodes reachable from v (including v itself), and S(v) is the sum
+// of d(v,u) over those nodes, then
+
+//      closeness (v) = ((r(v)-1) / (n-1)) * ((r(v)-1) / S(v))
+//      harmonic (v)  = sum of 1/d(v,u), for u != v reachable from v
+
+// The closeness is the Wasserman-Faust form, which is the usual inverse of the
+// mean distance for a strongly connected graph, and which is not dominated
+// by small components otherwise.  Nodes that reach no other node have a
+// closeness of zero.
+
+// Exact mode (nsamples = 0, or nsamples >= n): the breadth-first searches
+// from all n nodes are done in batches, as in LAGr_Betweenness: each batch is
+// an ns-by-n frontier matrix, with one row per source, and each level of all
+// ns searches is one GrB_mxm with push-pull direction optimization.  The
+// number of nodes at each level is summed by row, and accumulated into r, S,
+// and the harmonic sum of each source.  The distances themselves are not kept.
+
+// Sampled mode (0 < nsamples < n): nsamples sources s are chosen at random,
+// and the searches are done on the transposed graph, which gives d(v,s) for
+// all v at once.  The level counts are summed by column, and the estimates of
+// Eppstein and Wang ("Fast approximation of centrality", J. Graph Algorithms
+// and Applications, 2004) are used: with k samples, of which c(v) are
+// reachable from v with a total distance of T(v),
+
+//      closeness (v) ~ c(v)^2 / (k * T(v))
+//      harmonic (v)  ~ ((n-1) / k) * sum of 1/d(v,s) over the samples
+
+// With k samples, the error in the mean distance of each node is O(D /
+// sqrt(k)) with high probability, where D is the diameter; k = log(n) /
+// epsilon^2 gives an error of epsilon*D for all nodes.
+
+//------------------------------------------------------------------------------
+// LG_Closeness: closeness or harmonic centrality
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&F) ;                                 \
+    GrB_free (&V) ;                                 \
+    GrB_free (&c) ;                                 \
+    GrB_free (&cnt) ;                               \
+    GrB_free (&dsum) ;                              \
+    GrB_free (&hsum) ;                              \
+    GrB_free (&cnt_b) ;                             \
+    GrB_free (&dsum_b) ;                            \
+    GrB_free (&hsum_b) ;                            \
+    GrB_free (&t) ;                                 \
+    LAGraph_Free ((void **) &sources, NULL) ;       \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (centrality) ;                         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// number of breadth-first searches done at once
+#define LG_CLOSENESS_BATCH 64
+
+static int LG_Closeness
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): centrality of node i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    bool harmonic,              // if true: harmonic, else closeness
+    GrB_Index nsamples,         // 0 for exact, else # of random sources
+    uint64_t seed,              // random number seed, for sampled mode
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix F = NULL, V = NULL ;
+    GrB_Vector c = NULL, cnt = NULL, dsum = NULL, hsum = NULL, cnt_b = NULL,
+        dsum_b = NULL, hsum_b = NULL, t = NULL ;
+    GrB_Index *sources = NULL ;
+    LG_ASSERT (centrality != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (*centrality, NULL, NULL, (double) 0, GrB_ALL, n,
+        NULL)) ;
+    if (n <= 1)
+    {
+        // no other nodes to reach
+        return (GrB_SUCCESS) ;
+    }
+
+    // The exact mode searches from each node v along the edges of A, to find
+    // d(v,u).  The sampled mode searches from each sample s along the edges
+    // of A', to find d(v,s).  P is the matrix for a push step, and a pull step
+    // uses P' = Q, with Q stored by row.
+    bool sampled = (nsamples > 0 && nsamples < n) ;
+    GrB_Matrix P = sampled ? AT : A ;
+    GrB_Matrix Q = sampled ? A : AT ;
+    GrB_Index ntotal = sampled ? nsamples : n ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    // cnt(v) = r(v)-1, dsum(v) = S(v), and hsum(v) is the harmonic sum
+    GRB_TRY (GrB_Vector_new (&cnt,  GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&dsum, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&hsum, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&t,    GrB_FP64, n)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &sources, LG_CLOSENESS_BATCH,
+        sizeof (GrB_Index), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // breadth-first searches, in batches
+    //--------------------------------------------------------------------------
+
+    for (GrB_Index b0 = 0 ; b0 < ntotal ; b0 += LG_CLOSENESS_BATCH)
+    {
+
+        //----------------------------------------------------------------------
+        // get the sources of this batch
+        //----------------------------------------------------------------------
+
+        GrB_Index ns = LAGRAPH_MIN (LG_CLOSENESS_BATCH, ntotal - b0) ;
+        for (GrB_Index i = 0 ; i < ns ; i++)
+        {
+            sources [i] = sampled ? (LG_Random60 (&seed) % n) : (b0 + i) ;
+        }
+
+        // the counts are summed by row (exact) or by column (sampled)
+        GrB_Index nc = sampled ? n : ns ;
+        GrB_Descriptor desc = sampled ? GrB_DESC_T0 : NULL ;
+        GRB_TRY (GrB_Vector_new (&c, GrB_FP64, nc)) ;
+        if (!sampled)
+        {
+            GRB_TRY (GrB_Vector_new (&cnt_b,  GrB_FP64, ns)) ;
+            GRB_TRY (GrB_Vector_new (&dsum_b, GrB_FP64, ns)) ;
+            GRB_TRY (GrB_Vector_new (&hsum_b, GrB_FP64, ns)) ;
+        }
+        // a sampled batch accumulates directly into the result
+        GrB_Vector cnt_acc  = sampled ? cnt  : cnt_b ;
+        GrB_Vector dsum_acc = sampled ? dsum : dsum_b ;
+        GrB_Vector hsum_acc = sampled ? hsum : hsum_b ;
+
+        // F (i,sources [i]) = true, and V = F
+        GRB_TRY (GrB_Matrix_new (&F, GrB_BOOL, ns, n)) ;
+        for (GrB_Index i = 0 ; i < ns ; i++)
+        {
+            GRB_TRY (GrB_Matrix_setElement (F, true, i, sources [i])) ;
+        }
+        GRB_TRY (GrB_Matrix_dup (&V, F)) ;
+        #if LAGRAPH_SUITESPARSE
+        GRB_TRY (GxB_set (V, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
+        #endif
+
+        //----------------------------------------------------------------------
+        // search all levels
+        //----------------------------------------------------------------------
+
+        bool last_was_pull = false ;
+        GrB_Index frontier_size = ns ;
+        for (int64_t d = 1 ; ; d++)
+        {
+
+            //------------------------------------------------------------------
+            // F<!V> = F*P, the next level
+            //------------------------------------------------------------------
+
+            // pull if F is more than 10% dense,
+            // or > 6% dense and last step was pull
+            double density = ((double) frontier_size) / (double) (ns*n) ;
+            bool do_pull = density > (last_was_pull ? 0.06 : 0.10) ;
+            if (do_pull)
+            {
+                #if LAGRAPH_SUITESPARSE
+                GRB_TRY (GxB_set (F, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+                #endif
+                GRB_TRY (GrB_mxm (F, V, NULL, LAGraph_any_one_bool, F, Q,
+                    GrB_DESC_RSCT1)) ;
+            }
+            else
+            {
+                #if LAGRAPH_SUITESPARSE
+                GRB_TRY (GxB_set (F, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+                #endif
+                GRB_TRY (GrB_mxm (F, V, NULL, LAGraph_any_one_bool, F, P,
+                    GrB_DESC_RSC)) ;
+            }
+            last_was_pull = do_pull ;
+            GRB_TRY (GrB_Matrix_nvals (&frontier_size, F)) ;
+            if (frontier_size == 0) break ;
+
+            // V<F> = true
+            GRB_TRY (GrB_assign (V, F, NULL, (bool) true, GrB_ALL, ns, GrB_ALL,
+                n, GrB_DESC_S)) ;
+
+            //------------------------------------------------------------------
+            // accumulate the number of nodes at distance d
+            //------------------------------------------------------------------
+
+            // c = sum (F, by row or column)
+            GRB_TRY (GrB_reduce (c, NULL, NULL, GrB_PLUS_MONOID_FP64, F,
+                desc)) ;
+            // cnt += c
+            GRB_TRY (GrB_assign (cnt_acc, NULL, GrB_PLUS_FP64, c, GrB_ALL,
+                nc, NULL)) ;
+            // dsum += c*d
+            GRB_TRY (GrB_apply (dsum_acc, NULL, GrB_PLUS_FP64, GrB_TIMES_FP64,
+                c, (double) d, NULL)) ;
+            // hsum += c/d
+            GRB_TRY (GrB_apply (hsum_acc, NULL, GrB_PLUS_FP64, GrB_DIV_FP64,
+                c, (double) d, NULL)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // save the results of an exact batch
+        //----------------------------------------------------------------------
+
+        if (!sampled)
+        {
+            GRB_TRY (GrB_assign (cnt, NULL, NULL, cnt_b, sources, ns, NULL)) ;
+            GRB_TRY (GrB_assign (dsum, NULL, NULL, dsum_b, sources, ns, NULL)) ;
+            GRB_TRY (GrB_assign (hsum, NULL, NULL, hsum_b, sources, ns, NULL)) ;
+            GrB_free (&cnt_b) ;
+            GrB_free (&dsum_b) ;
+            GrB_free (&hsum_b) ;
+        }
+        GrB_free (&c) ;
+        GrB_free (&F) ;
+        GrB_free (&V) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the centrality
+    //--------------------------------------------------------------------------
+
+    // k is the number of other nodes searched from, or the number of samples
+    double k = sampled ? ((double) nsamples) : ((double) (n-1)) ;
+
+    if (harmonic)
+    {
+        // centrality += hsum * ((n-1) / k)
+        GRB_TRY (GrB_apply (*centrality, NULL, GrB_PLUS_FP64, GrB_TIMES_FP64,
+            hsum, ((double) (n-1)) / k, NULL)) ;
+    }
+    else
+    {
+        // t = cnt.^2 ./ (k*dsum), where dsum > 0
+        GRB_TRY (GrB_select (dsum, NULL, NULL, GrB_VALUEGT_FP64, dsum,
+            (double) 0, NULL)) ;
+        GRB_TRY (GrB_eWiseMult (t, NULL, NULL, GrB_TIMES_FP64, cnt, cnt,
+            NULL)) ;
+        GRB_TRY (GrB_eWiseMult (t, NULL, NULL, GrB_DIV_FP64, t, dsum, NULL)) ;
+        // centrality += t / k
+        GRB_TRY (GrB_apply (*centrality, NULL, GrB_PLUS_FP64, GrB_DIV_FP64, t,
+            k, NULL)) ;
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_ClosenessCentrality: closeness centrality
+//------------------------------------------------------------------------------
+
+int LAGr_ClosenessCentrality
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): closeness of node i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    GrB_Index nsamples,         // 0 for exact, else # of random sources
+    uint64_t seed,              // random number seed, for sampled mode
+    char *msg
+)
+{
+    return (LG_Closeness (centrality, G, false, nsamples, seed, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_HarmonicCentrality: harmonic centrality
+//------------------------------------------------------------------------------
+
+int LAGr_HarmonicCentrality
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): harmonic centrality of i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    GrB_Index nsamples,         // 0 for exact, else # of random sources
+    uint64_t seed,              // random number seed, for sampled mode
+    char *msg
+)
+{
+    return (LG_Closeness (centrality, G, true, nsamples, seed, msg)) ;
+}
@@ -0,0 +1,296 @@
+//------------------------------------------------------------------------------
+// LAGr_HITSFused: hubs and authorities with a single pass over G->A
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (no cached properties are required, and
+// G->AT is not used).
+
+// LAGr_HITSFused computes the same hub and authority scores as LAGr_HITS
+// (each scaled to sum to 1), but with one pass over the structure of G->A per
+// iteration, rather than one pass over G->AT and another over G->A.  The
+// iteration is the power method on A'*A for the authorities a, with the hubs
+// h = A*a.  Each row i of A is visited once, in parallel, to compute
+
+//      h(i) = sum (a (A (i,:)))          the pull step, h = A*a
+//      anew (j) += h(i), for A(i,j)      the push step, anew = A'*h
+
+// while the row is still in cache, so A'*(A*a) is found without G->AT.  The
+// push is done with atomic updates.  The values of G->A are ignored.
+
+// Warm start: if a0 is not NULL, the iteration starts from a0 (for example,
+// the authorities of the graph before an update), rather than a uniform
+// vector.  Nodes not present in a0 start with 1/n, and the result is scaled
+// to sum to 1.
+
+// Per-node convergence: if vtol > 0, an authority that changes by no more
+// than vtol in one iteration is frozen: it keeps its value, and no further
+// updates are pushed to it.  Once all of the out-neighbors of a node i are
+// frozen, h(i) is also fixed, and row i is skipped.  The unfrozen
+// authorities are scaled to sum to 1 minus the sum of the frozen ones.  This
+// saves work on graphs where most nodes converge quickly, at the cost of
+// accuracy on the order of vtol per node.  With vtol = 0, no node is frozen.
+
+// The iteration stops when (sum (abs (a - aold)) + sum (abs (h - hold))) / 2
+// is at most tol, the same test as LAGr_HITS.  Sums are accumulated in FP64.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&S) ;                                 \
+    LAGraph_Free ((void **) &Ap, NULL) ;            \
+    LAGraph_Free ((void **) &Aj, NULL) ;            \
+    LAGraph_Free ((void **) &Ax, NULL) ;            \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+    LAGraph_Free ((void **) &a, NULL) ;             \
+    LAGraph_Free ((void **) &acc, NULL) ;           \
+    LAGraph_Free ((void **) &h, NULL) ;             \
+    LAGraph_Free ((void **) &hu, NULL) ;            \
+    LAGraph_Free ((void **) &frozen, NULL) ;        \
+    LAGraph_Free ((void **) &hdone, NULL) ;         \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&hubs_result) ;                       \
+    GrB_free (&auth_result) ;                       \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_HITSFused
+(
+    // output:
+    GrB_Vector *hubs,           // hubs(i): hub score of node i
+    GrB_Vector *authorities,    // authorities(i): authority score of node i
+    int *iters,                 // number of iterations taken
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Vector a0,        // initial authorities (may be NULL)
+    float tol,                  // stopping tolerance (typically 1e-4)
+    float vtol,                 // per-node tolerance, or 0 for none
+    int itermax,                // maximum number of iterations
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector hubs_result = NULL, auth_result = NULL ;
+    GrB_Matrix S = NULL ;
+    GrB_Index *Ap = NULL, *Aj = NULL, *I = NULL ;
+    bool *Ax = NULL, *frozen = NULL, *hdone = NULL ;
+    float *X = NULL, *a = NULL, *acc = NULL, *h = NULL, *hu = NULL ;
+
+    LG_ASSERT (hubs != NULL && authorities != NULL && iters != NULL,
+        GrB_NULL_POINTER) ;
+    (*hubs) = NULL ;
+    (*authorities) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (vtol >= 0, GrB_INVALID_VALUE, "vtol must be >= 0") ;
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    LG_ASSERT_MSG (nvals > 0, GrB_INVALID_VALUE, "G->A has no edges") ;
+    if (a0 != NULL)
+    {
+        GrB_Index na0 ;
+        GRB_TRY (GrB_Vector_size (&na0, a0)) ;
+        LG_ASSERT_MSG (na0 == n, GrB_DIMENSION_MISMATCH,
+            "a0 must have size n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // export the structure of A in CSR form
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Matrix_Structure (&S, G->A, msg)) ;
+    GrB_Index Ap_len, Aj_len, Ax_len ;
+    GRB_TRY (GrB_Matrix_exportSize (&Ap_len, &Aj_len, &Ax_len,
+        GrB_CSR_FORMAT, S)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ap, Ap_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Aj, Aj_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ax, Ax_len, sizeof (bool), msg)) ;
+    GRB_TRY (GrB_Matrix_export (Ap, Aj, Ax, &Ap_len, &Aj_len, &Ax_len,
+        GrB_CSR_FORMAT, S)) ;
+    GrB_free (&S) ;
+    LAGraph_Free ((void **) &Ax, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+
+    LG_TRY (LAGraph_Malloc ((void **) &a, n, sizeof (float), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &acc, n, sizeof (float), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &h, n, sizeof (float), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &hu, n, sizeof (float), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &frozen, n, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &hdone, n, sizeof (bool), msg)) ;
+
+    // a = a0, with 1/n for entries not present in a0, or a = 1/n
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        a [i] = 1.0 / n ;
+    }
+    if (a0 != NULL)
+    {
+        GrB_Index na0 ;
+        GRB_TRY (GrB_Vector_nvals (&na0, a0)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (na0, 1),
+            sizeof (GrB_Index), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &X, LAGRAPH_MAX (na0, 1),
+            sizeof (float), msg)) ;
+        GRB_TRY (GrB_Vector_extractTuples (I, X, &na0, a0)) ;
+        for (GrB_Index k = 0 ; k < na0 ; k++)
+        {
+            LG_ASSERT_MSG (X [k] >= 0, GrB_INVALID_VALUE,
+                "a0 must not be negative") ;
+            a [I [k]] = X [k] ;
+        }
+        LAGraph_Free ((void **) &I, NULL) ;
+        LAGraph_Free ((void **) &X, NULL) ;
+    }
+    double asum = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:asum)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        asum += a [i] ;
+    }
+    LG_ASSERT_MSG (asum > 0, GrB_INVALID_VALUE, "a0 must have a positive sum") ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        a [i] = (float) (a [i] / asum) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // HITS iterations
+    //--------------------------------------------------------------------------
+
+    double fsum = 0 ;       // sum of the frozen authorities
+    double rdiff = 1 ;      // first iteration is always done
+    for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "HITS failed to converge in %d iterations", itermax) ;
+
+        //----------------------------------------------------------------------
+        // hu = A*a and acc = A'*hu, in one pass over A
+        //----------------------------------------------------------------------
+
+        double husum = 0 ;
+        #pragma omp parallel for num_threads(nthreads) \
+            schedule(dynamic,1024) reduction(+:husum)
+        for (i = 0 ; i < (int64_t) n ; i++)
+        {
+            if (hdone [i])
+            {
+                // all out-neighbors of i are frozen, so hu(i) is unchanged
+                husum += hu [i] ;
+                continue ;
+            }
+            // hu(i) = sum (a (A (i,:)))
+            float s = 0 ;
+            for (GrB_Index q = Ap [i] ; q < Ap [i+1] ; q++)
+            {
+                s += a [Aj [q]] ;
+            }
+            hu [i] = s ;
+            husum += s ;
+            // acc (A (i,:)) += hu(i), for unfrozen authorities
+            bool pushed = false ;
+            for (GrB_Index q = Ap [i] ; q < Ap [i+1] ; q++)
+            {
+                GrB_Index j = Aj [q] ;
+                if (frozen [j]) continue ;
+                #pragma omp atomic
+                acc [j] += s ;
+                pushed = true ;
+            }
+            if (vtol > 0 && !pushed) hdone [i] = true ;
+        }
+
+        //----------------------------------------------------------------------
+        // scale h and a, and find the change in each
+        //----------------------------------------------------------------------
+
+        double accsum = 0 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:accsum)
+        for (i = 0 ; i < (int64_t) n ; i++)
+        {
+            accsum += acc [i] ;
+        }
+
+        // the unfrozen authorities sum to 1 - fsum
+        const double ascale = (accsum > 0) ? ((1 - fsum) / accsum) : 0 ;
+        const double hscale = (husum > 0) ? (1 / husum) : 0 ;
+        double diff = 0, fsum_next = 0 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:diff,fsum_next)
+        for (i = 0 ; i < (int64_t) n ; i++)
+        {
+            float hnew = (float) (hu [i] * hscale) ;
+            diff += fabs ((double) hnew - (double) h [i]) ;
+            h [i] = hnew ;
+            if (!frozen [i])
+            {
+                float anew = (float) (acc [i] * ascale) ;
+                float adiff = fabs (anew - a [i]) ;
+                diff += adiff ;
+                a [i] = anew ;
+                acc [i] = 0 ;
+                if (vtol > 0 && adiff <= vtol) frozen [i] = true ;
+            }
+            if (frozen [i]) fsum_next += a [i] ;
+        }
+
+        // the first iteration sets h, so it is not part of the change
+        rdiff = ((*iters) == 0) ? 1 : (diff / 2) ;
+        fsum = fsum_next ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index), msg)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        I [i] = i ;
+    }
+    GRB_TRY (GrB_Vector_new (&hubs_result, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_build (hubs_result, I, h, n, GrB_PLUS_FP32)) ;
+    GRB_TRY (GrB_Vector_new (&auth_result, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_build (auth_result, I, a, n, GrB_PLUS_FP32)) ;
+
+    (*hubs) = hubs_result ;
+    (*authorities) = auth_result ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
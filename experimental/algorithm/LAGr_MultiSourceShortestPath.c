@@ -0,0 +1,389 @@
+//------------------------------------------------------------------------------
+// LAGr_MultiSourceShortestPath: batched delta-stepping shortest paths
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (the light/heavy split of G->A is required,
+// from LAGraph_DeltaSplit_New).
+
+// LAGr_MultiSourceShortestPath computes the shortest path lengths from ns
+// source vertices to all vertices in the graph, with the same delta-stepping
+// method as LAGr_SingleSourceShortestPath.  Each vector of the single-source
+// method becomes an ns-by-n matrix, where row k holds the state for the source
+// vertex sources [k], and each GrB_vxm becomes a single GrB_mxm with the
+// min_plus semiring.  The current bucket of each source is row k of the
+// matrix Tmasked, so each source has its own bucket mask, but all sources
+// step through the buckets together.  A source with no vertices in the
+// current bucket has an empty row, and costs nothing in that step.
+
+// The split is used as-is, so the GrB_select of G->A is done once for all
+// sources, and the workspace is allocated once rather than per source.
+
+// The parent vectors are not computed.
+
+// NOTE: this method gets stuck in an infinite loop when there are negative-
+// weight cycles in the graph.
+
+#define LG_FREE_WORK        \
+{                           \
+    GrB_free (&lBound) ;    \
+    GrB_free (&uBound) ;    \
+    GrB_free (&Tmasked) ;   \
+    GrB_free (&TReq) ;      \
+    GrB_free (&Tless) ;     \
+    GrB_free (&S) ;         \
+    GrB_free (&Reach) ;     \
+    GrB_free (&Empty) ;     \
+}
+
+#define LG_FREE_ALL         \
+{                           \
+    LG_FREE_WORK ;          \
+    GrB_free (&T) ;         \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#define setelement(s, k)                                                      \
+{                                                                             \
+    switch (tcode)                                                            \
+    {                                                                         \
+        default:                                                              \
+        case 0 : GrB_Scalar_setElement_INT32  (s, k * delta_int32 ) ; break ; \
+        case 1 : GrB_Scalar_setElement_INT64  (s, k * delta_int64 ) ; break ; \
+        case 2 : GrB_Scalar_setElement_UINT32 (s, k * delta_uint32) ; break ; \
+        case 3 : GrB_Scalar_setElement_UINT64 (s, k * delta_uint64) ; break ; \
+        case 4 : GrB_Scalar_setElement_FP32   (s, k * delta_fp32  ) ; break ; \
+        case 5 : GrB_Scalar_setElement_FP64   (s, k * delta_fp64  ) ; break ; \
+    }                                                                         \
+}
+
+int LAGr_MultiSourceShortestPath
+(
+    // output:
+    GrB_Matrix *path_length,    // path_length (k,i) is the length of the
+                                // shortest path from sources [k] to vertex i
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    const GrB_Index *sources,   // source vertices, of size ns
+    int64_t ns,                 // number of source vertices
+    const LAGraph_DeltaSplit Split, // light/heavy split of G->A
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Scalar lBound = NULL ;  // the threshold for GrB_select
+    GrB_Scalar uBound = NULL ;  // the threshold for GrB_select
+    GrB_Matrix T = NULL ;       // tentative shortest path lengths
+    GrB_Matrix Tmasked = NULL ;
+    GrB_Matrix TReq = NULL ;
+    GrB_Matrix Tless = NULL ;
+    GrB_Matrix S = NULL ;
+    GrB_Matrix Reach = NULL ;
+    GrB_Matrix Empty = NULL ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (path_length != NULL && sources != NULL && Split != NULL,
+        GrB_NULL_POINTER) ;
+    LG_ASSERT (Split->Delta != NULL && Split->AL != NULL && Split->AH != NULL,
+        GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+    LG_ASSERT_MSG (ns > 0, GrB_INVALID_VALUE, "ns must be > 0") ;
+
+    GrB_Index nvals ;
+    GrB_Scalar Delta = Split->Delta ;
+    GRB_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+
+    GrB_Matrix AL = Split->AL ;
+    GrB_Matrix AH = Split->AH ;
+    GrB_Index n, nsplit ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nsplit, AL)) ;
+    LG_ASSERT_MSG (n == nsplit, GrB_DIMENSION_MISMATCH,
+        "split does not match the graph") ;
+    for (int64_t k = 0 ; k < ns ; k++)
+    {
+        LG_ASSERT_MSG (sources [k] < n, GrB_INVALID_INDEX,
+            "invalid source node") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // get the type of the A matrix
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G->A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+
+    GRB_TRY (GrB_Scalar_new (&lBound, etype)) ;
+    GRB_TRY (GrB_Scalar_new (&uBound, etype)) ;
+    GRB_TRY (GrB_Matrix_new (&T, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Tmasked, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&TReq, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Empty, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Tless, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&S, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Reach, GrB_BOOL, ns, n)) ;
+
+#if LAGRAPH_SUITESPARSE
+    // optional hints for SuiteSparse:GraphBLAS
+    GRB_TRY (GxB_set (T, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    GRB_TRY (GxB_set (Tmasked, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (TReq, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (Tless, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (S, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (Reach, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+#endif
+
+    // select the operators, and set T (:,:) = infinity
+    GrB_IndexUnaryOp ne, ge, lt ;
+    GrB_BinaryOp less_than ;
+    GrB_Semiring min_plus ;
+    int tcode ;
+    int32_t  delta_int32  ;
+    int64_t  delta_int64  ;
+    uint32_t delta_uint32 ;
+    uint64_t delta_uint64 ;
+    float    delta_fp32   ;
+    double   delta_fp64   ;
+
+    bool negative_edge_weights = true ;
+
+    if (etype == GrB_INT32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_int32, Delta)) ;
+        GRB_TRY (GrB_assign (T, NULL, NULL, (int32_t) INT32_MAX,
+            GrB_ALL, ns, GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_INT32 ;
+        ge = GrB_VALUEGE_INT32 ;
+        lt = GrB_VALUELT_INT32 ;
+        less_than = GrB_LT_INT32 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_INT32 ;
+        tcode = 0 ;
+    }
+    else if (etype == GrB_INT64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_int64, Delta)) ;
+        GRB_TRY (GrB_assign (T, NULL, NULL, (int64_t) INT64_MAX,
+            GrB_ALL, ns, GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_INT64 ;
+        ge = GrB_VALUEGE_INT64 ;
+        lt = GrB_VALUELT_INT64 ;
+        less_than = GrB_LT_INT64 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_INT64 ;
+        tcode = 1 ;
+    }
+    else if (etype == GrB_UINT32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_uint32, Delta)) ;
+        GRB_TRY (GrB_assign (T, NULL, NULL, (uint32_t) UINT32_MAX,
+            GrB_ALL, ns, GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_UINT32 ;
+        ge = GrB_VALUEGE_UINT32 ;
+        lt = GrB_VALUELT_UINT32 ;
+        less_than = GrB_LT_UINT32 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_UINT32 ;
+        tcode = 2 ;
+        negative_edge_weights = false ;
+    }
+    else if (etype == GrB_UINT64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_uint64, Delta)) ;
+        GRB_TRY (GrB_assign (T, NULL, NULL, (uint64_t) UINT64_MAX,
+            GrB_ALL, ns, GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_UINT64 ;
+        ge = GrB_VALUEGE_UINT64 ;
+        lt = GrB_VALUELT_UINT64 ;
+        less_than = GrB_LT_UINT64 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_UINT64 ;
+        tcode = 3 ;
+        negative_edge_weights = false ;
+    }
+    else if (etype == GrB_FP32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_fp32, Delta)) ;
+        GRB_TRY (GrB_assign (T, NULL, NULL, (float) INFINITY,
+            GrB_ALL, ns, GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_FP32 ;
+        ge = GrB_VALUEGE_FP32 ;
+        lt = GrB_VALUELT_FP32 ;
+        less_than = GrB_LT_FP32 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_FP32 ;
+        tcode = 4 ;
+    }
+    else if (etype == GrB_FP64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&delta_fp64, Delta)) ;
+        GRB_TRY (GrB_assign (T, NULL, NULL, (double) INFINITY,
+            GrB_ALL, ns, GrB_ALL, n, NULL)) ;
+        ne = GrB_VALUENE_FP64 ;
+        ge = GrB_VALUEGE_FP64 ;
+        lt = GrB_VALUELT_FP64 ;
+        less_than = GrB_LT_FP64 ;
+        min_plus = GrB_MIN_PLUS_SEMIRING_FP64 ;
+        tcode = 5 ;
+    }
+    else
+    {
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+
+    // check if the graph might have negative edge weights
+    if (negative_edge_weights)
+    {
+        double emin = -1 ;
+        if (G->emin != NULL &&
+            (G->emin_state == LAGraph_VALUE ||
+             G->emin_state == LAGraph_BOUND))
+        {
+            GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+        }
+        negative_edge_weights = (emin < 0) ;
+    }
+
+    for (int64_t k = 0 ; k < ns ; k++)
+    {
+        GrB_Index src = sources [k] ;
+        // T (k,src) = 0
+        GRB_TRY (GrB_Matrix_setElement (T, 0, k, src)) ;
+        // Reach (k,src) = true
+        GRB_TRY (GrB_Matrix_setElement (Reach, true, k, src)) ;
+        // S (k,src) = true
+        GRB_TRY (GrB_Matrix_setElement (S, true, k, src)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // while (T >= step*Delta) not empty
+    //--------------------------------------------------------------------------
+
+    for (int64_t step = 0 ; ; step++)
+    {
+
+        //----------------------------------------------------------------------
+        // Tmasked = all entries in T<Reach> that are less than (step+1)*Delta
+        //----------------------------------------------------------------------
+
+        setelement (uBound, (step+1)) ;        // uBound = (step+1) * Delta
+        GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+
+        // Tmasked<Reach> = T
+        GRB_TRY (GrB_assign (Tmasked, Reach, NULL, T, GrB_ALL, ns, GrB_ALL, n,
+            NULL)) ;
+        // Tmasked = select (Tmasked < (step+1)*Delta)
+        GRB_TRY (GrB_select (Tmasked, NULL, NULL, lt, Tmasked, uBound, NULL)) ;
+
+        GrB_Index tmasked_nvals ;
+        GRB_TRY (GrB_Matrix_nvals (&tmasked_nvals, Tmasked)) ;
+
+        //----------------------------------------------------------------------
+        // continue while the current buckets (Tmasked) are not all empty
+        //----------------------------------------------------------------------
+
+        while (tmasked_nvals > 0)
+        {
+            // TReq = Tmasked*AL using the min_plus semiring
+            GRB_TRY (GrB_mxm (TReq, NULL, NULL, min_plus, Tmasked, AL, NULL)) ;
+
+            // S<struct(Tmasked)> = true
+            GRB_TRY (GrB_assign (S, Tmasked, NULL, (bool) true,
+                GrB_ALL, ns, GrB_ALL, n, GrB_DESC_S)) ;
+
+            // if nvals (TReq) is 0, no need to continue the rest of this loop
+            GrB_Index treq_nvals ;
+            GRB_TRY (GrB_Matrix_nvals (&treq_nvals, TReq)) ;
+            if (treq_nvals == 0) break ;
+
+            // Tless = (TReq .< T) using set intersection
+            GRB_TRY (GrB_eWiseMult (Tless, NULL, NULL, less_than, TReq, T,
+                NULL)) ;
+
+            // remove explicit zeros from Tless so it can be used as a
+            // structural mask
+            GrB_Index tless_nvals ;
+            GRB_TRY (GrB_select (Tless, NULL, NULL, ne, Tless, 0, NULL)) ;
+            GRB_TRY (GrB_Matrix_nvals (&tless_nvals, Tless)) ;
+            if (tless_nvals == 0) break ;
+
+            // Reach<struct(Tless)> = true
+            GRB_TRY (GrB_assign (Reach, Tless, NULL, (bool) true,
+                GrB_ALL, ns, GrB_ALL, n, GrB_DESC_S)) ;
+
+            // Tmasked<struct(Tless)> = select (TReq < (step+1)*Delta)
+            GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+            GRB_TRY (GrB_select (Tmasked, Tless, NULL, lt, TReq, uBound,
+                GrB_DESC_S)) ;
+
+            if (negative_edge_weights)
+            {
+                // see LAGr_SingleSourceShortestPath
+                setelement (lBound, (step)) ;  // lBound = step*Delta
+                GRB_TRY (GrB_select (Tmasked, NULL, NULL, ge, Tmasked, lBound,
+                    NULL)) ;
+            }
+
+            // T<struct(Tless)> = TReq
+            GRB_TRY (GrB_assign (T, Tless, NULL, TReq, GrB_ALL, ns, GrB_ALL, n,
+                GrB_DESC_S)) ;
+            GRB_TRY (GrB_Matrix_nvals (&tmasked_nvals, Tmasked)) ;
+        }
+
+        // Tmasked<S> = T
+        GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+        GRB_TRY (GrB_assign (Tmasked, S, NULL, T, GrB_ALL, ns, GrB_ALL, n,
+            GrB_DESC_S)) ;
+
+        // TReq = Tmasked*AH using the min_plus semiring
+        GRB_TRY (GrB_mxm (TReq, NULL, NULL, min_plus, Tmasked, AH, NULL)) ;
+
+        // Tless = (TReq .< T) using set intersection
+        GRB_TRY (GrB_eWiseMult (Tless, NULL, NULL, less_than, TReq, T, NULL)) ;
+
+        // T<Tless> = TReq, which computes T = min (T, TReq)
+        GRB_TRY (GrB_assign (T, Tless, NULL, TReq, GrB_ALL, ns, GrB_ALL, n,
+            NULL)) ;
+
+        //----------------------------------------------------------------------
+        // find out how many left to be computed
+        //----------------------------------------------------------------------
+
+        // Reach<Tless> = true
+        GRB_TRY (GrB_assign (Reach, Tless, NULL, (bool) true,
+            GrB_ALL, ns, GrB_ALL, n, NULL)) ;
+
+        // remove previous buckets: Reach<struct(S)> = Empty
+        GRB_TRY (GrB_assign (Reach, S, NULL, Empty, GrB_ALL, ns, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        GrB_Index nreach ;
+        GRB_TRY (GrB_Matrix_nvals (&nreach, Reach)) ;
+        if (nreach == 0) break ;
+
+        GRB_TRY (GrB_Matrix_clear (S)) ; // clear S for the next iteration
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*path_length) = T ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
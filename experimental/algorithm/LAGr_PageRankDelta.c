@@ -0,0 +1,293 @@
+//------------------------------------------------------------------------------
+// LAGr_PageRankDelta: PageRank by delta propagation or Gauss-Seidel sweeps
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// LAGr_PageRankDelta computes the same PageRank as LAGr_PageRank, with sinks
+// handled the same way, but without the full GrB_mxv over all of AT in every
+// iteration.  Both methods solve the "leaky" system
+//
+//      y = (1-damping)/n + damping * AT * (y ./ d_out)
+//
+// in which the rank held by sinks is simply lost, rather than redistributed.
+// Since LAGr_PageRank redistributes the sink rank uniformly, just like the
+// teleport, its result is a scalar multiple of y, and is found by scaling y to
+// sum to 1 at the end.  This avoids a dense update of all nodes whenever a
+// sink gains rank.
+
+// LAGr_PageRankDelta_Push: the rank changes (deltas) are propagated instead
+//      of the ranks.  The vector r holds the change not yet propagated,
+//      starting with r = (1-damping)/n, and p holds the rank accumulated so
+//      far, starting with p = 0.  In each iteration, the active set is the
+//      set of nodes with r(i) >= tol*(1-damping)/n.  Its deltas are added to
+//      p, removed from r, and propagated with a single GrB_mxv of AT with the
+//      sparse vector r(active) ./ d_out, so that only the edges out of the
+//      active set are traversed.  Nodes whose rank has converged have a tiny
+//      delta and drop out of the active set, and deltas below the threshold
+//      are not lost, but accumulate in r until they are large enough to
+//      propagate.  The method stops when the active set is empty; then sum(r)
+//      < tol*(1-damping), so the error in y is less than tol.
+//
+// LAGr_PageRankDelta_GaussSeidel: AT * diag (damping ./ d_out) is exported in
+//      CSR form, and the rank is updated in place, row by row, in plain C, so
+//      that each update uses the newest ranks available.  The rows are split
+//      into one contiguous block per thread; within its block, each thread
+//      uses its own newest ranks (a Gauss-Seidel sweep), and it uses the ranks
+//      of other blocks from the previous sweep (a Jacobi step), so that no
+//      thread reads a rank being written by another thread.  With one thread
+//      this is the classical Gauss-Seidel method.  The method stops when the
+//      1-norm of the change in a sweep is at most tol, as in LAGr_PageRank.
+//      This method needs O(|E|) extra memory for the exported matrix.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&d) ;                                 \
+    GrB_free (&w) ;                                 \
+    GrB_free (&rF) ;                                \
+    GrB_free (&r) ;                                 \
+    GrB_free (&dinv) ;                              \
+    GrB_free (&Dm) ;                                \
+    GrB_free (&ATs) ;                               \
+    LAGraph_Free ((void **) &Ap, NULL) ;            \
+    LAGraph_Free ((void **) &Aj, NULL) ;            \
+    LAGraph_Free ((void **) &Ax, NULL) ;            \
+    LAGraph_Free ((void **) &x, NULL) ;             \
+    LAGraph_Free ((void **) &xold, NULL) ;          \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&p) ;                                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_PageRankDelta
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    LAGr_PageRankDelta_Method method,   // method to use
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector p = NULL, r = NULL, rF = NULL, w = NULL, d = NULL, dinv = NULL ;
+    GrB_Matrix Dm = NULL, ATs = NULL ;
+    GrB_Index *Ap = NULL, *Aj = NULL, *I = NULL ;
+    float *Ax = NULL, *x = NULL, *xold = NULL ;
+
+    LG_ASSERT (centrality != NULL && iters != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (method == LAGr_PageRankDelta_Push ||
+        method == LAGr_PageRankDelta_GaussSeidel, GrB_INVALID_VALUE,
+        "invalid method") ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+    const float teleport = (1 - damping) / n ;
+    GRB_TRY (GrB_Vector_new (&p, GrB_FP32, n)) ;
+
+    if (method == LAGr_PageRankDelta_Push)
+    {
+
+        //----------------------------------------------------------------------
+        // delta propagation over the active set
+        //----------------------------------------------------------------------
+
+        const float threshold = tol * teleport ;
+
+        // r = (1-damping)/n, the delta not yet propagated
+        GRB_TRY (GrB_Vector_new (&r, GrB_FP32, n)) ;
+        GRB_TRY (GrB_assign (r, NULL, NULL, teleport, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_Vector_new (&rF, GrB_FP32, n)) ;
+        GRB_TRY (GrB_Vector_new (&w, GrB_FP32, n)) ;
+
+        // d = d_out / damping, so w = rF ./ d includes the damping factor
+        GRB_TRY (GrB_Vector_new (&d, GrB_FP32, n)) ;
+        GRB_TRY (GrB_apply (d, NULL, NULL, GrB_DIV_FP32, d_out, damping,
+            NULL)) ;
+
+        for ((*iters) = 0 ; ; (*iters)++)
+        {
+            // rF = the active set: entries of r >= threshold
+            GRB_TRY (GrB_select (rF, NULL, NULL, GrB_VALUEGE_FP32, r,
+                threshold, NULL)) ;
+            GrB_Index nactive ;
+            GRB_TRY (GrB_Vector_nvals (&nactive, rF)) ;
+            if (nactive == 0) break ;
+
+            // check for convergence
+            LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+                "pagerank failed to converge in %d iterations", itermax) ;
+
+            // p += rF
+            GRB_TRY (GrB_assign (p, NULL, GrB_PLUS_FP32, rF, GrB_ALL, n,
+                NULL)) ;
+            // r<!struct(rF),replace> = r, which removes the active set
+            GRB_TRY (GrB_assign (r, rF, NULL, r, GrB_ALL, n, GrB_DESC_RSC)) ;
+            // w = rF ./ d, where sinks are dropped
+            GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, rF, d,
+                NULL)) ;
+            // r += AT*w, for the edges out of the active set only
+            GRB_TRY (GrB_mxv (r, NULL, GrB_PLUS_FP32,
+                LAGraph_plus_second_fp32, AT, w, NULL)) ;
+        }
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // block Gauss-Seidel sweeps, in place
+        //----------------------------------------------------------------------
+
+        // ATs = AT * diag (damping ./ d_out), exported in CSR form
+        GRB_TRY (GrB_Vector_new (&dinv, GrB_FP32, n)) ;
+        GRB_TRY (GrB_apply (dinv, NULL, NULL, GrB_DIV_FP32, damping, d_out,
+            NULL)) ;
+        GRB_TRY (GrB_Matrix_diag (&Dm, dinv, 0)) ;
+        GRB_TRY (GrB_Matrix_new (&ATs, GrB_FP32, n, n)) ;
+        GRB_TRY (GrB_mxm (ATs, NULL, NULL, LAGraph_plus_second_fp32, AT, Dm,
+            NULL)) ;
+        GrB_free (&Dm) ;
+        GrB_free (&dinv) ;
+        GrB_Index Ap_len, Aj_len, Ax_len ;
+        GRB_TRY (GrB_Matrix_exportSize (&Ap_len, &Aj_len, &Ax_len,
+            GrB_CSR_FORMAT, ATs)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Ap, Ap_len, sizeof (GrB_Index),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Aj, Aj_len, sizeof (GrB_Index),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Ax, Ax_len, sizeof (float), msg)) ;
+        GRB_TRY (GrB_Matrix_export (Ap, Aj, Ax, &Ap_len, &Aj_len, &Ax_len,
+            GrB_CSR_FORMAT, ATs)) ;
+        GrB_free (&ATs) ;
+
+        // x = xold = (1-damping)/n
+        LG_TRY (LAGraph_Malloc ((void **) &x, n, sizeof (float), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &xold, n, sizeof (float), msg)) ;
+        for (int64_t i = 0 ; i < (int64_t) n ; i++)
+        {
+            x [i] = teleport ;
+            xold [i] = teleport ;
+        }
+
+        int nthreads, nthreads_outer, nthreads_inner ;
+        LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner,
+            msg)) ;
+        nthreads = nthreads_outer * nthreads_inner ;
+        nthreads = (int) LAGRAPH_MIN ((GrB_Index) nthreads,
+            LAGRAPH_MAX (n / 1024, 1)) ;
+
+        float rdiff = 1 ;   // first sweep is always done
+        for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
+        {
+            // check for convergence
+            LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+                "pagerank failed to converge in %d iterations", itermax) ;
+
+            // one sweep: x(i) = teleport + ATs(i,:)*x, for each row i
+            int tid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t i1 = (tid * (int64_t) n) / nthreads ;
+                int64_t i2 = ((tid+1) * (int64_t) n) / nthreads ;
+                for (int64_t i = i1 ; i < i2 ; i++)
+                {
+                    float s = teleport ;
+                    for (GrB_Index q = Ap [i] ; q < Ap [i+1] ; q++)
+                    {
+                        int64_t j = (int64_t) Aj [q] ;
+                        // newest rank in this block, previous one elsewhere
+                        float xj = (j >= i1 && j < i2) ? x [j] : xold [j] ;
+                        s += Ax [q] * xj ;
+                    }
+                    x [i] = s ;
+                }
+            }
+
+            // rdiff = sum (abs (x - xold)), and xold = x
+            double diff = 0 ;
+            int64_t i ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:diff)
+            for (i = 0 ; i < (int64_t) n ; i++)
+            {
+                diff += fabs (x [i] - xold [i]) ;
+                xold [i] = x [i] ;
+            }
+            rdiff = (float) diff ;
+        }
+
+        // p = x
+        LG_TRY (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index), msg)) ;
+        for (int64_t i = 0 ; i < (int64_t) n ; i++)
+        {
+            I [i] = i ;
+        }
+        GRB_TRY (GrB_Vector_build (p, I, x, n, GrB_PLUS_FP32)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // scale the result to sum to 1, which redistributes the sink rank
+    //--------------------------------------------------------------------------
+
+    float psum = 0 ;
+    GRB_TRY (GrB_reduce (&psum, NULL, GrB_PLUS_MONOID_FP32, p, NULL)) ;
+    GRB_TRY (GrB_apply (p, NULL, NULL, GrB_DIV_FP32, p, psum, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = p ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
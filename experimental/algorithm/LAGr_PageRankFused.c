@@ -0,0 +1,303 @@
+//------------------------------------------------------------------------------
+// LAGr_PageRankFused: PageRank with a fused, mixed-precision iteration
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// LAGr_PageRankFused computes the same PageRank as LAGr_PageRank (with sinks
+// handled the same way), but each iteration is a single pass over the graph
+// and the vectors, rather than the six separate GraphBLAS passes of
+// LAGr_PageRank (eWiseMult, assign, mxv, assign, apply, and reduce).  The
+// structure of AT is exported once in CSR form, and each iteration computes,
+// for each node i, in a single parallel loop:
+//
+//      r(i) = teleport + sum (w (AT (i,:)))     the pull step
+//      rdiff += abs (r(i) - rold(i))            the convergence norm
+//      wnext(i) = r(i) * damping / d_out(i)     scaled for the next iteration
+//      sinks += r(i), if node i is a sink       for the next teleport
+//
+// where w holds the ranks of the previous iteration, prescaled by
+// damping/d_out (and zero for sinks), and teleport = (1-damping)/n + damping *
+// sum (r (sinks)) / n.  The ranks are held in FP32, and rdiff and the sink
+// sum are accumulated in FP64, so the convergence test does not suffer from
+// roundoff for large n.
+
+// The gather w (AT (i,:)) is the dominant memory traffic.  With the
+// LAGr_PageRank_BF16 storage mode, w is held in bfloat16 (the upper 16 bits of
+// an FP32, rounded to nearest even), which halves the traffic of the gather.
+// The ranks themselves and all sums remain in FP32 or FP64.  bfloat16 has an
+// 8-bit significand, so each rank contribution is perturbed by a relative
+// error of up to 2^-9, and tol should not be much smaller than about 1e-3 in
+// this mode.  bfloat16 is converted with integer operations, so no compiler
+// support for 16-bit floating-point types is needed.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&S) ;                                 \
+    LAGraph_Free ((void **) &Ap, NULL) ;            \
+    LAGraph_Free ((void **) &Aj, NULL) ;            \
+    LAGraph_Free ((void **) &Ax, NULL) ;            \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+    LAGraph_Free ((void **) &r, NULL) ;             \
+    LAGraph_Free ((void **) &invd, NULL) ;          \
+    LAGraph_Free ((void **) &w, NULL) ;             \
+    LAGraph_Free ((void **) &wnext, NULL) ;         \
+    LAGraph_Free ((void **) &wb, NULL) ;            \
+    LAGraph_Free ((void **) &wbnext, NULL) ;        \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&p) ;                                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// bfloat16 conversions
+//------------------------------------------------------------------------------
+
+static inline float bf16_to_fp32 (uint16_t h)
+{
+    uint32_t u = ((uint32_t) h) << 16 ;
+    float x ;
+    memcpy (&x, &u, sizeof (float)) ;
+    return (x) ;
+}
+
+static inline uint16_t fp32_to_bf16 (float x)
+{
+    // round to nearest even; ranks are finite and non-negative
+    uint32_t u ;
+    memcpy (&u, &x, sizeof (float)) ;
+    u += 0x7FFF + ((u >> 16) & 1) ;
+    return ((uint16_t) (u >> 16)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_PageRankFused
+//------------------------------------------------------------------------------
+
+int LAGr_PageRankFused
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    LAGr_PageRank_Storage storage,  // storage of the scaled ranks
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector p = NULL ;
+    GrB_Matrix S = NULL ;
+    GrB_Index *Ap = NULL, *Aj = NULL, *I = NULL ;
+    bool *Ax = NULL ;
+    int64_t *X = NULL ;
+    float *r = NULL, *invd = NULL, *w = NULL, *wnext = NULL ;
+    uint16_t *wb = NULL, *wbnext = NULL ;
+
+    LG_ASSERT (centrality != NULL && iters != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (storage == LAGr_PageRank_FP32 ||
+        storage == LAGr_PageRank_BF16, GrB_INVALID_VALUE,
+        "invalid storage mode") ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+    bool use_bf16 = (storage == LAGr_PageRank_BF16) ;
+
+    //--------------------------------------------------------------------------
+    // export the structure of AT in CSR form
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+    LG_TRY (LAGraph_Matrix_Structure (&S, AT, msg)) ;
+    GrB_Index Ap_len, Aj_len, Ax_len ;
+    GRB_TRY (GrB_Matrix_exportSize (&Ap_len, &Aj_len, &Ax_len,
+        GrB_CSR_FORMAT, S)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ap, Ap_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Aj, Aj_len, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ax, Ax_len, sizeof (bool), msg)) ;
+    GRB_TRY (GrB_Matrix_export (Ap, Aj, Ax, &Ap_len, &Aj_len, &Ax_len,
+        GrB_CSR_FORMAT, S)) ;
+    GrB_free (&S) ;
+    LAGraph_Free ((void **) &Ax, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // invd = damping ./ d_out, or zero for sinks
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Calloc ((void **) &invd, n, sizeof (float), msg)) ;
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (nvals, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, LAGRAPH_MAX (nvals, 1),
+        sizeof (int64_t), msg)) ;
+    GRB_TRY (GrB_Vector_extractTuples (I, X, &nvals, d_out)) ;
+    for (GrB_Index k = 0 ; k < nvals ; k++)
+    {
+        invd [I [k]] = damping / X [k] ;
+    }
+    LAGraph_Free ((void **) &I, NULL) ;
+    LAGraph_Free ((void **) &X, NULL) ;
+    bool has_sinks = (nvals < n) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+
+    // r = 1/n, and w = r .* invd
+    LG_TRY (LAGraph_Malloc ((void **) &r, n, sizeof (float), msg)) ;
+    if (use_bf16)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &wb, n, sizeof (uint16_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &wbnext, n, sizeof (uint16_t),
+            msg)) ;
+    }
+    else
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &w, n, sizeof (float), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &wnext, n, sizeof (float), msg)) ;
+    }
+    const float r0 = 1.0 / n ;
+    double sinks = 0 ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:sinks)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        r [i] = r0 ;
+        float wi = r0 * invd [i] ;
+        if (use_bf16)
+        {
+            wb [i] = fp32_to_bf16 (wi) ;
+        }
+        else
+        {
+            w [i] = wi ;
+        }
+        if (has_sinks && invd [i] == 0) sinks += r0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations
+    //--------------------------------------------------------------------------
+
+    const float scaled_damping = (1 - damping) / n ;
+    const double damping_over_n = ((double) damping) / n ;
+    double rdiff = 1 ;      // first iteration is always done
+    for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+
+        // teleport = (1 - damping) / n + (damping/n) * sum (r (sinks))
+        const float teleport = (float) (scaled_damping +
+            damping_over_n * sinks) ;
+        double diff = 0, sinks_next = 0 ;
+
+        if (use_bf16)
+        {
+            #pragma omp parallel for num_threads(nthreads) \
+                schedule(dynamic,1024) reduction(+:diff,sinks_next)
+            for (i = 0 ; i < (int64_t) n ; i++)
+            {
+                float s = 0 ;
+                for (GrB_Index q = Ap [i] ; q < Ap [i+1] ; q++)
+                {
+                    s += bf16_to_fp32 (wb [Aj [q]]) ;
+                }
+                s += teleport ;
+                diff += fabs ((double) s - (double) r [i]) ;
+                r [i] = s ;
+                wbnext [i] = fp32_to_bf16 (s * invd [i]) ;
+                if (has_sinks && invd [i] == 0) sinks_next += s ;
+            }
+            uint16_t *t = wb ; wb = wbnext ; wbnext = t ;
+        }
+        else
+        {
+            #pragma omp parallel for num_threads(nthreads) \
+                schedule(dynamic,1024) reduction(+:diff,sinks_next)
+            for (i = 0 ; i < (int64_t) n ; i++)
+            {
+                float s = 0 ;
+                for (GrB_Index q = Ap [i] ; q < Ap [i+1] ; q++)
+                {
+                    s += w [Aj [q]] ;
+                }
+                s += teleport ;
+                diff += fabs ((double) s - (double) r [i]) ;
+                r [i] = s ;
+                wnext [i] = s * invd [i] ;
+                if (has_sinks && invd [i] == 0) sinks_next += s ;
+            }
+            float *t = w ; w = wnext ; wnext = t ;
+        }
+
+        rdiff = diff ;
+        sinks = sinks_next ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index), msg)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        I [i] = i ;
+    }
+    GRB_TRY (GrB_Vector_new (&p, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_build (p, I, r, n, GrB_PLUS_FP32)) ;
+
+    (*centrality) = p ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,242 @@
+//------------------------------------------------------------------------------
+// LAGr_PageRankIncremental: warm-started PageRank after a graph update
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// LAGr_PageRankIncremental recomputes the PageRank of a graph that has been
+// slightly modified, starting from the PageRank r0 of the graph before the
+// change, rather than from 1/n.  It uses the delta propagation of
+// LAGr_PageRankDelta (LAGr_PageRankDelta_Push), which solves the leaky system
+// y = b + M*y, with b = (1-damping)/n and M = damping * AT * diag (1./d_out),
+// and then scales y to sum to 1.
+
+// The start is y0 = s*r0, where s = (1-damping) / (1 - damping + damping *
+// sum (r0 (sinks))) is the sum of the leaky solution when r0 is exact.  The
+// initial residual is r = b + M*y0 - y0, which is zero wherever the PageRank
+// is unchanged, and propagation starts from only those nodes whose residual
+// is large (positive or negative), just as in LAGr_PageRankDelta.
+
+// If the changed nodes are given (both endpoints of each added or removed
+// edge), the residual is only nonzero for them and their out-neighbors, so it
+// is only computed there, with a masked GrB_mxv.  Then the work is
+// proportional to the size of the affected region, rather than the whole
+// graph.  If changed is NULL, the residual is computed for all nodes.
+
+// If an update changes which nodes are sinks, the residual outside the
+// affected region is not zero, but the uniform term c = damping * s *
+// (sigma - sigma0) / n, where sigma and sigma0 are the rank of r0 on the
+// sinks after and before the update.  A uniform residual on all n nodes
+// only rescales y, and is removed by the final scaling, so c is subtracted
+// from the residual inside the affected region, which gives the same result
+// as computing the residual everywhere.  sigma0 is not known, but the
+// residual of all nodes sums to (1-damping) * (1 - sum (y0)) - damping * s *
+// sigma, so c is found from the residual inside the affected region.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&d) ;                 \
+    GrB_free (&w) ;                 \
+    GrB_free (&r) ;                 \
+    GrB_free (&rF) ;                \
+    GrB_free (&rabs) ;              \
+    GrB_free (&aff) ;               \
+    GrB_free (&rsink) ;             \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&p) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_PageRankIncremental
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph, after the update
+    const GrB_Vector r0,    // pagerank of the graph before the update
+    const GrB_Vector changed,   // nodes with changed edges (may be NULL)
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector p = NULL, r = NULL, rF = NULL, rabs = NULL, w = NULL, d = NULL,
+        aff = NULL, rsink = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL && r0 != NULL,
+        GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    GrB_Index n, nr0 ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+    GRB_TRY (GrB_Vector_size (&nr0, r0)) ;
+    LG_ASSERT_MSG (nr0 == n, GrB_DIMENSION_MISMATCH, "r0 must have size n") ;
+    if (changed != NULL)
+    {
+        GrB_Index nchanged ;
+        GRB_TRY (GrB_Vector_size (&nchanged, changed)) ;
+        LG_ASSERT_MSG (nchanged == n, GrB_DIMENSION_MISMATCH,
+            "changed must have size n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    const float teleport = (1 - damping) / n ;
+    const float threshold = tol * teleport ;
+
+    // d = d_out / damping
+    GRB_TRY (GrB_Vector_new (&d, GrB_FP32, n)) ;
+    GRB_TRY (GrB_apply (d, NULL, NULL, GrB_DIV_FP32, d_out, damping, NULL)) ;
+
+    // sigma = sum (r0 (sinks))
+    float sigma = 0 ;
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+    if (nvals < n)
+    {
+        // rsink<!struct(d_out)> = r0
+        GRB_TRY (GrB_Vector_new (&rsink, GrB_FP32, n)) ;
+        GRB_TRY (GrB_assign (rsink, d_out, NULL, r0, GrB_ALL, n,
+            GrB_DESC_SC)) ;
+        GRB_TRY (GrB_reduce (&sigma, NULL, GrB_PLUS_MONOID_FP32, rsink,
+            NULL)) ;
+        GrB_free (&rsink) ;
+    }
+
+    // p = y0 = s*r0
+    float s = (1 - damping) / (1 - damping + damping * sigma) ;
+    GRB_TRY (GrB_Vector_new (&p, GrB_FP32, n)) ;
+    GRB_TRY (GrB_apply (p, NULL, NULL, GrB_TIMES_FP32, r0, s, NULL)) ;
+
+    // aff = changed and its out-neighbors: the rows where r may be nonzero
+    GrB_Descriptor desc = NULL ;
+    if (changed != NULL)
+    {
+        GRB_TRY (GrB_Vector_new (&aff, GrB_BOOL, n)) ;
+        GRB_TRY (GrB_vxm (aff, NULL, NULL, LAGraph_any_one_bool, changed,
+            G->A, NULL)) ;
+        GRB_TRY (GrB_assign (aff, changed, NULL, (bool) true, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        desc = GrB_DESC_S ;
+    }
+
+    // r<aff> = b + M*y0 - y0
+    GRB_TRY (GrB_Vector_new (&w, GrB_FP32, n)) ;
+    GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, p, d, NULL)) ;
+    GRB_TRY (GrB_Vector_new (&r, GrB_FP32, n)) ;
+    GRB_TRY (GrB_assign (r, aff, NULL, teleport, GrB_ALL, n, desc)) ;
+    GRB_TRY (GrB_mxv (r, aff, GrB_PLUS_FP32, LAGraph_plus_second_fp32, AT, w,
+        desc)) ;
+    GRB_TRY (GrB_assign (r, aff, GrB_MINUS_FP32, p, GrB_ALL, n, desc)) ;
+
+    GrB_Index naff = n ;
+    if (changed != NULL)
+    {
+        GRB_TRY (GrB_Vector_nvals (&naff, aff)) ;
+    }
+    if (naff < n)
+    {
+        // c = the uniform residual outside aff
+        double ysum = 0, raff = 0 ;
+        GRB_TRY (GrB_reduce (&ysum, NULL, GrB_PLUS_MONOID_FP64, p, NULL)) ;
+        GRB_TRY (GrB_reduce (&raff, NULL, GrB_PLUS_MONOID_FP64, r, NULL)) ;
+        double rsum = (1 - damping) * (1 - ysum) - damping * s * sigma ;
+        float c = (float) ((rsum - raff) / (double) (n - naff)) ;
+        // r<aff> -= c
+        GRB_TRY (GrB_assign (r, aff, GrB_MINUS_FP32, c, GrB_ALL, n,
+            GrB_DESC_S)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // propagate the residual
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&rF, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&rabs, GrB_FP32, n)) ;
+
+    for ((*iters) = 0 ; ; (*iters)++)
+    {
+        // rabs = the active set: entries with abs (r) >= threshold
+        GRB_TRY (GrB_apply (rabs, NULL, NULL, GrB_ABS_FP32, r, NULL)) ;
+        GRB_TRY (GrB_select (rabs, NULL, NULL, GrB_VALUEGE_FP32, rabs,
+            threshold, NULL)) ;
+        GrB_Index nactive ;
+        GRB_TRY (GrB_Vector_nvals (&nactive, rabs)) ;
+        if (nactive == 0) break ;
+
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+
+        // rF<struct(rabs),replace> = r
+        GRB_TRY (GrB_assign (rF, rabs, NULL, r, GrB_ALL, n, GrB_DESC_RS)) ;
+        // p += rF
+        GRB_TRY (GrB_assign (p, NULL, GrB_PLUS_FP32, rF, GrB_ALL, n, NULL)) ;
+        // r<!struct(rF),replace> = r, which removes the active set
+        GRB_TRY (GrB_assign (r, rF, NULL, r, GrB_ALL, n, GrB_DESC_RSC)) ;
+        // w = rF ./ d, where sinks are dropped
+        GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, rF, d, NULL)) ;
+        // r += AT*w, for the edges out of the active set only
+        GRB_TRY (GrB_mxv (r, NULL, GrB_PLUS_FP32, LAGraph_plus_second_fp32,
+            AT, w, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // scale the result to sum to 1, which redistributes the sink rank
+    //--------------------------------------------------------------------------
+
+    float psum = 0 ;
+    GRB_TRY (GrB_reduce (&psum, NULL, GrB_PLUS_MONOID_FP32, p, NULL)) ;
+    GRB_TRY (GrB_apply (p, NULL, NULL, GrB_DIV_FP32, p, psum, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = p ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,377 @@
+//------------------------------------------------------------------------------
+// LAGr_PersonalizedPageRank: personalized PageRank, for one or many seed sets
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// Personalized PageRank replaces the uniform teleport (1-damping)/n of
+// LAGr_PageRank with (1-damping)*v, where v is a probability distribution over
+// the nodes (typically nonzero only on a small set of seed nodes).  As in
+// LAGr_PageRank, the rank held by the sinks (nodes with no outgoing edges) is
+// not lost: it is redistributed, here according to v rather than uniformly,
+// so the sum of each rank vector remains 1.
+
+// LAGr_PersonalizedPageRankBatch computes k personalized rank vectors at once,
+// one per column of the n-by-k Teleport matrix.  The iteration for the n-by-k
+// rank matrix R is:
+//
+//      alpha (c) = (1-damping) + damping * sum (R (sinks,c))
+//      R = V * diag (alpha) + ATs * R
+//
+// where V is Teleport with each column scaled to sum to 1, and ATs = AT *
+// diag (damping ./ d_out) is computed once, so each iteration takes a single
+// mxm with the graph.  The iteration starts at R = V.  Column c has converged
+// when sum (abs (R (:,c) - Rold (:,c))) <= tol, as in LAGr_PageRank.  A
+// converged column is copied into the result, and removed from R and V, so it
+// takes no further work.  LAGr_PersonalizedPageRank is the case k = 1.
+
+// If G is undirected or G->A is known to have a symmetric structure, then G->A
+// is used instead of G->AT.  G->out_degree must have no explicit zeros, as
+// computed by LAGraph_Cached_OutDegree.  The values of G->A are ignored.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&ATs) ;                               \
+    GrB_free (&V) ;                                 \
+    GrB_free (&R) ;                                 \
+    GrB_free (&Rnew) ;                              \
+    GrB_free (&Dif) ;                               \
+    GrB_free (&Dm) ;                                \
+    GrB_free (&Sub) ;                               \
+    GrB_free (&dinv) ;                              \
+    GrB_free (&sink) ;                              \
+    GrB_free (&alpha) ;                             \
+    GrB_free (&diff) ;                              \
+    LAGraph_Free ((void **) &orig, NULL) ;          \
+    LAGraph_Free ((void **) &keep, NULL) ;          \
+    LAGraph_Free ((void **) &conv, NULL) ;          \
+    LAGraph_Free ((void **) &conv_orig, NULL) ;     \
+    LAGraph_Free ((void **) &Di, NULL) ;            \
+    LAGraph_Free ((void **) &Dx, NULL) ;            \
+    LAGraph_Free ((void **) &dx, NULL) ;            \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&C) ;                                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LAGr_PersonalizedPageRankBatch: k personalized PageRank vectors
+//------------------------------------------------------------------------------
+
+int LAGr_PersonalizedPageRankBatch
+(
+    // output:
+    GrB_Matrix *centrality, // centrality(i,c): rank of node i for column c
+    int *iters,             // iters [c]: # of iterations for column c
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Matrix Teleport, // n-by-k: teleport distribution of each column
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix C = NULL, ATs = NULL, V = NULL, R = NULL, Rnew = NULL,
+        Dif = NULL, Dm = NULL, Sub = NULL ;
+    GrB_Vector dinv = NULL, sink = NULL, alpha = NULL, diff = NULL ;
+    int64_t *orig = NULL ;
+    GrB_Index *keep = NULL, *conv = NULL, *conv_orig = NULL, *Di = NULL ;
+    float *Dx = NULL, *dx = NULL ;
+
+    LG_ASSERT (centrality != NULL && iters != NULL && Teleport != NULL,
+        GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    GrB_Index n, nt, k ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nt, Teleport)) ;
+    GRB_TRY (GrB_Matrix_ncols (&k, Teleport)) ;
+    LG_ASSERT_MSG (nt == n, GrB_DIMENSION_MISMATCH,
+        "Teleport must have n rows") ;
+    LG_ASSERT_MSG (k > 0, GrB_INVALID_VALUE,
+        "Teleport must have at least one column") ;
+
+    //--------------------------------------------------------------------------
+    // V = Teleport, with each column scaled to sum to 1
+    //--------------------------------------------------------------------------
+
+    float vmin = 0 ;
+    GRB_TRY (GrB_reduce (&vmin, NULL, GrB_MIN_MONOID_FP32, Teleport, NULL)) ;
+    LG_ASSERT_MSG (vmin >= 0, GrB_INVALID_VALUE,
+        "Teleport must not be negative") ;
+
+    // alpha = sum (Teleport), the sum of each column
+    GRB_TRY (GrB_Vector_new (&alpha, GrB_FP32, k)) ;
+    GRB_TRY (GrB_reduce (alpha, NULL, NULL, GrB_PLUS_MONOID_FP32, Teleport,
+        GrB_DESC_T0)) ;
+    GrB_Index nvals ;
+    float amin = 0 ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, alpha)) ;
+    GRB_TRY (GrB_reduce (&amin, NULL, GrB_MIN_MONOID_FP32, alpha, NULL)) ;
+    LG_ASSERT_MSG (nvals == k && amin > 0, GrB_INVALID_VALUE,
+        "each column of Teleport must have a positive sum") ;
+
+    // V = Teleport * diag (1 ./ alpha)
+    GRB_TRY (GrB_apply (alpha, NULL, NULL, GrB_MINV_FP32, alpha, NULL)) ;
+    GRB_TRY (GrB_Matrix_diag (&Dm, alpha, 0)) ;
+    GRB_TRY (GrB_Matrix_new (&V, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_mxm (V, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, Teleport,
+        Dm, NULL)) ;
+    GrB_free (&Dm) ;
+
+    //--------------------------------------------------------------------------
+    // ATs = AT * diag (damping ./ d_out), and the damped sinks
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&dinv, GrB_FP32, n)) ;
+    GRB_TRY (GrB_apply (dinv, NULL, NULL, GrB_DIV_FP32, damping, d_out,
+        NULL)) ;
+    GRB_TRY (GrB_Matrix_diag (&Dm, dinv, 0)) ;
+    GRB_TRY (GrB_Matrix_new (&ATs, GrB_FP32, n, n)) ;
+    GRB_TRY (GrB_mxm (ATs, NULL, NULL, LAGraph_plus_second_fp32, AT, Dm,
+        NULL)) ;
+    GrB_free (&Dm) ;
+    GrB_free (&dinv) ;
+
+    // sink(i) = damping if node i has d_out(i)=0, or with d_out(i) not present
+    GrB_Index nsinks ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+    nsinks = n - nvals ;
+    if (nsinks > 0)
+    {
+        // sink<!struct(d_out)> = damping
+        GRB_TRY (GrB_Vector_new (&sink, GrB_FP32, n)) ;
+        GRB_TRY (GrB_assign (sink, d_out, NULL, damping, GrB_ALL, n,
+            GrB_DESC_SC)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&C, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_Matrix_dup (&R, V)) ;
+    GRB_TRY (GrB_Matrix_new (&Rnew, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_Matrix_new (&Dif, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_Vector_new (&diff, GrB_FP32, k)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &orig, k, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &keep, k, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &conv, k, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &conv_orig, k, sizeof (GrB_Index),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Di, k, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Dx, k, sizeof (float), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &dx, k, sizeof (float), msg)) ;
+    for (int64_t c = 0 ; c < (int64_t) k ; c++)
+    {
+        orig [c] = c ;
+        iters [c] = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations
+    //--------------------------------------------------------------------------
+
+    // ka: the number of columns that have not yet converged
+    GrB_Index ka = k ;
+    for (int iter = 1 ; ka > 0 ; iter++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF (iter <= itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+
+        // alpha = (1-damping) + damping * sum (R (sinks,:))
+        GRB_TRY (GrB_assign (alpha, NULL, NULL, (float) (1 - damping),
+            GrB_ALL, ka, NULL)) ;
+        if (nsinks > 0)
+        {
+            GRB_TRY (GrB_vxm (alpha, NULL, GrB_PLUS_FP32,
+                GrB_PLUS_TIMES_SEMIRING_FP32, sink, R, NULL)) ;
+        }
+
+        // Rnew = V * diag (alpha) + ATs * R
+        GRB_TRY (GrB_Matrix_diag (&Dm, alpha, 0)) ;
+        GRB_TRY (GrB_mxm (Rnew, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, V,
+            Dm, NULL)) ;
+        GrB_free (&Dm) ;
+        GRB_TRY (GrB_mxm (Rnew, NULL, GrB_PLUS_FP32,
+            GrB_PLUS_TIMES_SEMIRING_FP32, ATs, R, NULL)) ;
+
+        // diff = sum (abs (Rnew - R)), for each column
+        GRB_TRY (GrB_eWiseAdd (Dif, NULL, NULL, GrB_MINUS_FP32, Rnew, R,
+            NULL)) ;
+        GRB_TRY (GrB_apply (Dif, NULL, NULL, GrB_ABS_FP32, Dif, NULL)) ;
+        GRB_TRY (GrB_reduce (diff, NULL, NULL, GrB_PLUS_MONOID_FP32, Dif,
+            GrB_DESC_T0)) ;
+
+        // swap R and Rnew ; now R is the new rank
+        GrB_Matrix temp = R ; R = Rnew ; Rnew = temp ;
+
+        //----------------------------------------------------------------------
+        // find the columns that have converged
+        //----------------------------------------------------------------------
+
+        GrB_Index nd = ka ;
+        GRB_TRY (GrB_Vector_extractTuples (Di, Dx, &nd, diff)) ;
+        for (GrB_Index c = 0 ; c < ka ; c++)
+        {
+            dx [c] = 0 ;
+        }
+        for (GrB_Index p = 0 ; p < nd ; p++)
+        {
+            dx [Di [p]] = Dx [p] ;
+        }
+        GrB_Index nconv = 0, nkeep = 0 ;
+        for (GrB_Index c = 0 ; c < ka ; c++)
+        {
+            iters [orig [c]] = iter ;
+            if (dx [c] <= tol)
+            {
+                conv [nconv] = c ;
+                conv_orig [nconv++] = orig [c] ;
+            }
+            else
+            {
+                keep [nkeep++] = c ;
+            }
+        }
+        if (nconv == 0) continue ;
+
+        //----------------------------------------------------------------------
+        // move the converged columns to the result
+        //----------------------------------------------------------------------
+
+        // C (:, conv_orig) = R (:, conv)
+        GRB_TRY (GrB_Matrix_new (&Sub, GrB_FP32, n, nconv)) ;
+        GRB_TRY (GrB_extract (Sub, NULL, NULL, R, GrB_ALL, n, conv, nconv,
+            NULL)) ;
+        GRB_TRY (GrB_assign (C, NULL, NULL, Sub, GrB_ALL, n, conv_orig, nconv,
+            NULL)) ;
+        GrB_free (&Sub) ;
+        if (nkeep == 0) break ;
+
+        // R = R (:, keep) and V = V (:, keep)
+        GRB_TRY (GrB_Matrix_new (&Sub, GrB_FP32, n, nkeep)) ;
+        GRB_TRY (GrB_extract (Sub, NULL, NULL, R, GrB_ALL, n, keep, nkeep,
+            NULL)) ;
+        GrB_free (&R) ;
+        R = Sub ;
+        GRB_TRY (GrB_Matrix_new (&Sub, GrB_FP32, n, nkeep)) ;
+        GRB_TRY (GrB_extract (Sub, NULL, NULL, V, GrB_ALL, n, keep, nkeep,
+            NULL)) ;
+        GrB_free (&V) ;
+        V = Sub ;
+        Sub = NULL ;
+        for (GrB_Index c = 0 ; c < nkeep ; c++)
+        {
+            orig [c] = orig [keep [c]] ;
+        }
+        ka = nkeep ;
+        GRB_TRY (GrB_Matrix_resize (Rnew, n, ka)) ;
+        GRB_TRY (GrB_Matrix_resize (Dif, n, ka)) ;
+        GRB_TRY (GrB_Vector_resize (diff, ka)) ;
+        GRB_TRY (GrB_Vector_resize (alpha, ka)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = C ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_PersonalizedPageRank: a single personalized PageRank vector
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    GrB_free (&T) ;                                 \
+    GrB_free (&C) ;                                 \
+    GrB_free (&r) ;                                 \
+}
+
+int LAGr_PersonalizedPageRank
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): rank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector teleport, // teleport distribution, of size n
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    GrB_Matrix T = NULL, C = NULL ;
+    GrB_Vector r = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL && teleport != NULL,
+        GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+
+    // T = teleport, as an n-by-1 matrix
+    GrB_Index n ;
+    GRB_TRY (GrB_Vector_size (&n, teleport)) ;
+    GRB_TRY (GrB_Matrix_new (&T, GrB_FP32, n, 1)) ;
+    GRB_TRY (GrB_Col_assign (T, NULL, NULL, teleport, GrB_ALL, n, 0, NULL)) ;
+
+    // C = personalized pagerank of T
+    LG_TRY (LAGr_PersonalizedPageRankBatch (&C, iters, G, T, damping, tol,
+        itermax, msg)) ;
+
+    // r = C (:,0)
+    GRB_TRY (GrB_Vector_new (&r, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Col_extract (r, NULL, NULL, C, GrB_ALL, n, 0, NULL)) ;
+    (*centrality) = r ;
+    GrB_free (&T) ;
+    GrB_free (&C) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,209 @@
+//------------------------------------------------------------------------------
+// LAGr_PersonalizedPageRankPush: approximate personalized PageRank by push
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->out_degree is required).
+
+// LAGr_PersonalizedPageRankPush computes an approximation p to the
+// personalized PageRank of LAGr_PersonalizedPageRank, with the forward-push
+// method of Andersen, Chung, and Lang ("Local graph partitioning using
+// PageRank vectors", FOCS 2006).  Two sparse vectors are kept: the estimate p
+// and the residual r, starting with p = 0 and r = v (the teleport
+// distribution, scaled to sum to 1).  A node u is pushed if its residual is
+// large compared with its out-degree, r(u) >= epsilon * d_out(u):
+//
+//      p(u) += (1-damping) * r(u)
+//      r(v) += damping * r(u) / d_out(u), for each edge (u,v)
+//      r(u) = 0
+//
+// All such nodes are pushed at once in each round: the round is a single
+// GrB_vxm of the frontier with G->A, so only the edges out of the frontier
+// are touched.  A sink u (with no outgoing edges) is pushed if r(u) >=
+// epsilon, and its damped residual is returned to the teleport distribution,
+// as in LAGr_PersonalizedPageRank.  The method stops when no node can be
+// pushed.  The total mass pushed is at most 1, and each push of u moves at
+// least epsilon * d_out(u) of it, so the total work is O(1/(epsilon *
+// (1-damping))), independent of n, and p and r stay sparse.
+
+// On output, p + PPR(r) is the exact personalized PageRank, where PPR(r) is the
+// personalized PageRank of the residual.  Each p(u) is an underestimate, and
+// sum(p) = 1 - sum(r).  The values of G->A are ignored.  The vectors are
+// GrB_FP64, since residuals are small compared with the ranks.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&v) ;                 \
+    GrB_free (&w) ;                 \
+    GrB_free (&wF) ;                \
+    GrB_free (&rF) ;                \
+    GrB_free (&rs) ;                \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&p) ;                 \
+    GrB_free (&r) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_PersonalizedPageRankPush
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): approximate rank of node i
+    GrB_Vector *residual,   // residual(i): mass not yet pushed (may be NULL)
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector teleport, // teleport distribution, of size n
+    float damping,          // damping factor (typically 0.85)
+    double epsilon,         // push threshold (typically 1e-6)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector p = NULL, r = NULL, v = NULL, w = NULL, wF = NULL, rF = NULL,
+        rs = NULL ;
+    LG_ASSERT (centrality != NULL && teleport != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    if (residual != NULL) (*residual) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+    LG_ASSERT_MSG (epsilon > 0, GrB_INVALID_VALUE, "epsilon must be > 0") ;
+    LG_ASSERT_MSG (damping >= 0 && damping < 1, GrB_INVALID_VALUE,
+        "damping must be in the range [0,1)") ;
+
+    GrB_Index n, nv ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Vector_size (&nv, teleport)) ;
+    LG_ASSERT_MSG (nv == n, GrB_DIMENSION_MISMATCH,
+        "teleport must have size n") ;
+
+    //--------------------------------------------------------------------------
+    // v = teleport / sum (teleport)
+    //--------------------------------------------------------------------------
+
+    double vmin = 0, vsum = 0 ;
+    GRB_TRY (GrB_reduce (&vmin, NULL, GrB_MIN_MONOID_FP64, teleport, NULL)) ;
+    GRB_TRY (GrB_reduce (&vsum, NULL, GrB_PLUS_MONOID_FP64, teleport, NULL)) ;
+    LG_ASSERT_MSG (vmin >= 0 && vsum > 0, GrB_INVALID_VALUE,
+        "teleport must not be negative, and must have a positive sum") ;
+    GRB_TRY (GrB_Vector_new (&v, GrB_FP64, n)) ;
+    GRB_TRY (GrB_apply (v, NULL, NULL, GrB_DIV_FP64, teleport, vsum, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // p = 0 and r = v, both sparse
+    GRB_TRY (GrB_Vector_new (&p, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_dup (&r, v)) ;
+    GRB_TRY (GrB_Vector_new (&w, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&wF, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&rF, GrB_FP64, n)) ;
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+    bool has_sinks = (nvals < n) ;
+    if (has_sinks)
+    {
+        GRB_TRY (GrB_Vector_new (&rs, GrB_FP64, n)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // push until no node has a large residual
+    //--------------------------------------------------------------------------
+
+    while (true)
+    {
+
+        //----------------------------------------------------------------------
+        // find the frontier
+        //----------------------------------------------------------------------
+
+        // w = r ./ d_out, for nodes with outgoing edges
+        GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP64, r, d_out, NULL)) ;
+        // wF = the entries of w >= epsilon: the frontier, with r(u)/d_out(u)
+        GRB_TRY (GrB_select (wF, NULL, NULL, GrB_VALUEGE_FP64, w, epsilon,
+            NULL)) ;
+        GrB_Index nfrontier, nsinks = 0 ;
+        GRB_TRY (GrB_Vector_nvals (&nfrontier, wF)) ;
+        if (has_sinks)
+        {
+            // rs<!struct(d_out),replace> = r, then keep entries >= epsilon
+            GRB_TRY (GrB_assign (rs, d_out, NULL, r, GrB_ALL, n,
+                GrB_DESC_RSC)) ;
+            GRB_TRY (GrB_select (rs, NULL, NULL, GrB_VALUEGE_FP64, rs,
+                epsilon, NULL)) ;
+            GRB_TRY (GrB_Vector_nvals (&nsinks, rs)) ;
+        }
+        if (nfrontier == 0 && nsinks == 0) break ;
+
+        //----------------------------------------------------------------------
+        // push the frontier
+        //----------------------------------------------------------------------
+
+        // rF<struct(wF),replace> = r, the residuals of the frontier
+        GRB_TRY (GrB_assign (rF, wF, NULL, r, GrB_ALL, n, GrB_DESC_RS)) ;
+        if (nsinks > 0)
+        {
+            GRB_TRY (GrB_eWiseAdd (rF, NULL, NULL, GrB_PLUS_FP64, rF, rs,
+                NULL)) ;
+        }
+
+        // p += (1-damping) * rF
+        GRB_TRY (GrB_apply (p, NULL, GrB_PLUS_FP64, GrB_TIMES_FP64, rF,
+            (double) (1 - damping), NULL)) ;
+
+        // r<!struct(rF),replace> = r, which deletes the frontier from r
+        GRB_TRY (GrB_assign (r, rF, NULL, r, GrB_ALL, n, GrB_DESC_RSC)) ;
+
+        // r += damping * wF'*A
+        GRB_TRY (GrB_apply (wF, NULL, NULL, GrB_TIMES_FP64, wF,
+            (double) damping, NULL)) ;
+        GRB_TRY (GrB_vxm (r, NULL, GrB_PLUS_FP64, LAGraph_plus_first_fp64,
+            wF, G->A, NULL)) ;
+
+        // r += damping * sum (rs) * v, returning the sink residuals
+        if (nsinks > 0)
+        {
+            double ssum = 0 ;
+            GRB_TRY (GrB_reduce (&ssum, NULL, GrB_PLUS_MONOID_FP64, rs,
+                NULL)) ;
+            GRB_TRY (GrB_apply (r, NULL, GrB_PLUS_FP64, GrB_TIMES_FP64, v,
+                damping * ssum, NULL)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = p ;
+    if (residual != NULL)
+    {
+        (*residual) = r ;
+        r = NULL ;
+    }
+    LG_FREE_WORK ;
+    GrB_free (&r) ;
+    return (GrB_SUCCESS) ;
+}
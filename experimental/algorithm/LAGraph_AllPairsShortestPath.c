@@ -0,0 +1,397 @@
+//------------------------------------------------------------------------------
+// LAGraph_AllPairsShortestPath: all-pairs shortest paths
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_AllPairsShortestPath computes D(i,j), the length of the shortest
+// path from vertex i to vertex j, for all i and j.  D(i,i) is zero, and D(i,j)
+// is not present if j is not reachable from i.  D is GrB_FP64, for any real
+// type of G->A.  Edge weights may be negative; if the graph has a negative-
+// weight cycle, GrB_NO_VALUE is returned and D is NULL, as in LAGr_BellmanFord.
+
+// Two methods are available:
+//
+// (1) Floyd-Warshall (LAGraph_APSP_FLOYD_WARSHALL), on a dense n-by-n array,
+//      blocked for cache reuse (G. Venkataraman, S. Sahni, S. Mukhopadhyaya,
+//      "A blocked all-pairs shortest-paths algorithm", J. Exp. Algorithmics,
+//      8, 2003).  For each diagonal block kb, the kb-th block is updated
+//      first, then the blocks in the kb-th block row and column (in
+//      parallel), then all other blocks (in parallel).  The innermost loop
+//      is a contiguous min-plus update of one row of a block, which the
+//      compiler can vectorize.  This takes O(n^3) time and O(n^2) memory
+//      regardless of the sparsity of the graph.
+//
+// (2) Repeated squaring (LAGraph_APSP_SQUARING): D = A with a zero diagonal,
+//      then D = D min.+ D until D does not change.  After k steps, D holds the
+//      shortest paths of up to 2^k edges, so at most ceil(log2(n)) steps are
+//      needed.  Each step is a single sparse GrB_mxm, so this method is fast
+//      when D remains sparse (a graph with many small components, or a
+//      directed graph with limited reachability).
+//
+// LAGraph_APSP_AUTO uses Floyd-Warshall if the graph is already dense (at
+// least n^2/LG_APSP_DENSE entries) or small (n <= LG_APSP_SMALL).  Otherwise
+// it starts with repeated squaring, and switches to Floyd-Warshall (starting
+// from the current D) once D has at least n^2/LG_APSP_DENSE entries, since
+// each further squaring would then cost as much as all of Floyd-Warshall.
+
+// memory_limit is a bound on the workspace, in bytes (0 for no limit).
+// Floyd-Warshall needs about 4*n^2*sizeof(double) bytes (the dense array,
+// plus the import and the final GrB_select).  For repeated squaring, the
+// number of entries in D min.+ D is bounded before each step, by summing the
+// flop counts of each row (capped at n), and the step needs about 16 bytes
+// per entry of D and of the result, times 2 for workspace.  If a step (or
+// Floyd-Warshall) would exceed the limit, GrB_OUT_OF_MEMORY is returned
+// before the workspace is allocated.
+
+#define LG_FREE_WORK                            \
+{                                               \
+    GrB_free (&D2) ;                            \
+    GrB_free (&Z) ;                             \
+    GrB_free (&r) ;                             \
+    GrB_free (&w) ;                             \
+    GrB_free (&x) ;                             \
+    GrB_free (&z) ;                             \
+    GrB_free (&Ddiag) ;                         \
+    LAGraph_Free ((void **) &Dx, NULL) ;        \
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &J, NULL) ;         \
+    LAGraph_Free ((void **) &X, NULL) ;         \
+}
+
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+    GrB_free (&Dfull) ;                         \
+    GrB_free (D) ;                              \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// use Floyd-Warshall once D has at least n^2/LG_APSP_DENSE entries
+#define LG_APSP_DENSE 4
+
+// always use Floyd-Warshall if n <= LG_APSP_SMALL
+#define LG_APSP_SMALL 256
+
+// Floyd-Warshall block size: a 64-by-64 block of doubles is 32KB
+#define LG_APSP_BLOCK 64
+
+//------------------------------------------------------------------------------
+// fw_update: D(i1:i2-1,j1:j2-1) = min (D(i,j), D(i,k) + D(k,j)), for k1:k2-1
+//------------------------------------------------------------------------------
+
+// The block updated, the block holding D(i,k), and the block holding D(k,j)
+// may be the same, as in the unblocked Floyd-Warshall method, which remains
+// correct since k is the outer loop.
+
+static void fw_update
+(
+    double *Dx,             // n-by-n dense matrix, in row-major form
+    int64_t n,
+    int64_t i1, int64_t i2, // rows to update
+    int64_t j1, int64_t j2, // columns to update
+    int64_t k1, int64_t k2  // intermediate vertices to consider
+)
+{
+    for (int64_t k = k1 ; k < k2 ; k++)
+    {
+        const double *Dk = Dx + k*n ;
+        for (int64_t i = i1 ; i < i2 ; i++)
+        {
+            double *Di = Dx + i*n ;
+            double dik = Di [k] ;
+            if (dik == INFINITY) continue ;
+            for (int64_t j = j1 ; j < j2 ; j++)
+            {
+                double t = dik + Dk [j] ;
+                Di [j] = (t < Di [j]) ? t : Di [j] ;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// fw_blocked: blocked Floyd-Warshall on a dense matrix
+//------------------------------------------------------------------------------
+
+static void fw_blocked
+(
+    double *Dx,             // n-by-n dense matrix, in row-major form
+    int64_t n,
+    int nthreads
+)
+{
+    int64_t bs = LG_APSP_BLOCK ;
+    int64_t nb = (n + bs - 1) / bs ;    // # of blocks in each dimension
+
+    for (int64_t kb = 0 ; kb < nb ; kb++)
+    {
+        int64_t k1 = kb * bs ;
+        int64_t k2 = LAGRAPH_MIN (k1 + bs, n) ;
+
+        // phase 1: the diagonal block (kb,kb)
+        fw_update (Dx, n, k1, k2, k1, k2, k1, k2) ;
+
+        // phase 2: the blocks in block row kb and block column kb
+        int64_t b ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (b = 0 ; b < 2*nb ; b++)
+        {
+            int64_t jb = b % nb ;
+            if (jb == kb) continue ;
+            int64_t j1 = jb * bs ;
+            int64_t j2 = LAGRAPH_MIN (j1 + bs, n) ;
+            if (b < nb)
+            {
+                // block (kb,jb)
+                fw_update (Dx, n, k1, k2, j1, j2, k1, k2) ;
+            }
+            else
+            {
+                // block (jb,kb)
+                fw_update (Dx, n, j1, j2, k1, k2, k1, k2) ;
+            }
+        }
+
+        // phase 3: all other blocks
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (b = 0 ; b < nb*nb ; b++)
+        {
+            int64_t ib = b / nb ;
+            int64_t jb = b % nb ;
+            if (ib == kb || jb == kb) continue ;
+            int64_t i1 = ib * bs ;
+            int64_t i2 = LAGRAPH_MIN (i1 + bs, n) ;
+            int64_t j1 = jb * bs ;
+            int64_t j2 = LAGRAPH_MIN (j1 + bs, n) ;
+            fw_update (Dx, n, i1, i2, j1, j2, k1, k2) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_AllPairsShortestPath
+//------------------------------------------------------------------------------
+
+int LAGraph_AllPairsShortestPath
+(
+    // output:
+    GrB_Matrix *D,              // D(i,j) is the length of the shortest path
+                                // from i to j; not present if unreachable
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    LAGraph_APSP_Method method, // method to use
+    size_t memory_limit,        // workspace limit in bytes (0: no limit)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix D2 = NULL, Z = NULL, Dfull = NULL, Ddiag = NULL ;
+    GrB_Vector r = NULL, w = NULL, x = NULL, z = NULL ;
+    double *Dx = NULL, *X = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+
+    LG_ASSERT (D != NULL, GrB_NULL_POINTER) ;
+    (*D) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (method == LAGraph_APSP_AUTO ||
+        method == LAGraph_APSP_FLOYD_WARSHALL ||
+        method == LAGraph_APSP_SQUARING, GrB_INVALID_VALUE,
+        "invalid method") ;
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    double limit = (memory_limit == 0) ? INFINITY : ((double) memory_limit) ;
+    double nsquared = ((double) n) * ((double) n) ;
+    double fw_bytes = 4 * nsquared * sizeof (double) ;
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+
+    //--------------------------------------------------------------------------
+    // D = A with a zero diagonal, as GrB_FP64
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (D, GrB_FP64, n, n)) ;
+    GRB_TRY (GrB_assign (*D, NULL, NULL, G->A, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_Vector_new (&z, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (z, NULL, NULL, (double) 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_Matrix_diag (&Z, z, 0)) ;
+    GRB_TRY (GrB_eWiseAdd (*D, NULL, NULL, GrB_MIN_FP64, *D, Z, NULL)) ;
+    GrB_free (&Z) ;
+    GrB_free (&z) ;
+
+    //--------------------------------------------------------------------------
+    // select the method
+    //--------------------------------------------------------------------------
+
+    bool use_fw ;
+    if (method == LAGraph_APSP_AUTO)
+    {
+        use_fw = (n <= LG_APSP_SMALL || nvals >= nsquared / LG_APSP_DENSE)
+            && (fw_bytes <= limit) ;
+    }
+    else
+    {
+        use_fw = (method == LAGraph_APSP_FLOYD_WARSHALL) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // repeated squaring
+    //--------------------------------------------------------------------------
+
+    bool negative_cycle = false ;
+    if (!use_fw)
+    {
+        GRB_TRY (GrB_Vector_new (&x, GrB_INT64, n)) ;
+        GRB_TRY (GrB_assign (x, NULL, NULL, (int64_t) 0, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_Vector_new (&r, GrB_INT64, n)) ;
+        GRB_TRY (GrB_Vector_new (&w, GrB_INT64, n)) ;
+        GRB_TRY (GrB_Matrix_new (&D2, GrB_FP64, n, n)) ;
+
+        // D holds the shortest paths of up to 'paths' edges
+        for (GrB_Index paths = 1 ; ; paths *= 2)
+        {
+            GrB_Index dnvals ;
+            GRB_TRY (GrB_Matrix_nvals (&dnvals, *D)) ;
+            if (method == LAGraph_APSP_AUTO &&
+                dnvals >= nsquared / LG_APSP_DENSE && fw_bytes <= limit)
+            {
+                // D is now dense; finish with Floyd-Warshall
+                use_fw = true ;
+                break ;
+            }
+
+            // bound the # of entries in D min.+ D: r(k) = nvals (D(k,:)),
+            // w(i) = min (n, sum (r (D(i,:)))), the flop count of row i
+            GRB_TRY (GrB_mxv (r, NULL, NULL, LAGraph_plus_one_int64, *D, x,
+                NULL)) ;
+            GRB_TRY (GrB_mxv (w, NULL, NULL, LAGraph_plus_second_int64, *D, r,
+                NULL)) ;
+            GRB_TRY (GrB_apply (w, NULL, NULL, GrB_MIN_INT64, w, (int64_t) n,
+                NULL)) ;
+            int64_t cnvals = 0 ;
+            GRB_TRY (GrB_reduce (&cnvals, NULL, GrB_PLUS_MONOID_INT64, w,
+                NULL)) ;
+            double step_bytes = 2 * 16 * ((double) dnvals + (double) cnvals) ;
+            LG_ASSERT_MSGF (step_bytes <= limit, GrB_OUT_OF_MEMORY,
+                "memory limit exceeded (%g bytes needed)", step_bytes) ;
+
+            // D2 = D min.+ D
+            bool converged = false ;
+            GRB_TRY (GrB_mxm (D2, NULL, NULL, GrB_MIN_PLUS_SEMIRING_FP64, *D,
+                *D, NULL)) ;
+            LG_TRY (LAGraph_Matrix_IsEqual (&converged, D2, *D, msg)) ;
+            GrB_Matrix T = *D ; (*D) = D2 ; D2 = T ;
+            if (converged) break ;
+            if (paths >= n - 1)
+            {
+                // D held all shortest simple paths, yet still changed
+                negative_cycle = true ;
+                break ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Floyd-Warshall
+    //--------------------------------------------------------------------------
+
+    if (use_fw && !negative_cycle)
+    {
+        LG_ASSERT_MSGF (fw_bytes <= limit, GrB_OUT_OF_MEMORY,
+            "memory limit exceeded (%g bytes needed)", fw_bytes) ;
+
+        // scatter D into the dense array Dx, with infinity for no entry
+        GrB_Index dnvals ;
+        GRB_TRY (GrB_Matrix_nvals (&dnvals, *D)) ;
+        GrB_Index nn ;
+        LG_ASSERT_MSG (LG_Multiply_size_t (&nn, n, n), GrB_OUT_OF_MEMORY,
+            "problem too large") ;
+        LG_TRY (LAGraph_Malloc ((void **) &Dx, nn, sizeof (double), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &I, dnvals, sizeof (GrB_Index),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &J, dnvals, sizeof (GrB_Index),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &X, dnvals, sizeof (double), msg)) ;
+        GRB_TRY (GrB_Matrix_extractTuples (I, J, X, &dnvals, *D)) ;
+        GrB_free (D) ;
+
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < nn ; p++)
+        {
+            Dx [p] = INFINITY ;
+        }
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < dnvals ; p++)
+        {
+            Dx [I [p] * n + J [p]] = X [p] ;
+        }
+        LAGraph_Free ((void **) &I, NULL) ;
+        LAGraph_Free ((void **) &J, NULL) ;
+        LAGraph_Free ((void **) &X, NULL) ;
+
+        fw_blocked (Dx, n, nthreads) ;
+
+        // check for a negative-weight cycle
+        for (int64_t i = 0 ; i < n && !negative_cycle ; i++)
+        {
+            negative_cycle = (Dx [i*n+i] < 0) ;
+        }
+
+        if (!negative_cycle)
+        {
+            // D = the finite entries of Dx
+            GRB_TRY (GrB_Matrix_import (&Dfull, GrB_FP64, n, n, NULL, NULL,
+                Dx, 0, 0, nn, GrB_DENSE_ROW_FORMAT)) ;
+            LAGraph_Free ((void **) &Dx, NULL) ;
+            GRB_TRY (GrB_Matrix_new (D, GrB_FP64, n, n)) ;
+            GRB_TRY (GrB_select (*D, NULL, NULL, GrB_VALUELT_FP64, Dfull,
+                (double) INFINITY, NULL)) ;
+            GrB_free (&Dfull) ;
+        }
+    }
+    else if (!negative_cycle)
+    {
+        // repeated squaring converged; check the diagonal
+        GRB_TRY (GrB_Matrix_new (&Ddiag, GrB_FP64, n, n)) ;
+        GRB_TRY (GrB_select (Ddiag, NULL, NULL, GrB_DIAG, *D, 0, NULL)) ;
+        GRB_TRY (GrB_select (Ddiag, NULL, NULL, GrB_VALUELT_FP64, Ddiag,
+            (double) 0, NULL)) ;
+        GrB_Index ndiag ;
+        GRB_TRY (GrB_Matrix_nvals (&ndiag, Ddiag)) ;
+        negative_cycle = (ndiag > 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (negative_cycle)
+    {
+        LG_FREE_ALL ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+// LAGraph_DeltaSplit: light/heavy edge split for delta-stepping SSSP
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_DeltaSplit_New constructs AL = A .* (A <= Delta) and AH = A .* (A >
+// Delta), which LAGr_SingleSourceShortestPath otherwise builds on each call.
+// LAGraph_DeltaSplit_Free frees the split.
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LAGraph_DeltaSplit_Free (&S, NULL) ;            \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LAGraph_DeltaSplit_Free: free a light/heavy split
+//------------------------------------------------------------------------------
+
+int LAGraph_DeltaSplit_Free
+(
+    // input/output:
+    LAGraph_DeltaSplit *Split,  // split to free
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (Split != NULL && (*Split) != NULL)
+    {
+        LAGraph_DeltaSplit S = (*Split) ;
+        GrB_free (&(S->Delta)) ;
+        GrB_free (&(S->AL)) ;
+        GrB_free (&(S->AH)) ;
+        LAGraph_Free ((void **) Split, NULL) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_DeltaSplit_New: construct a light/heavy split
+//------------------------------------------------------------------------------
+
+int LAGraph_DeltaSplit_New
+(
+    // output:
+    LAGraph_DeltaSplit *Split,  // the light/heavy split of G->A
+    // input:
+    const LAGraph_Graph G,      // graph to split, not modified
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LAGraph_DeltaSplit S = NULL ;
+    LG_ASSERT (Split != NULL && Delta != NULL, GrB_NULL_POINTER) ;
+    (*Split) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+
+    // get the type of the A matrix, and the select operators
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+
+    GrB_IndexUnaryOp le, gt ;
+    if (etype == GrB_INT32)
+    {
+        le = GrB_VALUELE_INT32 ;
+        gt = GrB_VALUEGT_INT32 ;
+    }
+    else if (etype == GrB_INT64)
+    {
+        le = GrB_VALUELE_INT64 ;
+        gt = GrB_VALUEGT_INT64 ;
+    }
+    else if (etype == GrB_UINT32)
+    {
+        le = GrB_VALUELE_UINT32 ;
+        gt = GrB_VALUEGT_UINT32 ;
+    }
+    else if (etype == GrB_UINT64)
+    {
+        le = GrB_VALUELE_UINT64 ;
+        gt = GrB_VALUEGT_UINT64 ;
+    }
+    else if (etype == GrB_FP32)
+    {
+        le = GrB_VALUELE_FP32 ;
+        gt = GrB_VALUEGT_FP32 ;
+    }
+    else if (etype == GrB_FP64)
+    {
+        le = GrB_VALUELE_FP64 ;
+        gt = GrB_VALUEGT_FP64 ;
+    }
+    else
+    {
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the split
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Calloc ((void **) &S, 1, sizeof (LAGraph_DeltaSplit_struct),
+        msg)) ;
+    GRB_TRY (GrB_Scalar_dup (&(S->Delta), Delta)) ;
+
+    //--------------------------------------------------------------------------
+    // AL = A .* (A <= Delta) and AH = A .* (A > Delta)
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&(S->AL), etype, n, n)) ;
+    GRB_TRY (GrB_select (S->AL, NULL, NULL, le, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (S->AL, GrB_MATERIALIZE)) ;
+
+    GRB_TRY (GrB_Matrix_new (&(S->AH), etype, n, n)) ;
+    GRB_TRY (GrB_select (S->AH, NULL, NULL, gt, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (S->AH, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*Split) = S ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,291 @@
+//------------------------------------------------------------------------------
+// LAGraph_DistanceOracle: landmark-based distance oracle
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_DistanceOracleBuild selects k landmark vertices and computes the
+// k-by-n matrix of shortest path lengths from the landmarks to all vertices,
+// with LAGr_MultiSourceShortestPath.  If G is directed, the lengths from all
+// vertices to the landmarks are found the same way, on the transpose of G->A.
+// The two k-by-n matrices are then scattered into dense n-by-k arrays, so that
+// LAGraph_DistanceOracleQuery can read the k distances of a vertex from a
+// single contiguous row.  LAGraph_DistanceOracle_Free frees the oracle.
+
+// Landmarks are selected in one of two ways:
+//
+// LAGraph_LANDMARKS_DEGREE: the k vertices of highest out-degree.  These hubs
+//      lie on many shortest paths, which makes the upper bounds tight.
+//
+// LAGraph_LANDMARKS_SAMPLE: k distinct random vertices whose out-degree is at
+//      least the median degree, as estimated by LAGr_SampleDegree.  Random
+//      landmarks spread out across the graph, which makes the lower bounds
+//      (and thus the A* search of LAGraph_DistanceOracleShortestPath) tighter,
+//      and the degree test avoids wasting landmarks on leaves.  If too few
+//      such vertices are found, the rest are chosen from any vertex.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&W) ;                                 \
+    GrB_free (&D) ;                                 \
+    GrB_free (&Delta) ;                             \
+    LAGraph_DeltaSplit_Free (&Split, NULL) ;        \
+    LAGraph_Delete (&Gw, NULL) ;                    \
+    LAGraph_Free ((void **) &P, NULL) ;             \
+    LAGraph_Free ((void **) &chosen, NULL) ;        \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &J, NULL) ;             \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    LAGraph_DistanceOracle_Free (&O, NULL) ;        \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LAGraph_DistanceOracle_Free: free a distance oracle
+//------------------------------------------------------------------------------
+
+int LAGraph_DistanceOracle_Free
+(
+    // input/output:
+    LAGraph_DistanceOracle *Oracle, // oracle to free
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (Oracle != NULL && (*Oracle) != NULL)
+    {
+        LAGraph_DistanceOracle O = (*Oracle) ;
+        if (O->dist_to != O->dist_from)
+        {
+            LAGraph_Free ((void **) &(O->dist_to), NULL) ;
+        }
+        LAGraph_Free ((void **) &(O->dist_from), NULL) ;
+        LAGraph_Free ((void **) &(O->landmarks), NULL) ;
+        LAGraph_Free ((void **) Oracle, NULL) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_DistanceOracleBuild: construct a distance oracle
+//------------------------------------------------------------------------------
+
+int LAGraph_DistanceOracleBuild
+(
+    // output:
+    LAGraph_DistanceOracle *Oracle, // the new distance oracle
+    // input/output:
+    LAGraph_Graph G,                // input graph; G->out_degree computed
+    // input:
+    int64_t k,                      // number of landmarks
+    LAGraph_Landmark_Method method, // how to select the landmarks
+    bool weighted,                  // if false, all edges have length 1
+    uint64_t seed,                  // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LAGraph_DistanceOracle O = NULL ;
+    LAGraph_Graph Gw = NULL ;
+    LAGraph_DeltaSplit Split = NULL ;
+    GrB_Matrix W = NULL, D = NULL ;
+    GrB_Scalar Delta = NULL ;
+    int64_t *P = NULL ;
+    bool *chosen = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+
+    LG_ASSERT (Oracle != NULL, GrB_NULL_POINTER) ;
+    (*Oracle) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (method == LAGraph_LANDMARKS_DEGREE ||
+        method == LAGraph_LANDMARKS_SAMPLE, GrB_INVALID_VALUE,
+        "invalid method") ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_ASSERT_MSG (k >= 1 && k <= (int64_t) n, GrB_INVALID_VALUE,
+        "k must be in the range 1 to n") ;
+    GrB_Index nk ;
+    LG_ASSERT_MSG (LG_Multiply_size_t (&nk, n, (size_t) k), GrB_OUT_OF_MEMORY,
+        "problem too large") ;
+    bool symmetric = (G->kind == LAGraph_ADJACENCY_UNDIRECTED) ;
+
+    //--------------------------------------------------------------------------
+    // W = the edge lengths, as GrB_FP64, or all 1 (GrB_INT32) if unweighted
+    //--------------------------------------------------------------------------
+
+    if (weighted)
+    {
+        GRB_TRY (GrB_Matrix_new (&W, GrB_FP64, n, n)) ;
+        GRB_TRY (GrB_apply (W, NULL, NULL, GrB_IDENTITY_FP64, G->A, NULL)) ;
+        double emin = INFINITY ;
+        GRB_TRY (GrB_reduce (&emin, NULL, GrB_MIN_MONOID_FP64, W, NULL)) ;
+        LG_ASSERT_MSG (emin >= 0, GrB_INVALID_VALUE,
+            "edge weights must not be negative") ;
+    }
+    else
+    {
+        GRB_TRY (GrB_Matrix_new (&W, GrB_INT32, n, n)) ;
+        GRB_TRY (GrB_apply (W, NULL, NULL, GrB_ONEB_INT32, G->A, (int32_t) 1,
+            NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the oracle
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Calloc ((void **) &O, 1,
+        sizeof (LAGraph_DistanceOracle_struct), msg)) ;
+    O->k = k ;
+    O->n = n ;
+    O->weighted = weighted ;
+    LG_TRY (LAGraph_Malloc ((void **) &(O->landmarks), k, sizeof (GrB_Index),
+        msg)) ;
+
+    //--------------------------------------------------------------------------
+    // select the landmarks
+    //--------------------------------------------------------------------------
+
+    if (G->out_degree == NULL)
+    {
+        LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    }
+
+    if (method == LAGraph_LANDMARKS_DEGREE)
+    {
+        // the k vertices of highest out-degree
+        LG_TRY (LAGr_SortByDegree (&P, G, true, false, msg)) ;
+        for (int64_t t = 0 ; t < k ; t++)
+        {
+            O->landmarks [t] = (GrB_Index) P [t] ;
+        }
+    }
+    else
+    {
+        // k random vertices with out-degree >= the sampled median
+        double mean, median ;
+        int64_t nsamples = LAGRAPH_MAX (64, k) ;
+        LG_TRY (LAGr_SampleDegree (&mean, &median, G, true, nsamples, seed,
+            msg)) ;
+        LG_TRY (LAGraph_Calloc ((void **) &chosen, n, sizeof (bool), msg)) ;
+        int64_t t = 0 ;
+        for (int64_t trial = 0 ; t < k && trial < 16*k ; trial++)
+        {
+            GrB_Index i = LG_Random60 (&seed) % n ;
+            if (chosen [i]) continue ;
+            int64_t degree = 0 ;
+            GRB_TRY (GrB_Vector_extractElement (&degree, G->out_degree, i)) ;
+            if (degree < median) continue ;
+            chosen [i] = true ;
+            O->landmarks [t++] = i ;
+        }
+        // fill in any remaining landmarks, starting at a random vertex
+        GrB_Index i = LG_Random60 (&seed) % n ;
+        for ( ; t < k ; i = (i + 1) % n)
+        {
+            if (chosen [i]) continue ;
+            chosen [i] = true ;
+            O->landmarks [t++] = i ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the distances from (and to) the landmarks
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, nk, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, nk, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, nk, sizeof (double), msg)) ;
+
+    for (int pass = 0 ; pass < (symmetric ? 1 : 2) ; pass++)
+    {
+        // Gw = W on the first pass, and W' on the second
+        if (pass == 1)
+        {
+            GRB_TRY (GrB_Matrix_new (&W, (weighted ? GrB_FP64 : GrB_INT32),
+                n, n)) ;
+            GRB_TRY (GrB_transpose (W, NULL, NULL, Gw->A, NULL)) ;
+            LAGraph_DeltaSplit_Free (&Split, NULL) ;
+            LG_TRY (LAGraph_Delete (&Gw, msg)) ;
+        }
+        LG_TRY (LAGraph_New (&Gw, &W, G->kind, msg)) ;
+
+        // D(t,:) = distances from landmarks [t] to all vertices, in Gw
+        if (Delta == NULL)
+        {
+            LG_TRY (LAGraph_SSSP_AutoDelta (&Delta, Gw, msg)) ;
+        }
+        LG_TRY (LAGraph_DeltaSplit_New (&Split, Gw, Delta, msg)) ;
+        LG_TRY (LAGr_MultiSourceShortestPath (&D, Gw, O->landmarks, k, Split,
+            msg)) ;
+
+        // dist (j,t) = D (t,j), with INFINITY for unreachable vertices
+        double *dist = NULL ;
+        LG_TRY (LAGraph_Malloc ((void **) &dist, nk, sizeof (double), msg)) ;
+        if (pass == 0)
+        {
+            O->dist_from = dist ;
+        }
+        else
+        {
+            O->dist_to = dist ;
+        }
+        GrB_Index nvals = nk ;
+        GRB_TRY (GrB_Matrix_extractTuples (I, J, X, &nvals, D)) ;
+        GrB_free (&D) ;
+
+        int nthreads, nthreads_outer, nthreads_inner ;
+        LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner,
+            msg)) ;
+        nthreads = nthreads_outer * nthreads_inner ;
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < (int64_t) nk ; p++)
+        {
+            dist [p] = INFINITY ;
+        }
+        // D is full; unreachable vertices have the largest value of its type,
+        // and are left as INFINITY in dist
+        double unreachable = weighted ? INFINITY : (double) INT32_MAX ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < (int64_t) nvals ; p++)
+        {
+            if (X [p] < unreachable) dist [J [p] * k + I [p]] = X [p] ;
+        }
+    }
+
+    if (symmetric)
+    {
+        O->dist_to = O->dist_from ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*Oracle) = O ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+// LAGraph_DistanceOracleQuery: distance bounds and A* search with an oracle
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_DistanceOracleQuery returns lower and upper bounds on d(u,v) from
+// the triangle inequality through each landmark, in O(k) time.
+
+// LAGraph_DistanceOracleShortestPath finds the exact d(u,v) with an A* search
+// (the ALT method of Goldberg and Harrelson), where the heuristic h(x) is the
+// lower bound on d(x,v) from the oracle.  This heuristic is consistent, so
+// each vertex is finalized the first time it is removed from the heap, as in
+// Dijkstra's method.  A vertex x with h(x) = INFINITY cannot reach v and is
+// never placed in the heap.  The search is inherently sequential; the row of
+// G->A for each vertex is obtained with GrB_Col_extract.  The heap uses lazy
+// deletion: a vertex may appear more than once, and stale entries are skipped
+// when they are removed.
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// oracle_bounds: lower and upper bounds on d(u,v)
+//------------------------------------------------------------------------------
+
+static inline void oracle_bounds
+(
+    double *lower,
+    double *upper,
+    const LAGraph_DistanceOracle O,
+    GrB_Index u,
+    GrB_Index v
+)
+{
+    int64_t k = O->k ;
+    const double *from_u = O->dist_from + u * k ;
+    const double *from_v = O->dist_from + v * k ;
+    const double *to_u   = O->dist_to   + u * k ;
+    const double *to_v   = O->dist_to   + v * k ;
+    double lo = 0, hi = INFINITY ;
+    for (int64_t t = 0 ; t < k ; t++)
+    {
+        // d(u,v) <= d(u,t) + d(t,v)
+        double a = to_u [t] + from_v [t] ;
+        hi = (a < hi) ? a : hi ;
+        // d(u,v) >= d(t,v) - d(t,u) and d(u,v) >= d(u,t) - d(v,t); if both
+        // terms are INFINITY the difference is NaN, and is ignored
+        double b = from_v [t] - from_u [t] ;
+        double c = to_u [t] - to_v [t] ;
+        lo = (b > lo) ? b : lo ;
+        lo = (c > lo) ? c : lo ;
+    }
+    if (u == v)
+    {
+        lo = 0 ;
+        hi = 0 ;
+    }
+    (*lower) = lo ;
+    (*upper) = hi ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_DistanceOracleQuery
+//------------------------------------------------------------------------------
+
+int LAGraph_DistanceOracleQuery
+(
+    // output:
+    double *lower,                  // lower bound on d(u,v)
+    double *upper,                  // upper bound on d(u,v)
+    // input:
+    const LAGraph_DistanceOracle Oracle,
+    GrB_Index u,                    // source vertex
+    GrB_Index v,                    // destination vertex
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (lower != NULL && upper != NULL && Oracle != NULL,
+        GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (u < Oracle->n && v < Oracle->n, GrB_INVALID_INDEX,
+        "invalid vertex") ;
+    oracle_bounds (lower, upper, Oracle, u, v) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_DistanceOracleShortestPath: A* search from u to v
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#undef  LG_FREE_ALL
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&w) ;                                 \
+    LAGraph_Free ((void **) &g, NULL) ;             \
+    LAGraph_Free ((void **) &done, NULL) ;          \
+    LAGraph_Free ((void **) &heap, NULL) ;          \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+typedef struct
+{
+    double key ;        // g(x) + h(x)
+    GrB_Index x ;       // vertex
+}
+heap_entry ;
+
+int LAGraph_DistanceOracleShortestPath
+(
+    // output:
+    double *dist,                   // length of the shortest path from u to v
+    // input:
+    const LAGraph_DistanceOracle Oracle,
+    const LAGraph_Graph G,          // graph the oracle was built for
+    GrB_Index u,                    // source vertex
+    GrB_Index v,                    // destination vertex
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector w = NULL ;
+    double *g = NULL, *X = NULL ;
+    bool *done = NULL ;
+    heap_entry *heap = NULL ;
+    GrB_Index *I = NULL ;
+
+    LG_ASSERT (dist != NULL && Oracle != NULL, GrB_NULL_POINTER) ;
+    (*dist) = INFINITY ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_ASSERT_MSG (Oracle->n == n, GrB_DIMENSION_MISMATCH,
+        "oracle does not match the graph") ;
+    LG_ASSERT_MSG (u < n && v < n, GrB_INVALID_INDEX, "invalid vertex") ;
+
+    // quick return if v is not reachable, or if a landmark is on the path
+    double lower, upper ;
+    oracle_bounds (&lower, &upper, Oracle, u, v) ;
+    if (lower == upper)
+    {
+        (*dist) = lower ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &g, n, sizeof (double), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &done, n, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, n, sizeof (double), msg)) ;
+    size_t heap_size = LAGRAPH_MAX (n, 16) ;
+    LG_TRY (LAGraph_Malloc ((void **) &heap, heap_size, sizeof (heap_entry),
+        msg)) ;
+    GRB_TRY (GrB_Vector_new (&w, GrB_FP64, n)) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        g [i] = INFINITY ;
+    }
+
+    //--------------------------------------------------------------------------
+    // A* search
+    //--------------------------------------------------------------------------
+
+    size_t nheap = 1 ;
+    g [u] = 0 ;
+    heap [0].key = lower ;
+    heap [0].x = u ;
+
+    while (nheap > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // remove the top of the heap
+        //----------------------------------------------------------------------
+
+        heap_entry top = heap [0] ;
+        heap_entry last = heap [--nheap] ;
+        size_t p = 0 ;
+        while (true)
+        {
+            size_t c = 2*p + 1 ;
+            if (c >= nheap) break ;
+            if (c + 1 < nheap && heap [c+1].key < heap [c].key) c++ ;
+            if (last.key <= heap [c].key) break ;
+            heap [p] = heap [c] ;
+            p = c ;
+        }
+        if (nheap > 0) heap [p] = last ;
+
+        GrB_Index x = top.x ;
+        if (done [x]) continue ;
+        done [x] = true ;
+        if (x == v)
+        {
+            // g [v] is final
+            (*dist) = g [v] ;
+            break ;
+        }
+
+        //----------------------------------------------------------------------
+        // relax the edges out of x
+        //----------------------------------------------------------------------
+
+        // w = A (x,:)
+        GRB_TRY (GrB_Col_extract (w, NULL, NULL, G->A, GrB_ALL, n, x,
+            GrB_DESC_T0)) ;
+        GrB_Index nw = n ;
+        GRB_TRY (GrB_Vector_extractTuples (I, X, &nw, w)) ;
+
+        for (GrB_Index e = 0 ; e < nw ; e++)
+        {
+            GrB_Index y = I [e] ;
+            if (done [y]) continue ;
+            double gy = g [x] + (Oracle->weighted ? X [e] : 1) ;
+            if (gy >= g [y]) continue ;
+            double hy, unused ;
+            oracle_bounds (&hy, &unused, Oracle, y, v) ;
+            if (hy == INFINITY) continue ;
+            g [y] = gy ;
+
+            // insert (gy + hy, y) into the heap
+            if (nheap == heap_size)
+            {
+                LG_TRY (LAGraph_Realloc ((void **) &heap, 2 * heap_size,
+                    heap_size, sizeof (heap_entry), msg)) ;
+                heap_size = 2 * heap_size ;
+            }
+            heap_entry entry ;
+            entry.key = gy + hy ;
+            entry.x = y ;
+            p = nheap++ ;
+            while (p > 0 && entry.key < heap [(p-1)/2].key)
+            {
+                heap [p] = heap [(p-1)/2] ;
+                p = (p-1) / 2 ;
+            }
+            heap [p] = entry ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
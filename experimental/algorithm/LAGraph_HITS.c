@@ -42,13 +42,11 @@ int LAGr_HITS(
     char *msg 
 ) {
     LG_CLEAR_MSG ;
-    printf("hi4\n");
     GrB_Vector h = NULL, a = NULL, h_old = NULL, a_old=NULL;
     LG_ASSERT (hubs != NULL, GrB_NULL_POINTER) ;
     LG_ASSERT (authorities != NULL, GrB_NULL_POINTER) ;
     // LG_ASSERT(G->in_degree != NULL, "G->in_degree required");
     // LG_ASSERT(G->out_degree != NULL, "G->out_degree required");
-    printf("hi3\n");
     LG_TRY (LAGraph_CheckGraph (G, msg)) ;
     GrB_Matrix AT ;
     if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
@@ -64,7 +62,6 @@ int LAGr_HITS(
         LG_ASSERT_MSG (AT != NULL,
             LAGRAPH_NOT_CACHED, "G->AT is required") ;
     }
-    printf("hi2\n");
     // Initializations
     GrB_Index n;
     (*hubs) = NULL;
@@ -81,19 +78,18 @@ int LAGr_HITS(
     GRB_TRY(GrB_assign(a, NULL, NULL, defaultValue, GrB_ALL, n, NULL));
     GRB_TRY(GrB_assign(h, NULL, NULL, defaultValue, GrB_ALL, n, NULL));
 
-    int indegree, outdegree;
-
-
-    // Count the number of non-zero entries in the indegree vector
-    GrB_Vector_nvals(&indegree, G->in_degree);
-
-    // Count the number of non-zero entries in the outdegree vector
-    GrB_Vector_nvals(&outdegree, G->out_degree);
-
-
+    // if the degrees are cached, use them to decide if a and h become dense
+    GrB_Index indegree = n, outdegree = n ;
+    if (G->in_degree != NULL)
+    {
+        GRB_TRY (GrB_Vector_nvals (&indegree, G->in_degree)) ;
+    }
+    if (G->out_degree != NULL)
+    {
+        GRB_TRY (GrB_Vector_nvals (&outdegree, G->out_degree)) ;
+    }
 
     bool flag = (indegree + outdegree) > n/16.0;
-    printf("hi\n");
     for((*iters) = 0; (*iters) < itermax && rdiff > tol; (*iters)++) {
         // Save old values of h and a       
         GrB_Vector temp = h_old ; h_old = h ; h = temp ;
@@ -148,7 +144,6 @@ int LAGr_HITS(
 
         // rdiff = rdiff/2
         rdiff /= 2;
-        printf("%d %f\n", *iters, rdiff);
     }
 
     // Normalize
@@ -0,0 +1,329 @@
+//------------------------------------------------------------------------------
+// LAGraph_Partition: balanced edge-cut partitioning by label propagation
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_Partition splits the nodes of G into nparts parts of roughly equal
+// weight, with few edges between the parts.  The weight of node i is 1 plus
+// its out-degree, so that each part holds about the same number of rows and
+// entries of G->A, and thus takes about the same work in a GrB_mxv or BFS
+// step when each part is given to its own socket (see
+// LAGraph_PartitionLayout).
+
+// The partitioner is a size-constrained label propagation, in the spirit of
+// LAGraph_cdlp but with one label per part instead of one per node.  The
+// initial partition splits the nodes into contiguous blocks of equal weight,
+// in their natural order, which is the row-block split that GraphBLAS would
+// use anyway.  Each iteration then propagates the labels with a single
+// GrB_mxm: C = S*X with the plus_one semiring, where S is the structure of
+// A+A' and X(i,k) is present if node i is in part k, so C(i,k) is the number
+// of neighbors of node i in part k.  Each node whose neighbors are more often
+// in another part than in its own is a candidate to move there.  Candidates
+// are sorted by gain (LG_msort2), and moves are accepted in that order as
+// long as the target part stays within 3% of the average part weight.  To
+// avoid two adjacent nodes swapping parts back and forth, moves go only to
+// higher-numbered parts in even iterations, and only to lower-numbered parts
+// in odd iterations.  The method stops when two consecutive iterations move
+// no node, or after 20 iterations.
+
+// On output, part(i) = k if node i is in part k, for all nodes i (part is a
+// full GrB_INT64 vector of size n), and *edgecut (if not NULL) is the number
+// of entries A(i,j) with part(i) != part(j).  G->out_degree is computed if
+// not already cached.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &Id, NULL) ;            \
+    LAGraph_Free ((void **) &Part, NULL) ;          \
+    LAGraph_Free ((void **) &Weight, NULL) ;        \
+    LAGraph_Free ((void **) &PartWeight, NULL) ;    \
+    LAGraph_Free ((void **) &Own, NULL) ;           \
+    LAGraph_Free ((void **) &Best, NULL) ;          \
+    LAGraph_Free ((void **) &BestCount, NULL) ;     \
+    LAGraph_Free ((void **) &Gain, NULL) ;          \
+    LAGraph_Free ((void **) &Cand, NULL) ;          \
+    LAGraph_Free ((void **) &Ci, NULL) ;            \
+    LAGraph_Free ((void **) &Cj, NULL) ;            \
+    LAGraph_Free ((void **) &Cx, NULL) ;            \
+    GrB_free (&S) ;                                 \
+    GrB_free (&X) ;                                 \
+    GrB_free (&C) ;                                 \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&p) ;                                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// maximum number of label propagation iterations
+#define LG_PARTITION_ITERMAX 20
+
+// allowed imbalance: each part weighs at most 3% more than the average
+#define LG_PARTITION_IMBALANCE 0.03
+
+int LAGraph_Partition
+(
+    // output:
+    GrB_Vector *part,       // part(i) = k if node i is in part k
+    int64_t *edgecut,       // # of entries A(i,j) with part(i) != part(j);
+                            // not computed if NULL
+    // input/output:
+    LAGraph_Graph G,        // graph to partition; out_degree may be computed
+    // input:
+    int nparts,             // number of parts
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *Id = NULL, *Part = NULL, *Weight = NULL, *PartWeight = NULL,
+        *Own = NULL, *Best = NULL, *BestCount = NULL, *Gain = NULL,
+        *Cand = NULL, *Ci = NULL, *Cj = NULL, *Cx = NULL ;
+    GrB_Matrix S = NULL, X = NULL, C = NULL ;
+    GrB_Vector p = NULL ;
+    LG_ASSERT (part != NULL, GrB_NULL_POINTER) ;
+    (*part) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (nparts >= 1, GrB_INVALID_VALUE, "nparts must be >= 1") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    bool symmetric = (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE) ;
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, (int64_t) n / 4096) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // Weight = 1 + out-degree of each node
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    GrB_Index nd = n ;
+    LG_TRY (LAGraph_Malloc ((void **) &Id, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Part, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Own, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Best, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Weight, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &PartWeight, nparts, sizeof (int64_t),
+        msg)) ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 ((GrB_Index *) Id, Own, &nd,
+        G->out_degree)) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < (int64_t) nd ; k++)
+    {
+        Weight [Id [k]] = Own [k] ;
+    }
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        Id [k] = k ;
+        Weight [k]++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // initial partition: contiguous blocks of equal weight
+    //--------------------------------------------------------------------------
+
+    double total_weight = (double) (n + nvals) ;
+    int64_t capacity = (int64_t)
+        ((1 + LG_PARTITION_IMBALANCE) * total_weight / nparts) + 1 ;
+    double wsum = 0 ;
+    for (int64_t i = 0 ; i < (int64_t) n ; i++)
+    {
+        int64_t pi = (int64_t) ((wsum * nparts) / total_weight) ;
+        Part [i] = LAGRAPH_MIN (pi, nparts - 1) ;
+        PartWeight [Part [i]] += Weight [i] ;
+        wsum += Weight [i] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // refine the partition with size-constrained label propagation
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix Sym = A ;
+    if (nparts > 1 && n > 0 && nvals > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // Sym = structure of A+A'
+        //----------------------------------------------------------------------
+
+        if (!symmetric)
+        {
+            GRB_TRY (GrB_Matrix_new (&S, GrB_BOOL, n, n)) ;
+            if (G->AT != NULL)
+            {
+                GRB_TRY (GrB_eWiseAdd (S, NULL, NULL, GrB_ONEB_BOOL, A, G->AT,
+                    NULL)) ;
+            }
+            else
+            {
+                GRB_TRY (GrB_eWiseAdd (S, NULL, NULL, GrB_ONEB_BOOL, A, A,
+                    GrB_DESC_T1)) ;
+            }
+            Sym = S ;
+        }
+
+        //----------------------------------------------------------------------
+        // allocate workspace
+        //----------------------------------------------------------------------
+
+        // C = Sym*X has at most nvals(Sym) entries
+        GrB_Index snvals, cnvals ;
+        GRB_TRY (GrB_Matrix_nvals (&snvals, Sym)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Ci, snvals, sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Cj, snvals, sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Cx, snvals, sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &BestCount, n, sizeof (int64_t),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Gain, n, sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Cand, n, sizeof (int64_t), msg)) ;
+        GRB_TRY (GrB_Matrix_new (&C, GrB_INT64, n, nparts)) ;
+
+        int nstill = 0 ;
+        for (int iter = 0 ; iter < LG_PARTITION_ITERMAX && nstill < 2 ; iter++)
+        {
+
+            //------------------------------------------------------------------
+            // C(i,k) = # of neighbors of node i in part k
+            //------------------------------------------------------------------
+
+            // X(i,Part [i]) is present for all i; its values are not used
+            GrB_free (&X) ;
+            GRB_TRY (GrB_Matrix_new (&X, GrB_INT64, n, nparts)) ;
+            GRB_TRY (GrB_Matrix_build_INT64 (X, (GrB_Index *) Id,
+                (GrB_Index *) Part, Part, n, GrB_PLUS_INT64)) ;
+            GRB_TRY (GrB_mxm (C, NULL, NULL, LAGraph_plus_one_int64, Sym, X,
+                NULL)) ;
+            cnvals = snvals ;
+            GRB_TRY (GrB_Matrix_extractTuples_INT64 ((GrB_Index *) Ci,
+                (GrB_Index *) Cj, Cx, &cnvals, C)) ;
+
+            //------------------------------------------------------------------
+            // find the best part for each node
+            //------------------------------------------------------------------
+
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < (int64_t) n ; k++)
+            {
+                Own [k] = 0 ;
+                Best [k] = Part [k] ;
+                BestCount [k] = 0 ;
+            }
+
+            // the tuples of C are in no particular order, so this scan is
+            // sequential, like the mode selection in LAGraph_cdlp
+            bool up = (iter % 2 == 0) ;
+            for (k = 0 ; k < (int64_t) cnvals ; k++)
+            {
+                int64_t i = Ci [k], pk = Cj [k], c = Cx [k] ;
+                if (pk == Part [i])
+                {
+                    Own [i] = c ;
+                }
+                else if ((up ? (pk > Part [i]) : (pk < Part [i])) &&
+                    (c > BestCount [i] ||
+                    (c == BestCount [i] && pk < Best [i])))
+                {
+                    Best [i] = pk ;
+                    BestCount [i] = c ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // move the nodes with the largest gains, while the parts fit
+            //------------------------------------------------------------------
+
+            int64_t ncand = 0 ;
+            for (int64_t i = 0 ; i < (int64_t) n ; i++)
+            {
+                if (BestCount [i] > Own [i])
+                {
+                    Gain [ncand] = Own [i] - BestCount [i] ;
+                    Cand [ncand++] = i ;
+                }
+            }
+            LG_TRY (LG_msort2 (Gain, Cand, ncand, msg)) ;
+
+            int64_t nmoved = 0 ;
+            for (k = 0 ; k < ncand ; k++)
+            {
+                int64_t i = Cand [k] ;
+                int64_t target = Best [i] ;
+                if (PartWeight [target] + Weight [i] <= capacity)
+                {
+                    PartWeight [Part [i]] -= Weight [i] ;
+                    PartWeight [target] += Weight [i] ;
+                    Part [i] = target ;
+                    nmoved++ ;
+                }
+            }
+            nstill = (nmoved == 0) ? (nstill + 1) : 0 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the part vector
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&p, GrB_INT64, n)) ;
+    GRB_TRY (GrB_Vector_build_INT64 (p, (GrB_Index *) Id, Part, n,
+        GrB_PLUS_INT64)) ;
+
+    //--------------------------------------------------------------------------
+    // count the edges cut by the partition
+    //--------------------------------------------------------------------------
+
+    if (edgecut != NULL)
+    {
+        // inside = # of entries A(i,j) with Part [i] == Part [j]
+        int64_t inside = 0 ;
+        if (nvals > 0)
+        {
+            GrB_free (&X) ;
+            GrB_free (&C) ;
+            GRB_TRY (GrB_Matrix_new (&X, GrB_INT64, n, nparts)) ;
+            GRB_TRY (GrB_Matrix_build_INT64 (X, (GrB_Index *) Id,
+                (GrB_Index *) Part, Part, n, GrB_PLUS_INT64)) ;
+            GRB_TRY (GrB_Matrix_new (&C, GrB_INT64, n, nparts)) ;
+            GRB_TRY (GrB_mxm (C, NULL, NULL, LAGraph_plus_one_int64, A, X,
+                NULL)) ;
+            GRB_TRY (GrB_eWiseMult (C, NULL, NULL, GrB_FIRST_INT64, C, X,
+                NULL)) ;
+            GRB_TRY (GrB_reduce (&inside, NULL, GrB_PLUS_MONOID_INT64, C,
+                NULL)) ;
+        }
+        (*edgecut) = (int64_t) nvals - inside ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*part) = p ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+// LAGraph_SSSP_AutoDelta: select Delta for delta-stepping SSSP
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is a Basic method: G->emin and G->emax are computed if not present.
+
+// For random edge weights in the range [0,emax], Meyer and Sanders show that
+// a bucket width of Delta = Theta (emax/d), where d is the average degree,
+// gives a linear amount of work in expectation:
+
+// U. Meyer and P. Sanders, "Delta-stepping: a parallelizable shortest path
+// algorithm", Journal of Algorithms, 49(1):114-152, 2003.
+
+// A smaller Delta leads to many nearly-empty buckets (Dijkstra-like), and a
+// larger Delta leads to many re-relaxations of the light edges within each
+// bucket (Bellman-Ford-like).  The average out-degree is nvals(A)/n, which
+// needs no sampling.  Delta is then clamped so that it is at least G->emin
+// (otherwise no edge would be light), and rounded up to an integer of at
+// least 1 if G->A has an integer type.  If all edge weights are negative or
+// zero, or if G has no edges, Delta is 1.
+
+#define LG_FREE_ALL         \
+{                           \
+    GrB_free (Delta) ;      \
+}
+
+#include "LG_internal.h"
+
+int LAGraph_SSSP_AutoDelta
+(
+    // output:
+    GrB_Scalar *Delta,          // Delta for delta-stepping
+    // input/output:
+    LAGraph_Graph G,            // G->emin and G->emax computed if not present
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (Delta != NULL, GrB_NULL_POINTER) ;
+    (*Delta) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G->A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+    bool is_integer = (etype == GrB_INT32 || etype == GrB_INT64 ||
+        etype == GrB_UINT32 || etype == GrB_UINT64) ;
+    LG_ASSERT_MSG (is_integer || etype == GrB_FP32 || etype == GrB_FP64,
+        GrB_NOT_IMPLEMENTED, "type not supported") ;
+
+    //--------------------------------------------------------------------------
+    // get the edge weight range and the average degree
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Cached_EMin (G, msg)) ;
+    LG_TRY (LAGraph_Cached_EMax (G, msg)) ;
+
+    // emin and emax are left unchanged if G has no edges
+    double emin = 0, emax = 0 ;
+    GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+    GRB_TRY (GrB_Scalar_extractElement_FP64 (&emax, G->emax)) ;
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    double d = (n == 0) ? 1 : ((double) nvals / (double) n) ;
+    d = LAGRAPH_MAX (d, 1) ;
+
+    //--------------------------------------------------------------------------
+    // Delta = max (emax/d, emin), rounded up for integer types
+    //--------------------------------------------------------------------------
+
+    double delta = emax / d ;
+    delta = LAGRAPH_MAX (delta, emin) ;
+    if (is_integer)
+    {
+        delta = ceil (delta) ;
+    }
+    if (!(delta > 0))
+    {
+        // all edges are negative or zero, or G has no edges
+        delta = 1 ;
+    }
+
+    GRB_TRY (GrB_Scalar_new (Delta, etype)) ;
+    GRB_TRY (GrB_Scalar_setElement_FP64 (*Delta, delta)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+// LAGraph_SingleSourceShortestPath: delta-stepping SSSP with automatic Delta
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGr_SingleSourceShortestPath_Split is an Advanced algorithm: it uses a
+// light/heavy split of G->A constructed by LAGraph_DeltaSplit_New, so that
+// the split is computed once for any number of sources.
+
+// LAGraph_SingleSourceShortestPath is a Basic algorithm: it computes G->emin
+// and G->emax if not present, selects Delta with LAGraph_SSSP_AutoDelta, and
+// then calls LG_SingleSourceShortestPath, which builds the split itself.
+
+// Both call LG_SingleSourceShortestPath, the delta-stepping kernel behind
+// LAGr_SingleSourceShortestPath, in src/algorithm.
+
+#define LG_FREE_ALL         \
+{                           \
+    GrB_free (&Delta) ;     \
+}
+
+#include "LG_alg_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Split: delta-stepping with a precomputed split
+//------------------------------------------------------------------------------
+
+int LAGr_SingleSourceShortestPath_Split
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    const LAGraph_DeltaSplit Split, // light/heavy split of G->A
+    char *msg
+)
+{
+    GrB_Scalar Delta = NULL ;
+    LG_CLEAR_MSG ;
+    LG_ASSERT (Split != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (Split->Delta != NULL && Split->AL != NULL && Split->AH != NULL,
+        GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    // the split must have been built from a graph with the same dimensions
+    GrB_Index n, nsplit ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nsplit, Split->AL)) ;
+    LG_ASSERT_MSG (n == nsplit, GrB_DIMENSION_MISMATCH,
+        "split does not match the graph") ;
+
+    return (LG_SingleSourceShortestPath (path_length, G, source, Split->Delta,
+        Split->AL, Split->AH, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SingleSourceShortestPath: delta-stepping with automatic Delta
+//------------------------------------------------------------------------------
+
+int LAGraph_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input/output:
+    LAGraph_Graph G,            // input graph; G->emin, G->emax computed
+    // input:
+    GrB_Index source,           // source vertex
+    char *msg
+)
+{
+    GrB_Scalar Delta = NULL ;
+    LG_CLEAR_MSG ;
+    LG_ASSERT (path_length != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+
+    // compute G->emin and G->emax, and select Delta from them
+    LG_TRY (LAGraph_SSSP_AutoDelta (&Delta, G, msg)) ;
+
+    // the split is not retained, so let the kernel build it
+    LG_TRY (LG_SingleSourceShortestPath (path_length, G, source, Delta,
+        NULL, NULL, msg)) ;
+
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/benchmark/bf_demo.c: benchmark Bellman-Ford methods
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// Compares LAGr_BellmanFord with the LAGraph_BF_* variants, which are kept as
+// baselines.  Each method is run from each source node of the problem, and
+// the path lengths are compared with LAGr_BellmanFord.
+//
+// Usage:
+//
+//      bf_demo matrix.mtx [sourcenodes.mtx]
+//      bf_demo matrix.grb [sourcenodes.mtx]
+//      bf_demo < matrix.mtx
+
+#include "../../src/benchmark/LAGraph_demo.h"
+#include "LAGraphX.h"
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LAGraph_Delete (&G, NULL) ;                     \
+    GrB_free (&SourceNodes) ;                       \
+    GrB_free (&A0) ;                                \
+    GrB_free (&AT0) ;                               \
+    GrB_free (&d) ;                                 \
+    GrB_free (&pi) ;                                \
+    GrB_free (&h) ;                                 \
+    GrB_free (&d_ok) ;                              \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &J, NULL) ;             \
+    LAGraph_Free ((void **) &W, NULL) ;             \
+    LAGraph_Free ((void **) &dc, NULL) ;            \
+    LAGraph_Free ((void **) &pic, NULL) ;           \
+}
+
+// the methods to compare
+typedef enum
+{
+    BF_new_path_length,     // LAGr_BellmanFord, path lengths only
+    BF_new_tree,            // LAGr_BellmanFord, with parent and hops
+    BF_basic,
+    BF_basic_mxv,
+    BF_basic_pushpull,
+    BF_full,
+    BF_full1,
+    BF_full1a,
+    BF_full2,
+    BF_full_mxv,
+    BF_pure_c_double,
+    BF_nmethods
+}
+bf_method ;
+
+const char *method_name [BF_nmethods] =
+{
+    "LAGr_BellmanFord",
+    "LAGr_BellmanFord (tree)",
+    "LAGraph_BF_basic",
+    "LAGraph_BF_basic_mxv",
+    "LAGraph_BF_basic_pushpull",
+    "LAGraph_BF_full",
+    "LAGraph_BF_full1",
+    "LAGraph_BF_full1a",
+    "LAGraph_BF_full2",
+    "LAGraph_BF_full_mxv",
+    "LAGraph_BF_pure_c_double",
+} ;
+
+int main (int argc, char **argv)
+{
+    char msg [LAGRAPH_MSG_LEN] ;
+
+    LAGraph_Graph G = NULL ;
+    GrB_Matrix SourceNodes = NULL, A0 = NULL, AT0 = NULL ;
+    GrB_Vector d = NULL, pi = NULL, h = NULL, d_ok = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *W = NULL, *dc = NULL ;
+    int64_t *pic = NULL ;
+
+    // start GraphBLAS and LAGraph
+    bool burble = false ;
+    demo_init (burble) ;
+
+    //--------------------------------------------------------------------------
+    // read in the graph
+    //--------------------------------------------------------------------------
+
+    char *matrix_name = (argc > 1) ? argv [1] : "stdin" ;
+    LAGRAPH_TRY (readproblem (&G, &SourceNodes,
+        false, false, false, GrB_FP64, false, argc, argv)) ;
+    GrB_Index n, nvals, nsource ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nsource, SourceNodes)) ;
+    LAGRAPH_TRY (LAGraph_Cached_AT (G, msg)) ;
+    LAGRAPH_TRY (LAGraph_Cached_EMin (G, msg)) ;
+
+    // A0 = A with explicit zeros on the diagonal, and AT0 = A0', for
+    // LAGraph_BF_basic, _basic_mxv, _basic_pushpull, _full, and _full_mxv
+    GRB_TRY (GrB_Matrix_dup (&A0, G->A)) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        GRB_TRY (GrB_Matrix_setElement_FP64 (A0, 0, i, i)) ;
+    }
+    GRB_TRY (GrB_Matrix_new (&AT0, GrB_FP64, n, n)) ;
+    GRB_TRY (GrB_transpose (AT0, NULL, NULL, A0, NULL)) ;
+
+    // the tuples of A, for LAGraph_BF_pure_c_double
+    GrB_Index nz = nvals ;
+    LAGRAPH_TRY (LAGraph_Malloc ((void **) &I, nz, sizeof (GrB_Index), msg)) ;
+    LAGRAPH_TRY (LAGraph_Malloc ((void **) &J, nz, sizeof (GrB_Index), msg)) ;
+    LAGRAPH_TRY (LAGraph_Malloc ((void **) &W, nz, sizeof (double), msg)) ;
+    GRB_TRY (GrB_Matrix_extractTuples_FP64 (I, J, W, &nz, G->A)) ;
+
+    //--------------------------------------------------------------------------
+    // run each method from each source
+    //--------------------------------------------------------------------------
+
+    double T [BF_nmethods] ;
+    for (int m = 0 ; m < BF_nmethods ; m++) T [m] = 0 ;
+
+    for (int64_t trial = 0 ; trial < nsource ; trial++)
+    {
+        GrB_Index src = -1 ;
+        GRB_TRY (GrB_Matrix_extractElement (&src, SourceNodes, trial, 0)) ;
+        src-- ;     // convert from 1-based to 0-based
+
+        // the reference result
+        GrB_free (&d_ok) ;
+        int ok_result = LAGr_BellmanFord (&d_ok, NULL, NULL, G, src, msg) ;
+        if (ok_result < 0) LAGRAPH_TRY (ok_result) ;
+
+        for (int m = 0 ; m < BF_nmethods ; m++)
+        {
+            GrB_free (&d) ;
+            GrB_free (&pi) ;
+            GrB_free (&h) ;
+            LAGraph_Free ((void **) &dc, NULL) ;
+            LAGraph_Free ((void **) &pic, NULL) ;
+            int result = GrB_SUCCESS ;
+            double t = LAGraph_WallClockTime ( ) ;
+            switch (m)
+            {
+                case BF_new_path_length :
+                    result = LAGr_BellmanFord (&d, NULL, NULL, G, src, msg) ;
+                    break ;
+                case BF_new_tree :
+                    result = LAGr_BellmanFord (&d, &pi, &h, G, src, msg) ;
+                    break ;
+                case BF_basic :
+                    result = LAGraph_BF_basic (&d, A0, src) ;
+                    break ;
+                case BF_basic_mxv :
+                    result = LAGraph_BF_basic_mxv (&d, AT0, src) ;
+                    break ;
+                case BF_basic_pushpull :
+                    result = LAGraph_BF_basic_pushpull (&d, A0, AT0, src) ;
+                    break ;
+                case BF_full :
+                    result = LAGraph_BF_full (&d, &pi, &h, A0, src) ;
+                    break ;
+                case BF_full1 :
+                    result = LAGraph_BF_full1 (&d, &pi, &h, G->A, src) ;
+                    break ;
+                case BF_full1a :
+                    result = LAGraph_BF_full1a (&d, &pi, &h, G->A, src) ;
+                    break ;
+                case BF_full2 :
+                    result = LAGraph_BF_full2 (&d, &pi, &h, G->A, src) ;
+                    break ;
+                case BF_full_mxv :
+                    result = LAGraph_BF_full_mxv (&d, &pi, &h, AT0, src) ;
+                    break ;
+                case BF_pure_c_double :
+                    result = LAGraph_BF_pure_c_double (&dc, &pic, src, n, nz,
+                        (const int64_t *) I, (const int64_t *) J, W) ;
+                    break ;
+                default : break ;
+            }
+            t = LAGraph_WallClockTime ( ) - t ;
+            T [m] += t ;
+            if (result < 0) LAGRAPH_TRY (result) ;
+            if (result != ok_result)
+            {
+                printf ("%s: result %d differs from %d\n", method_name [m],
+                    result, ok_result) ;
+            }
+
+            // compare the path lengths with LAGr_BellmanFord
+            if (ok_result == GrB_SUCCESS && d != NULL)
+            {
+                // the sparse variants leave unreachable nodes empty
+                bool isequal = false ;
+                GRB_TRY (GrB_assign (d, d, NULL, (double) INFINITY,
+                    GrB_ALL, n, GrB_DESC_SC)) ;
+                LAGRAPH_TRY (LAGraph_Vector_IsEqual (&isequal, d, d_ok, msg)) ;
+                if (!isequal)
+                {
+                    printf ("%s: path lengths differ\n", method_name [m]) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // report results
+    //--------------------------------------------------------------------------
+
+    printf ("\n%s: n %g nvals %g, %d sources\n", matrix_name, (double) n,
+        (double) nvals, (int) nsource) ;
+    for (int m = 0 ; m < BF_nmethods ; m++)
+    {
+        double t = T [m] / nsource ;
+        printf ("%-28s time: %12.6e (sec), rate: %10.3f (1e6 edges/sec)"
+            " speedup of LAGr_BellmanFord: %g\n", method_name [m], t,
+            1e-6 * ((double) nvals) / t, T [m] / T [BF_new_path_length]) ;
+    }
+
+    LG_FREE_ALL ;
+    LAGRAPH_TRY (LAGraph_Finalize (msg)) ;
+    return (GrB_SUCCESS) ;
+}
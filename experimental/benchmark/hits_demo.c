@@ -16,7 +16,9 @@
 //------------------------------------------------------------------------------
 
 // This main program is a simple driver for testing and benchmarking the
-// LAGr_HITS "algorithm", in experimental/algorithm.  To use it,
+// LAGr_HITS "algorithm", in experimental/algorithm, and for comparing it with
+// LAGr_HITSFused, which makes one pass over G->A per iteration and does not use
+// G->AT.  To use it,
 // compile LAGraph while in the build folder with these commands:
 //
 //      cd LAGraph/build
@@ -25,9 +27,13 @@
 //
 // Then run this demo with an input matrix.  For example:
 //
-//      ./experimental/benchmark/hellworld_demo ../data/west0067.mtx
-//      ./experimental/benchmark/hellworld_demo < ../data/west0067.mtx
-//      ./experimental/benchmark/hellworld_demo ../data/karate.mtx
+//      ./experimental/benchmark/hits_demo ../data/west0067.mtx
+//      ./experimental/benchmark/hits_demo < ../data/west0067.mtx
+//      ./experimental/benchmark/hits_demo ../data/karate.mtx
+//
+// or with a GAP graph in binary form (see mtx2bin_demo):
+//
+//      ./experimental/benchmark/hits_demo ~/GAP/GAP-web/GAP-web.grb
 //
 #include "../../src/benchmark/LAGraph_demo.h"
 #include "LG_internal.h"
@@ -86,6 +92,8 @@ int main (int argc, char **argv)
     LG_TRY(LAGraph_Cached_OutDegree(G, msg));
     LG_TRY(LAGraph_Cached_InDegree(G, msg));
     
+    LG_TRY(LAGraph_Cached_AT(G, msg));
+    
     int iters = 0, itermax = 1000;
     float tol = 1e-6;
     t = LAGraph_WallClockTime ( ) ;
@@ -93,11 +101,51 @@ int main (int argc, char **argv)
     LG_TRY (LAGr_HITS (&hubs, &authorities, &iters, G, tol, itermax, msg)) ;
     t = LAGraph_WallClockTime ( ) - t ;
     printf ("Time for LAGr_HITS: %g sec\n", t) ;
+    printf("Num iterations: %d\n", iters);
+
+    //--------------------------------------------------------------------------
+    // compare with LAGr_HITSFused: one pass over G->A, no G->AT
+    //--------------------------------------------------------------------------
+
+    GrB_Vector h = NULL, a = NULL ;
+    GrB_Index n ;
+    LG_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    float vtol [3] = { 0, 1e-9, 1e-8 } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        int iters2 = 0 ;
+        t = LAGraph_WallClockTime ( ) ;
+        LG_TRY (LAGr_HITSFused (&h, &a, &iters2, G, NULL, tol, vtol [k],
+            itermax, msg)) ;
+        t = LAGraph_WallClockTime ( ) - t ;
+        // err = max (abs (a - authorities))
+        float err = 0 ;
+        LG_TRY (GrB_eWiseAdd (a, NULL, NULL, GrB_MINUS_FP32, a, authorities,
+            NULL)) ;
+        LG_TRY (GrB_apply (a, NULL, NULL, GrB_ABS_FP32, a, NULL)) ;
+        LG_TRY (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP32, a, NULL)) ;
+        printf ("Time for LAGr_HITSFused (vtol %g): %g sec, iters %d, "
+            "err %g\n", vtol [k], t, iters2, err) ;
+        GrB_free (&h) ;
+        GrB_free (&a) ;
+    }
+
+    // warm start from the authorities of LAGr_HITS
+    t = LAGraph_WallClockTime ( ) ;
+    LG_TRY (LAGr_HITSFused (&h, &a, &iters, G, authorities, tol, 0, itermax,
+        msg)) ;
+    t = LAGraph_WallClockTime ( ) - t ;
+    printf ("Time for LAGr_HITSFused (warm start): %g sec, iters %d\n",
+        t, iters) ;
+    GrB_free (&h) ;
+    GrB_free (&a) ;
+
     //-------------------------------------------------------------------------- 
     // free everyting and finish
     //--------------------------------------------------------------------------
-    printf("Num iterations: %d\n", iters);
     
+    GrB_free (&hubs) ;
+    GrB_free (&authorities) ;
     LG_FREE_ALL ;
     LG_TRY (LAGraph_Finalize (msg)) ;
     return (GrB_SUCCESS) ;
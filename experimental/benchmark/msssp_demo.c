@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/benchmark/msssp_demo.c: benchmark batched SSSP
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// Compares three ways of computing shortest paths from all the source nodes
+// of a problem:
+//
+//  (1) LAGr_SingleSourceShortestPath, once per source (the split of G->A into
+//      light and heavy edges is rebuilt for each source),
+//  (2) LAGr_SingleSourceShortestPath_Split, once per source, with the split
+//      computed once,
+//  (3) LAGr_MultiSourceShortestPath, with all sources in a single call.
+//
+// Usage:
+//
+//      msssp_demo matrix.mtx sourcenodes.mtx [delta]
+//      msssp_demo matrix.grb sourcenodes.mtx [delta]
+//
+// If delta is not given, it is selected by LAGraph_SSSP_AutoDelta.
+
+#include "../../src/benchmark/LAGraph_demo.h"
+#include "LAGraphX.h"
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                         \
+{                                           \
+    LAGraph_Delete (&G, NULL) ;             \
+    GrB_free (&SourceNodes) ;               \
+    GrB_free (&pathlen) ;                   \
+    GrB_free (&D) ;                         \
+    GrB_free (&Delta) ;                     \
+    LAGraph_DeltaSplit_Free (&Split, NULL) ;\
+    LAGraph_Free ((void **) &sources, NULL) ;\
+}
+
+int main (int argc, char **argv)
+{
+    char msg [LAGRAPH_MSG_LEN] ;
+
+    LAGraph_Graph G = NULL ;
+    GrB_Matrix SourceNodes = NULL, D = NULL ;
+    GrB_Vector pathlen = NULL ;
+    GrB_Scalar Delta = NULL ;
+    LAGraph_DeltaSplit Split = NULL ;
+    GrB_Index *sources = NULL ;
+
+    // start GraphBLAS and LAGraph
+    bool burble = false ;
+    demo_init (burble) ;
+
+    //--------------------------------------------------------------------------
+    // read in the graph and the source nodes
+    //--------------------------------------------------------------------------
+
+    char *matrix_name = (argc > 1) ? argv [1] : "stdin" ;
+    LAGRAPH_TRY (readproblem (&G, &SourceNodes,
+        false, false, false, GrB_INT32, false, argc, argv)) ;
+    GrB_Index n, nvals, nsource ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nsource, SourceNodes)) ;
+
+    LAGRAPH_TRY (LAGraph_Malloc ((void **) &sources, nsource,
+        sizeof (GrB_Index), msg)) ;
+    for (int64_t k = 0 ; k < nsource ; k++)
+    {
+        GRB_TRY (GrB_Matrix_extractElement (&(sources [k]), SourceNodes, k,
+            0)) ;
+        sources [k]-- ;     // convert from 1-based to 0-based
+    }
+
+    //--------------------------------------------------------------------------
+    // get delta
+    //--------------------------------------------------------------------------
+
+    double t = LAGraph_WallClockTime ( ) ;
+    if (argc > 3)
+    {
+        LAGRAPH_TRY (LAGraph_Cached_EMin (G, msg)) ;
+        GRB_TRY (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+        GRB_TRY (GrB_Scalar_setElement (Delta, (int32_t) atoi (argv [3]))) ;
+    }
+    else
+    {
+        LAGRAPH_TRY (LAGraph_SSSP_AutoDelta (&Delta, G, msg)) ;
+    }
+    t = LAGraph_WallClockTime ( ) - t ;
+    int32_t delta = 0 ;
+    GRB_TRY (GrB_Scalar_extractElement (&delta, Delta)) ;
+    printf ("delta: %d (%g sec)\n", delta, t) ;
+
+    //--------------------------------------------------------------------------
+    // (1) one LAGr_SingleSourceShortestPath per source
+    //--------------------------------------------------------------------------
+
+    double t1 = LAGraph_WallClockTime ( ) ;
+    for (int64_t k = 0 ; k < nsource ; k++)
+    {
+        GrB_free (&pathlen) ;
+        LAGRAPH_TRY (LAGr_SingleSourceShortestPath (&pathlen, G, sources [k],
+            Delta, msg)) ;
+    }
+    t1 = LAGraph_WallClockTime ( ) - t1 ;
+    printf ("sssp, per source:         %10.4f sec\n", t1) ;
+
+    //--------------------------------------------------------------------------
+    // (2) one LAGr_SingleSourceShortestPath_Split per source
+    //--------------------------------------------------------------------------
+
+    double t2 = LAGraph_WallClockTime ( ) ;
+    LAGRAPH_TRY (LAGraph_DeltaSplit_New (&Split, G, Delta, msg)) ;
+    double tsplit = LAGraph_WallClockTime ( ) - t2 ;
+    for (int64_t k = 0 ; k < nsource ; k++)
+    {
+        GrB_free (&pathlen) ;
+        LAGRAPH_TRY (LAGr_SingleSourceShortestPath_Split (&pathlen, G,
+            sources [k], Split, msg)) ;
+    }
+    t2 = LAGraph_WallClockTime ( ) - t2 ;
+    printf ("sssp, shared split:       %10.4f sec (split: %g sec)\n", t2,
+        tsplit) ;
+
+    //--------------------------------------------------------------------------
+    // (3) LAGr_MultiSourceShortestPath, all sources at once
+    //--------------------------------------------------------------------------
+
+    double t3 = LAGraph_WallClockTime ( ) ;
+    LAGRAPH_TRY (LAGr_MultiSourceShortestPath (&D, G, sources, nsource, Split,
+        msg)) ;
+    t3 = LAGraph_WallClockTime ( ) - t3 + tsplit ;
+    printf ("msssp, batched:           %10.4f sec\n", t3) ;
+
+#if LG_CHECK_RESULT
+    // check the last source
+    GrB_free (&pathlen) ;
+    GRB_TRY (GrB_Vector_new (&pathlen, GrB_INT32, n)) ;
+    GRB_TRY (GrB_Col_extract (pathlen, NULL, NULL, D, GrB_ALL, n,
+        nsource-1, GrB_DESC_T0)) ;
+    LAGRAPH_TRY (LG_check_sssp (pathlen, G, sources [nsource-1], msg)) ;
+#endif
+
+    //--------------------------------------------------------------------------
+    // report results
+    //--------------------------------------------------------------------------
+
+    printf ("speedup of batched over per-source: %g\n", t1 / t3) ;
+    fprintf (stderr, "Avg: SSSP %g MSSSP %g sec (%d sources): %s\n",
+        t1 / nsource, t3 / nsource, (int) nsource, matrix_name) ;
+
+    LG_FREE_ALL ;
+    LAGRAPH_TRY (LAGraph_Finalize (msg)) ;
+    return (GrB_SUCCESS) ;
+}
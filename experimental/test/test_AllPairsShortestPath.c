@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_AllPairsShortestPath.c: test APSP
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char filename [LEN+1] ;
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    bool has_negative_cycle ;
+    bool make_dag ;         // keep triu(A,1) and negate it
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    0, 0, "karate.mtx",
+    0, 0, "test_BF.mtx",
+    0, 1, "test_BF.mtx",
+    0, 0, "ldbc-directed-example.mtx",
+    0, 1, "west0067.mtx",
+    1, 0, "west0067.mtx",
+    1, 0, "matrix_int8.mtx",
+    0, 0, ""
+} ;
+
+//------------------------------------------------------------------------------
+// test_AllPairsShortestPath: compare each row with LAGr_BellmanFord
+//------------------------------------------------------------------------------
+
+void test_AllPairsShortestPath (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL, D [3] = { NULL, NULL, NULL } ;
+        GrB_Vector d = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        bool has_negative_cycle = files [k].has_negative_cycle ;
+        bool make_dag = files [k].make_dag ;
+        printf ("\nMatrix: %s (dag: %d)\n", aname, make_dag) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        if (make_dag)
+        {
+            // A = -triu (A,1), with negative weights but no cycles
+            OK (GrB_select (A, NULL, NULL, GrB_TRIU, A, 1, NULL)) ;
+            OK (GrB_apply (A, NULL, NULL, GrB_ABS_FP64, A, NULL)) ;
+            OK (GrB_apply (A, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+        }
+
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        int valid = (has_negative_cycle) ? GrB_NO_VALUE : GrB_SUCCESS ;
+
+        // compute D with each method
+        LAGraph_APSP_Method methods [3] = { LAGraph_APSP_AUTO,
+            LAGraph_APSP_FLOYD_WARSHALL, LAGraph_APSP_SQUARING } ;
+        for (int m = 0 ; m < 3 ; m++)
+        {
+            int result = LAGraph_AllPairsShortestPath (&D [m], G, methods [m],
+                0, msg) ;
+            printf ("method %d result: %d\n", m, result) ;
+            TEST_CHECK (result == valid) ;
+            if (has_negative_cycle) TEST_CHECK (D [m] == NULL) ;
+        }
+
+        if (!has_negative_cycle)
+        {
+            // all methods give the same result
+            bool ok = false ;
+            OK (LAGraph_Matrix_IsEqual (&ok, D [0], D [1], msg)) ;
+            TEST_CHECK (ok) ;
+            OK (LAGraph_Matrix_IsEqual (&ok, D [1], D [2], msg)) ;
+            TEST_CHECK (ok) ;
+
+            // compare a few rows with LAGr_BellmanFord
+            GrB_Index step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+            for (GrB_Index src = 0 ; src < n ; src += step)
+            {
+                OK (LAGr_BellmanFord (&d, NULL, NULL, G, src, msg)) ;
+                for (GrB_Index i = 0 ; i < n ; i++)
+                {
+                    double di = INFINITY, dij = INFINITY ;
+                    OK (GrB_Vector_extractElement (&di, d, i)) ;
+                    int result = GrB_Matrix_extractElement (&dij, D [1], src,
+                        i) ;
+                    TEST_CHECK (result == GrB_SUCCESS ||
+                        result == GrB_NO_VALUE) ;
+                    TEST_CHECK (di == dij) ;
+                }
+                OK (GrB_free (&d)) ;
+            }
+        }
+
+        for (int m = 0 ; m < 3 ; m++)
+        {
+            OK (GrB_free (&D [m])) ;
+        }
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_AllPairsShortestPath_errors
+//------------------------------------------------------------------------------
+
+void test_AllPairsShortestPath_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL, D = NULL ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGraph_AllPairsShortestPath (NULL, G, LAGraph_APSP_AUTO, 0,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGraph_AllPairsShortestPath (&D, G, (LAGraph_APSP_Method) 42, 0,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (D == NULL) ;
+
+    // both methods need more than 100 bytes
+    result = LAGraph_AllPairsShortestPath (&D, G, LAGraph_APSP_FLOYD_WARSHALL,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_OUT_OF_MEMORY) ;
+    TEST_CHECK (D == NULL) ;
+    result = LAGraph_AllPairsShortestPath (&D, G, LAGraph_APSP_SQUARING,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_OUT_OF_MEMORY) ;
+    TEST_CHECK (D == NULL) ;
+
+    // a negative self-edge is a negative-weight cycle
+    OK (GrB_Matrix_setElement_FP64 (G->A, -1, 0, 0)) ;
+    result = LAGraph_AllPairsShortestPath (&D, G, LAGraph_APSP_SQUARING, 0,
+        msg) ;
+    TEST_CHECK (result == GrB_NO_VALUE) ;
+    TEST_CHECK (D == NULL) ;
+    result = LAGraph_AllPairsShortestPath (&D, G, LAGraph_APSP_FLOYD_WARSHALL,
+        0, msg) ;
+    TEST_CHECK (result == GrB_NO_VALUE) ;
+    TEST_CHECK (D == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"AllPairsShortestPath", test_AllPairsShortestPath},
+    {"AllPairsShortestPath_errors", test_AllPairsShortestPath_errors},
+    {NULL, NULL}
+} ;
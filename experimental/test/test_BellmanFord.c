@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BellmanFord.c: test LAGr_BellmanFord
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char filename [LEN+1] ;
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    bool has_negative_cycle ;
+    bool make_dag ;         // keep triu(A,1) and negate it
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    0, 0, "karate.mtx",
+    0, 0, "test_BF.mtx",
+    0, 1, "test_BF.mtx",
+    0, 0, "ldbc-directed-example.mtx",
+    0, 1, "west0067.mtx",
+    1, 0, "west0067.mtx",
+    1, 0, "matrix_int8.mtx",
+    0, 0, ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_tree: check the parent and hops against the path lengths
+//------------------------------------------------------------------------------
+
+static void check_tree (GrB_Vector d, GrB_Vector parent, GrB_Vector hops,
+    GrB_Index src, GrB_Index n)
+{
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        double di = INFINITY ;
+        OK (GrB_Vector_extractElement (&di, d, i)) ;
+        int64_t p = -1, h = -1, hp = -1 ;
+        int result = GrB_Vector_extractElement (&p, parent, i) ;
+        if (di == INFINITY)
+        {
+            // i is not reachable
+            TEST_CHECK (result == GrB_NO_VALUE) ;
+            continue ;
+        }
+        OK (result) ;
+        OK (GrB_Vector_extractElement (&h, hops, i)) ;
+        if (i == src)
+        {
+            TEST_CHECK (p == src && h == 0) ;
+            continue ;
+        }
+        // (p,i) is an edge on a shortest path, one hop further than p
+        double dp = INFINITY, w = INFINITY ;
+        OK (GrB_Vector_extractElement (&dp, d, p)) ;
+        OK (GrB_Matrix_extractElement (&w, G->A, p, i)) ;
+        OK (GrB_Vector_extractElement (&hp, hops, p)) ;
+        TEST_CHECK (dp + w == di) ;
+        TEST_CHECK (hp + 1 == h) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_BellmanFord: compare with LAGraph_BF_full1a
+//------------------------------------------------------------------------------
+
+void test_BellmanFord (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector d = NULL, parent = NULL, hops = NULL ;
+        GrB_Vector d1 = NULL, pi1 = NULL, h1 = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        bool has_negative_cycle = files [k].has_negative_cycle ;
+        bool make_dag = files [k].make_dag ;
+        printf ("\nMatrix: %s (dag: %d)\n", aname, make_dag) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        if (make_dag)
+        {
+            // A = -triu (A,1), with negative weights but no cycles
+            OK (GrB_select (A, NULL, NULL, GrB_TRIU, A, 1, NULL)) ;
+            OK (GrB_apply (A, NULL, NULL, GrB_ABS_FP64, A, NULL)) ;
+            OK (GrB_apply (A, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+        }
+
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        int valid = (has_negative_cycle) ? GrB_NO_VALUE : GrB_SUCCESS ;
+
+        for (int trial = 0 ; trial <= 2 ; trial++)
+        {
+            if (trial == 1)
+            {
+                // allow the pull step and the early cycle check
+                OK (LAGraph_Cached_AT (G, msg)) ;
+                OK (LAGraph_Cached_EMin (G, msg)) ;
+            }
+
+            GrB_Index step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+            for (GrB_Index src = 0 ; src < n ; src += step)
+            {
+                int result = LAGr_BellmanFord (&d, &parent, &hops, G, src,
+                    msg) ;
+                printf ("src %d trial %d result: %d\n", (int) src, trial,
+                    result) ;
+                TEST_CHECK (result == valid) ;
+                result = LAGraph_BF_full1a (&d1, &pi1, &h1, G->A, src) ;
+                TEST_CHECK (result == valid) ;
+
+                if (has_negative_cycle)
+                {
+                    TEST_CHECK (d == NULL && parent == NULL && hops == NULL) ;
+                    continue ;
+                }
+
+                // compare the path lengths and hops with LAGraph_BF_full1a
+                for (GrB_Index i = 0 ; i < n ; i++)
+                {
+                    double di = INFINITY, d1i = INFINITY ;
+                    OK (GrB_Vector_extractElement (&di, d, i)) ;
+                    OK (GrB_Vector_extractElement (&d1i, d1, i)) ;
+                    TEST_CHECK (di == d1i) ;
+                    if (d1i < INFINITY)
+                    {
+                        int64_t h = -1 ;
+                        uint64_t h1i = 0 ;
+                        OK (GrB_Vector_extractElement (&h, hops, i)) ;
+                        OK (GrB_Vector_extractElement (&h1i, h1, i)) ;
+                        TEST_CHECK (h == (int64_t) h1i) ;
+                    }
+                }
+                check_tree (d, parent, hops, src, n) ;
+
+                // path lengths only
+                OK (GrB_free (&d)) ;
+                OK (LAGr_BellmanFord (&d, NULL, NULL, G, src, msg)) ;
+                OK (GrB_free (&d)) ;
+                OK (GrB_free (&parent)) ;
+                OK (GrB_free (&hops)) ;
+                OK (GrB_free (&d1)) ;
+                OK (GrB_free (&pi1)) ;
+                OK (GrB_free (&h1)) ;
+            }
+
+            if (trial == 1)
+            {
+                // next trial: push only, with the early cycle check
+                OK (GrB_free (&(G->AT))) ;
+            }
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BellmanFord_errors
+//------------------------------------------------------------------------------
+
+void test_BellmanFord_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector d = NULL ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGr_BellmanFord (NULL, NULL, NULL, G, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGr_BellmanFord (&d, NULL, NULL, G, 1000, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (d == NULL) ;
+
+    // a negative self-edge on the source is a negative-weight cycle
+    OK (GrB_Matrix_setElement_FP64 (G->A, -1, 0, 0)) ;
+    result = LAGr_BellmanFord (&d, NULL, NULL, G, 0, msg) ;
+    TEST_CHECK (result == GrB_NO_VALUE) ;
+    TEST_CHECK (d == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"BellmanFord", test_BellmanFord},
+    {"BellmanFord_errors", test_BellmanFord_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BetweennessApprox.c: test approximate BC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (x - y))
+//------------------------------------------------------------------------------
+
+static double difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    double err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessApprox: compare with the exact betweenness
+//------------------------------------------------------------------------------
+
+void test_BetweennessApprox (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector bc = NULL, bc_exact = NULL ;
+        GrB_Index *sources = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+
+        // exact betweenness, with all nodes as sources
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (LAGraph_Malloc ((void **) &sources, n, sizeof (GrB_Index), msg)) ;
+        for (GrB_Index i = 0 ; i < n ; i++)
+        {
+            sources [i] = i ;
+        }
+        OK (LAGr_Betweenness (&bc_exact, G, sources, n, msg)) ;
+        OK (LAGraph_Free ((void **) &sources, msg)) ;
+
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            double epsilon = (trial == 0) ? 0.05 : 0.02 ;
+            GrB_Index nsamples = 0 ;
+            OK (LAGr_BetweennessApprox (&bc, &nsamples, G, epsilon, 0.1, 16,
+                42 + trial, msg)) ;
+            double err = difference (bc, bc_exact) / (n * (n-1)) ;
+            printf ("epsilon %g: samples %g, err %g\n", epsilon,
+                (double) nsamples, err) ;
+            TEST_CHECK (nsamples > 0 && nsamples % 16 == 0) ;
+            TEST_CHECK (err <= epsilon) ;
+            OK (GrB_free (&bc)) ;
+        }
+
+        OK (GrB_free (&bc_exact)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessApprox_errors
+//------------------------------------------------------------------------------
+
+void test_BetweennessApprox_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector bc = NULL ;
+    GrB_Index nsamples = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // G->AT is required
+    int result = LAGr_BetweennessApprox (&bc, &nsamples, G, 0.1, 0.1, 8, 1,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (bc == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    result = LAGr_BetweennessApprox (NULL, &nsamples, G, 0.1, 0.1, 8, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGr_BetweennessApprox (&bc, &nsamples, G, 0, 0.1, 8, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    result = LAGr_BetweennessApprox (&bc, &nsamples, G, 0.1, 1, 8, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    result = LAGr_BetweennessApprox (&bc, &nsamples, G, 0.1, 0.1, 0, 1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"BetweennessApprox", test_BetweennessApprox},
+    {"BetweennessApprox_errors", test_BetweennessApprox_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BetweennessBounded.c: test bounded BC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (x - y))
+//------------------------------------------------------------------------------
+
+static double difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    double err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessBounded: compare with LAGr_Betweenness
+//------------------------------------------------------------------------------
+
+void test_BetweennessBounded (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector bc = NULL, bc1 = NULL ;
+        GrB_Index sources [4] = { 0, 1, 2, 3 } ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+
+        OK (LAGr_Betweenness (&bc1, G, sources, 4, msg)) ;
+
+        // one level at a time, small blocks, and all levels at once
+        size_t limits [3] = { 0, 1000, SIZE_MAX } ;
+        for (int t = 0 ; t < 3 ; t++)
+        {
+            OK (LAGr_BetweennessBounded (&bc, G, sources, 4, limits [t],
+                msg)) ;
+            double err = difference (bc, bc1) ;
+            printf ("max_bytes %g: err %g\n", (double) limits [t], err) ;
+            TEST_CHECK (err < 1e-8) ;
+            OK (GrB_free (&bc)) ;
+        }
+
+        OK (GrB_free (&bc1)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessBounded_errors
+//------------------------------------------------------------------------------
+
+void test_BetweennessBounded_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector bc = NULL ;
+    GrB_Index sources [2] = { 0, 1 } ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // G->AT is required
+    int result = LAGr_BetweennessBounded (&bc, G, sources, 2, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (bc == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    result = LAGr_BetweennessBounded (&bc, G, NULL, 2, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    sources [1] = 1000 ;
+    result = LAGr_BetweennessBounded (&bc, G, sources, 2, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"BetweennessBounded", test_BetweennessBounded},
+    {"BetweennessBounded_errors", test_BetweennessBounded_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,281 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BetweennessWeighted.c: test weighted BC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (x - y))
+//------------------------------------------------------------------------------
+
+static double difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    double err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// weighted_bc: weighted betweenness, with a new split of G->A
+//------------------------------------------------------------------------------
+
+static void weighted_bc (GrB_Vector *bc, GrB_Index *sources, int32_t ns)
+{
+    GrB_Scalar Delta = NULL ;
+    LAGraph_DeltaSplit Split = NULL ;
+    OK (LAGraph_SSSP_AutoDelta (&Delta, G, msg)) ;
+    OK (LAGraph_DeltaSplit_New (&Split, G, Delta, msg)) ;
+    OK (LAGr_BetweennessWeighted (bc, G, sources, ns, Split, msg)) ;
+    OK (LAGraph_DeltaSplit_Free (&Split, msg)) ;
+    OK (GrB_free (&Delta)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessWeighted: compare with LAGr_Betweenness, with unit weights
+//------------------------------------------------------------------------------
+
+void test_BetweennessWeighted (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL, W = NULL ;
+        GrB_Vector bc = NULL, bc1 = NULL ;
+        GrB_Index sources [4] = { 0, 1, 2, 3 } ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // W = unit weights, in each of the supported types
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+        GrB_Type types [3] = { GrB_FP64, GrB_FP32, GrB_INT64 } ;
+        for (int t = 0 ; t < 3 ; t++)
+        {
+            OK (GrB_Matrix_new (&W, types [t], n, n)) ;
+            OK (GrB_assign (W, A, NULL, 1, GrB_ALL, n, GrB_ALL, n,
+                GrB_DESC_S)) ;
+            OK (LAGraph_New (&G, &W, files [k].kind, msg)) ;
+            OK (LAGraph_Cached_AT (G, msg)) ;
+
+            OK (LAGr_Betweenness (&bc1, G, sources, 4, msg)) ;
+            weighted_bc (&bc, sources, 4) ;
+            double err = difference (bc, bc1) ;
+            printf ("type %d: err %g\n", t, err) ;
+            TEST_CHECK (err < 1e-8) ;
+
+            OK (GrB_free (&bc)) ;
+            OK (GrB_free (&bc1)) ;
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+        OK (GrB_free (&A)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessWeighted_small: a small graph with known results
+//------------------------------------------------------------------------------
+
+void test_BetweennessWeighted_small (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    // 0->1 (1), 1->2 (1), 0->2 (w02), 2->3 (1), from all sources
+    GrB_Index sources [4] = { 0, 1, 2, 3 } ;
+    double w02 [2] = { 3, 2 } ;
+    // with w02 = 3, the path 0->1->2 is the only shortest path to 2;
+    // with w02 = 2, it is tied with the edge 0->2
+    double bc1_expected [2] = { 2, 1 } ;
+    for (int t = 0 ; t < 2 ; t++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector bc = NULL ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, 4, 4)) ;
+        OK (GrB_Matrix_setElement (A, 1, 0, 1)) ;
+        OK (GrB_Matrix_setElement (A, 1, 1, 2)) ;
+        OK (GrB_Matrix_setElement (A, w02 [t], 0, 2)) ;
+        OK (GrB_Matrix_setElement (A, 1, 2, 3)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+        weighted_bc (&bc, sources, 4) ;
+        double x [4] ;
+        for (int i = 0 ; i < 4 ; i++)
+        {
+            x [i] = 0 ;
+            OK (GrB_Vector_extractElement (&(x [i]), bc, i)) ;
+        }
+        printf ("\nw02 %g: bc [%g %g %g %g]\n", w02 [t], x [0], x [1], x [2],
+            x [3]) ;
+        TEST_CHECK (x [0] == 0) ;
+        TEST_CHECK (fabs (x [1] - bc1_expected [t]) < 1e-12) ;
+        TEST_CHECK (fabs (x [2] - 2) < 1e-12) ;
+        TEST_CHECK (x [3] == 0) ;
+
+        OK (GrB_free (&bc)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessWeighted_fp32: small weights far from the source
+//------------------------------------------------------------------------------
+
+void test_BetweennessWeighted_fp32 (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    // W(1:n,1:n) is the karate graph, with a self-edge, and node 0 is joined
+    // to it by the edge 0->1.  All weights are 1e-3 except W(0,1) = 5000, so
+    // the rounding error of the FP32 distances from node 0 (a few ulps of
+    // 5000) is close to the weights.  Edges between nodes at the same
+    // distance, and the self-edge, must not be taken as DAG edges.  U has
+    // the same pattern, with unit weights, so both have the same shortest
+    // paths.
+    GrB_Matrix A = NULL, W = NULL, U = NULL ;
+    GrB_Vector bc = NULL, bc1 = NULL ;
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    GrB_Index n, I [34] ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    TEST_CHECK (n == 34) ;
+    for (int k = 0 ; k < 34 ; k++)
+    {
+        I [k] = k + 1 ;
+    }
+    OK (GrB_Matrix_new (&W, GrB_FP32, n+1, n+1)) ;
+    OK (GrB_assign (W, NULL, NULL, A, I, n, I, n, NULL)) ;
+    OK (GrB_Matrix_setElement (W, 1, 5, 5)) ;
+    OK (GrB_assign (W, W, NULL, (float) 1e-3, GrB_ALL, n+1, GrB_ALL, n+1,
+        GrB_DESC_S)) ;
+    OK (GrB_Matrix_setElement (W, (float) 5000, 0, 1)) ;
+    OK (GrB_Matrix_new (&U, GrB_FP64, n+1, n+1)) ;
+    OK (GrB_assign (U, W, NULL, 1, GrB_ALL, n+1, GrB_ALL, n+1, GrB_DESC_S)) ;
+
+    GrB_Index sources [4] = { 0, 1, 5, 20 } ;
+    OK (LAGraph_New (&G, &U, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGr_Betweenness (&bc1, G, sources, 4, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    OK (LAGraph_New (&G, &W, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    weighted_bc (&bc, sources, 4) ;
+    double err = difference (bc, bc1) ;
+    printf ("\nfp32: err %g\n", err) ;
+    TEST_CHECK (err < 1e-8) ;
+
+    OK (GrB_free (&bc)) ;
+    OK (GrB_free (&bc1)) ;
+    OK (GrB_free (&A)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessWeighted_errors
+//------------------------------------------------------------------------------
+
+void test_BetweennessWeighted_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector bc = NULL ;
+    GrB_Scalar Delta = NULL ;
+    LAGraph_DeltaSplit Split = NULL ;
+    GrB_Index sources [2] = { 0, 1 } ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 3, 3)) ;
+    OK (GrB_Matrix_setElement (A, 1, 0, 1)) ;
+    OK (GrB_Matrix_setElement (A, -1, 1, 2)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (GrB_Scalar_new (&Delta, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement (Delta, 1)) ;
+    OK (LAGraph_DeltaSplit_New (&Split, G, Delta, msg)) ;
+
+    int result = LAGr_BetweennessWeighted (NULL, G, sources, 2, Split, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGr_BetweennessWeighted (&bc, G, sources, 0, Split, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // edge weights must be positive
+    result = LAGr_BetweennessWeighted (&bc, G, sources, 2, Split, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (bc == NULL) ;
+
+    OK (LAGraph_DeltaSplit_Free (&Split, msg)) ;
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"BetweennessWeighted", test_BetweennessWeighted},
+    {"BetweennessWeighted_small", test_BetweennessWeighted_small},
+    {"BetweennessWeighted_fp32", test_BetweennessWeighted_fp32},
+    {"BetweennessWeighted_errors", test_BetweennessWeighted_errors},
+    {NULL, NULL}
+} ;
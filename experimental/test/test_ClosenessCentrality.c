@@ -0,0 +1,214 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_ClosenessCentrality.c: test closeness
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (x - y))
+//------------------------------------------------------------------------------
+
+static double difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    double err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// brute_force: closeness and harmonic centrality from n single-source BFS
+//------------------------------------------------------------------------------
+
+static void brute_force
+(
+    GrB_Vector *closeness,
+    GrB_Vector *harmonic,
+    LAGraph_Graph G
+)
+{
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (GrB_Vector_new (closeness, GrB_FP64, n)) ;
+    OK (GrB_Vector_new (harmonic, GrB_FP64, n)) ;
+    GrB_Index *I = NULL ;
+    int64_t *X = NULL ;
+    OK (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &X, n, sizeof (int64_t), msg)) ;
+    for (GrB_Index v = 0 ; v < n ; v++)
+    {
+        GrB_Vector level = NULL ;
+        OK (LAGr_BreadthFirstSearch (&level, NULL, G, v, msg)) ;
+        GrB_Index nvals = n ;
+        OK (GrB_Vector_extractTuples_INT64 (I, X, &nvals, level)) ;
+        double r = 0, s = 0, h = 0 ;
+        for (GrB_Index k = 0 ; k < nvals ; k++)
+        {
+            if (X [k] == 0) continue ;
+            r++ ;
+            s += X [k] ;
+            h += 1.0 / X [k] ;
+        }
+        double c = (s > 0) ? ((r / (n-1)) * (r / s)) : 0 ;
+        OK (GrB_Vector_setElement (*closeness, c, v)) ;
+        OK (GrB_Vector_setElement (*harmonic, h, v)) ;
+        OK (GrB_free (&level)) ;
+    }
+    OK (LAGraph_Free ((void **) &I, msg)) ;
+    OK (LAGraph_Free ((void **) &X, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_ClosenessCentrality: compare with n single-source searches
+//------------------------------------------------------------------------------
+
+void test_ClosenessCentrality (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector c = NULL, h = NULL, c_exact = NULL, h_exact = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        brute_force (&c_exact, &h_exact, G) ;
+
+        // exact mode, also with nsamples >= n
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            GrB_Index nsamples = (trial == 0) ? 0 : n ;
+            OK (LAGr_ClosenessCentrality (&c, G, nsamples, 1, msg)) ;
+            OK (LAGr_HarmonicCentrality (&h, G, nsamples, 1, msg)) ;
+            GrB_Index nvals ;
+            OK (GrB_Vector_nvals (&nvals, c)) ;
+            TEST_CHECK (nvals == n) ;
+            double cerr = difference (c, c_exact) ;
+            double herr = difference (h, h_exact) ;
+            printf ("exact: closeness err %g, harmonic err %g\n", cerr, herr) ;
+            TEST_CHECK (cerr < 1e-10) ;
+            TEST_CHECK (herr < 1e-10) ;
+            OK (GrB_free (&c)) ;
+            OK (GrB_free (&h)) ;
+        }
+
+        // sampled mode: closeness is in [0,1], harmonic in [0,n-1]
+        GrB_Index nsamples = n/2 + 1 ;
+        OK (LAGr_ClosenessCentrality (&c, G, nsamples, 42, msg)) ;
+        OK (LAGr_HarmonicCentrality (&h, G, nsamples, 42, msg)) ;
+        double cerr = difference (c, c_exact) ;
+        double herr = difference (h, h_exact) / (n-1) ;
+        printf ("sampled (%g): closeness err %g, harmonic err %g\n",
+            (double) nsamples, cerr, herr) ;
+        TEST_CHECK (cerr < 0.5) ;
+        TEST_CHECK (herr < 0.5) ;
+        OK (GrB_free (&c)) ;
+        OK (GrB_free (&h)) ;
+
+        OK (GrB_free (&c_exact)) ;
+        OK (GrB_free (&h_exact)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_ClosenessCentrality_errors
+//------------------------------------------------------------------------------
+
+void test_ClosenessCentrality_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector c = NULL ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // G->AT is required
+    int result = LAGr_ClosenessCentrality (&c, G, 0, 1, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (c == NULL) ;
+    result = LAGr_HarmonicCentrality (&c, G, 8, 1, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (c == NULL) ;
+
+    result = LAGr_ClosenessCentrality (NULL, G, 0, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGr_HarmonicCentrality (NULL, G, 0, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"ClosenessCentrality", test_ClosenessCentrality},
+    {"ClosenessCentrality_errors", test_ClosenessCentrality_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,176 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_DeltaSplit.c: test SSSP with a cached split
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "jagmesh7.mtx",
+    "ldbc-directed-example.mtx",
+    "ldbc-undirected-example.mtx",
+    "west0067.mtx",
+    "karate.mtx",
+    "test_BF.mtx",
+    "test_FW_1000.mtx",
+    "skew_fp32.mtx",
+    "matrix_uint32.mtx",
+    ""
+} ;
+
+// load a matrix, and make all its entries positive
+static void load (const char *aname)
+{
+    GrB_Matrix A = NULL ;
+    snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (GrB_apply (A, NULL, NULL, GrB_ABS_FP64, A, NULL)) ;
+    OK (GrB_Matrix_select_FP64 (A, NULL, NULL, GrB_VALUENE_FP64, A, 0,
+        NULL)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_DeltaSplit: LAGr_SingleSourceShortestPath_Split and auto Delta
+//------------------------------------------------------------------------------
+
+void test_DeltaSplit (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        load (aname) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // select Delta, and check it against the cached edge weights
+        GrB_Scalar Delta = NULL ;
+        OK (LAGraph_SSSP_AutoDelta (&Delta, G, msg)) ;
+        TEST_CHECK (G->emin != NULL && G->emax != NULL) ;
+        double delta = 0, emin = 0, emax = 0 ;
+        OK (GrB_Scalar_extractElement_FP64 (&delta, Delta)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+        OK (GrB_Scalar_extractElement_FP64 (&emax, G->emax)) ;
+        printf ("Delta: %g (emin %g, emax %g)\n", delta, emin, emax) ;
+        TEST_CHECK (delta > 0 && delta >= emin) ;
+
+        // build the split once, and use it for several sources
+        LAGraph_DeltaSplit Split = NULL ;
+        OK (LAGraph_DeltaSplit_New (&Split, G, Delta, msg)) ;
+        GrB_Index nvals, nl, nh ;
+        OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+        OK (GrB_Matrix_nvals (&nl, Split->AL)) ;
+        OK (GrB_Matrix_nvals (&nh, Split->AH)) ;
+        TEST_CHECK (nl + nh == nvals) ;
+
+        int64_t step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+        for (int64_t src = 0 ; src < n ; src += step)
+        {
+            GrB_Vector path_length = NULL ;
+            OK (LAGr_SingleSourceShortestPath_Split (&path_length, G, src,
+                Split, msg)) ;
+            OK (LG_check_sssp (path_length, G, src, msg)) ;
+            OK (GrB_free (&path_length)) ;
+
+            // the Basic method gives the same result
+            OK (LAGraph_SingleSourceShortestPath (&path_length, G, src, msg)) ;
+            OK (LG_check_sssp (path_length, G, src, msg)) ;
+            OK (GrB_free (&path_length)) ;
+        }
+
+        OK (LAGraph_DeltaSplit_Free (&Split, msg)) ;
+        TEST_CHECK (Split == NULL) ;
+        OK (LAGraph_DeltaSplit_Free (&Split, msg)) ;
+        OK (GrB_free (&Delta)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_DeltaSplit_errors
+//------------------------------------------------------------------------------
+
+void test_DeltaSplit_errors (void)
+{
+    LAGraph_Init (msg) ;
+    load ("karate.mtx") ;
+
+    GrB_Scalar Delta = NULL ;
+    GrB_Vector path_length = NULL ;
+    LAGraph_DeltaSplit Split = NULL ;
+
+    int result = LAGraph_SSSP_AutoDelta (NULL, G, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // Delta is empty
+    OK (GrB_Scalar_new (&Delta, GrB_FP64)) ;
+    result = LAGraph_DeltaSplit_New (&Split, G, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_EMPTY_OBJECT) ;
+    TEST_CHECK (Split == NULL) ;
+
+    result = LAGr_SingleSourceShortestPath_Split (&path_length, G, 0, NULL,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // invalid source
+    OK (GrB_Scalar_setElement_FP64 (Delta, 2)) ;
+    OK (LAGraph_DeltaSplit_New (&Split, G, Delta, msg)) ;
+    result = LAGr_SingleSourceShortestPath_Split (&path_length, G, 1000,
+        Split, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (path_length == NULL) ;
+
+    // the split does not match the graph
+    OK (LAGraph_Delete (&G, msg)) ;
+    load ("west0067.mtx") ;
+    result = LAGr_SingleSourceShortestPath_Split (&path_length, G, 0,
+        Split, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+
+    OK (LAGraph_DeltaSplit_Free (&Split, msg)) ;
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+//****************************************************************************
+TEST_LIST = {
+    {"DeltaSplit", test_DeltaSplit},
+    {"DeltaSplit_errors", test_DeltaSplit_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_DistanceOracle.c: test the distance oracle
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char filename [LEN+1] ;
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define TOL 1e-10
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    bool weighted ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, 0, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   1, "test_BF.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   1, "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   0, "ldbc-directed-example.mtx", // unreachable
+    LAGraph_ADJACENCY_DIRECTED,   0, "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, 0, "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   0, ""
+} ;
+
+//------------------------------------------------------------------------------
+// test_DistanceOracle: compare with LAGr_BellmanFord and LAGr_BreadthFirstSearch
+//------------------------------------------------------------------------------
+
+void test_DistanceOracle (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector d = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        bool weighted = files [k].weighted ;
+        printf ("\nMatrix: %s (weighted: %d)\n", aname, weighted) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        for (int method = 0 ; method <= 1 ; method++)
+        {
+            for (int64_t nlandmarks = 1 ; nlandmarks <= 4 ; nlandmarks *= 2)
+            {
+                LAGraph_DistanceOracle Oracle = NULL ;
+                OK (LAGraph_DistanceOracleBuild (&Oracle, G, nlandmarks,
+                    (LAGraph_Landmark_Method) method, weighted, 42, msg)) ;
+                TEST_CHECK (Oracle->k == nlandmarks && Oracle->n == n) ;
+
+                for (GrB_Index u = 0 ; u < n ; u++)
+                {
+                    // d = the exact distances from u
+                    if (weighted)
+                    {
+                        OK (LAGr_BellmanFord (&d, NULL, NULL, G, u, msg)) ;
+                    }
+                    else
+                    {
+                        OK (LAGr_BreadthFirstSearch (&d, NULL, G, u, msg)) ;
+                    }
+
+                    for (GrB_Index v = 0 ; v < n ; v++)
+                    {
+                        double duv = INFINITY, lower, upper, dist ;
+                        int result = GrB_Vector_extractElement (&duv, d, v) ;
+                        TEST_CHECK (result == GrB_SUCCESS ||
+                            result == GrB_NO_VALUE) ;
+                        OK (LAGraph_DistanceOracleQuery (&lower, &upper,
+                            Oracle, u, v, msg)) ;
+                        // allow for roundoff in the sums through a landmark
+                        TEST_CHECK (lower <= duv + TOL && duv <= upper + TOL) ;
+                        OK (LAGraph_DistanceOracleShortestPath (&dist, Oracle,
+                            G, u, v, msg)) ;
+                        TEST_CHECK (dist == duv || fabs (dist - duv) <= TOL) ;
+                    }
+                    OK (GrB_free (&d)) ;
+                }
+
+                // the distance from a landmark is exact
+                GrB_Index t = Oracle->landmarks [0] ;
+                for (GrB_Index v = 0 ; v < n ; v++)
+                {
+                    double lower, upper ;
+                    OK (LAGraph_DistanceOracleQuery (&lower, &upper, Oracle,
+                        t, v, msg)) ;
+                    TEST_CHECK (lower == upper) ;
+                }
+
+                OK (LAGraph_DistanceOracle_Free (&Oracle, msg)) ;
+                TEST_CHECK (Oracle == NULL) ;
+            }
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_DistanceOracle_errors
+//------------------------------------------------------------------------------
+
+void test_DistanceOracle_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    LAGraph_DistanceOracle Oracle = NULL ;
+    double lower, upper, dist ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int result = LAGraph_DistanceOracleBuild (NULL, G, 4,
+        LAGraph_LANDMARKS_DEGREE, false, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGraph_DistanceOracleBuild (&Oracle, G, 0,
+        LAGraph_LANDMARKS_DEGREE, false, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE && Oracle == NULL) ;
+
+    result = LAGraph_DistanceOracleBuild (&Oracle, G, 4,
+        (LAGraph_Landmark_Method) 42, false, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE && Oracle == NULL) ;
+
+    // west0067 has negative edge weights
+    result = LAGraph_DistanceOracleBuild (&Oracle, G, 4,
+        LAGraph_LANDMARKS_DEGREE, true, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE && Oracle == NULL) ;
+
+    OK (LAGraph_DistanceOracleBuild (&Oracle, G, 4,
+        LAGraph_LANDMARKS_DEGREE, false, 0, msg)) ;
+    result = LAGraph_DistanceOracleQuery (&lower, &upper, Oracle, 0, 1000,
+        msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    result = LAGraph_DistanceOracleQuery (NULL, &upper, Oracle, 0, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_DistanceOracleShortestPath (&dist, Oracle, G, 1000, 0,
+        msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    OK (LAGraph_DistanceOracle_Free (&Oracle, msg)) ;
+    OK (LAGraph_DistanceOracle_Free (NULL, msg)) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"DistanceOracle", test_DistanceOracle},
+    {"DistanceOracle_errors", test_DistanceOracle_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,323 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Generate.c: test synthetic graph generators
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, G2 = NULL ;
+
+//------------------------------------------------------------------------------
+// check_graph: check the basic properties of a generated graph
+//------------------------------------------------------------------------------
+
+static GrB_Index check_graph (LAGraph_Graph H, GrB_Index n)
+{
+    GrB_Index nrows, nvals ;
+    OK (LAGraph_CheckGraph (H, msg)) ;
+    OK (GrB_Matrix_nrows (&nrows, H->A)) ;
+    OK (GrB_Matrix_nvals (&nvals, H->A)) ;
+    TEST_CHECK (nrows == n) ;
+
+    // no self-edges
+    TEST_CHECK (H->nself_edges == 0) ;
+    H->nself_edges = LAGRAPH_UNKNOWN ;
+    OK (LAGraph_Cached_NSelfEdges (H, msg)) ;
+    TEST_CHECK (H->nself_edges == 0) ;
+
+    // an undirected graph must be symmetric
+    if (H->kind == LAGraph_ADJACENCY_UNDIRECTED)
+    {
+        GrB_Matrix AT = NULL ;
+        bool ok ;
+        OK (GrB_Matrix_new (&AT, GrB_BOOL, n, n)) ;
+        OK (GrB_transpose (AT, NULL, NULL, H->A, NULL)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, AT, H->A, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&AT)) ;
+    }
+    return (nvals) ;
+}
+
+//------------------------------------------------------------------------------
+// check_same: check if two generated graphs are the same
+//------------------------------------------------------------------------------
+
+static bool check_same (LAGraph_Graph G1, LAGraph_Graph G2)
+{
+    bool ok ;
+    OK (LAGraph_Matrix_IsEqual (&ok, G1->A, G2->A, msg)) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Generate_Grid
+//------------------------------------------------------------------------------
+
+void test_Generate_Grid (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    // 4-by-5 grid: 3*5 + 4*4 = 31 edges
+    OK (LAGraph_Generate_Grid (&G, 4, 5, 1, msg)) ;
+    TEST_CHECK (check_graph (G, 20) == 62) ;
+    bool x ;
+    OK (GrB_Matrix_extractElement (&x, G->A, 0, 1)) ;
+    OK (GrB_Matrix_extractElement (&x, G->A, 0, 4)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // 3-by-3-by-3 grid: 3 * (2*9) = 54 edges
+    OK (LAGraph_Generate_Grid (&G, 3, 3, 3, msg)) ;
+    TEST_CHECK (check_graph (G, 27) == 108) ;
+    OK (GrB_Matrix_extractElement (&x, G->A, 4, 13)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // a single node
+    OK (LAGraph_Generate_Grid (&G, 1, 1, 1, msg)) ;
+    TEST_CHECK (check_graph (G, 1) == 0) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // error handling
+    int result = LAGraph_Generate_Grid (&G, 0, 5, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (G == NULL) ;
+    result = LAGraph_Generate_Grid (NULL, 4, 5, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Generate_ErdosRenyi
+//------------------------------------------------------------------------------
+
+void test_Generate_ErdosRenyi (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    int nthreads_outer, nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+
+    // undirected G(n,p): about p*n*(n-1)/2 edges
+    GrB_Index n = 2000 ;
+    double p = 0.01 ;
+    OK (LAGraph_Generate_ErdosRenyi (&G, n, p, LAGraph_ADJACENCY_UNDIRECTED,
+        42, msg)) ;
+    GrB_Index nvals = check_graph (G, n) ;
+    double expected = p * n * (n-1) ;
+    printf ("\nG(n,p): nvals %g expected %g\n", (double) nvals, expected) ;
+    TEST_CHECK (fabs (nvals - expected) < 0.05 * expected) ;
+
+    // the same graph with one thread
+    OK (LAGraph_SetNumThreads (1, 1, msg)) ;
+    OK (LAGraph_Generate_ErdosRenyi (&G2, n, p, LAGraph_ADJACENCY_UNDIRECTED,
+        42, msg)) ;
+    OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner, msg)) ;
+    TEST_CHECK (check_same (G, G2)) ;
+    OK (LAGraph_Delete (&G2, msg)) ;
+
+    // a different seed gives a different graph
+    OK (LAGraph_Generate_ErdosRenyi (&G2, n, p, LAGraph_ADJACENCY_UNDIRECTED,
+        43, msg)) ;
+    TEST_CHECK (!check_same (G, G2)) ;
+    OK (LAGraph_Delete (&G2, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // directed G(n,p)
+    OK (LAGraph_Generate_ErdosRenyi (&G, n, p, LAGraph_ADJACENCY_DIRECTED,
+        42, msg)) ;
+    nvals = check_graph (G, n) ;
+    TEST_CHECK (fabs (nvals - expected) < 0.05 * expected) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // p = 0 and p = 1
+    OK (LAGraph_Generate_ErdosRenyi (&G, 50, 0, LAGraph_ADJACENCY_DIRECTED,
+        42, msg)) ;
+    TEST_CHECK (check_graph (G, 50) == 0) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Generate_ErdosRenyi (&G, 50, 1, LAGraph_ADJACENCY_DIRECTED,
+        42, msg)) ;
+    TEST_CHECK (check_graph (G, 50) == 50 * 49) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Generate_ErdosRenyi (&G, 50, 1, LAGraph_ADJACENCY_UNDIRECTED,
+        42, msg)) ;
+    TEST_CHECK (check_graph (G, 50) == 50 * 49) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // error handling
+    int result = LAGraph_Generate_ErdosRenyi (&G, n, 1.5,
+        LAGraph_ADJACENCY_DIRECTED, 42, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_Generate_ErdosRenyi (&G, 0, p,
+        LAGraph_ADJACENCY_DIRECTED, 42, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Generate_SBM
+//------------------------------------------------------------------------------
+
+void test_Generate_SBM (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    // 4 blocks with no edges between them
+    GrB_Index n = 1001 ;
+    int nblocks = 4 ;
+    OK (LAGraph_Generate_SBM (&G, n, nblocks, 0.05, 0,
+        LAGraph_ADJACENCY_UNDIRECTED, 7, msg)) ;
+    GrB_Index nvals = check_graph (G, n) ;
+    TEST_CHECK (nvals > 0) ;
+    GrB_Index *I = NULL, *J = NULL ;
+    OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    OK (GrB_Matrix_extractTuples_BOOL (I, J, NULL, &nvals, G->A)) ;
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        // node i is in block b if b*n/nblocks <= i < (b+1)*n/nblocks
+        int64_t bi = ((I [k] + 1) * nblocks - 1) / n ;
+        int64_t bj = ((J [k] + 1) * nblocks - 1) / n ;
+        TEST_CHECK (bi == bj) ;
+        TEST_CHECK ((bi * n) / nblocks <= I [k]) ;
+        TEST_CHECK (I [k] < ((bi+1) * n) / nblocks) ;
+    }
+    LAGraph_Free ((void **) &I, NULL) ;
+    LAGraph_Free ((void **) &J, NULL) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // each block is a clique, with a few edges between blocks
+    OK (LAGraph_Generate_SBM (&G, 100, 5, 1, 0.01,
+        LAGraph_ADJACENCY_DIRECTED, 7, msg)) ;
+    nvals = check_graph (G, 100) ;
+    TEST_CHECK (nvals > 5 * 20 * 19) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // error handling
+    int result = LAGraph_Generate_SBM (&G, n, 0, 0.5, 0.5,
+        LAGraph_ADJACENCY_DIRECTED, 7, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_Generate_SBM (&G, n, 4, 0.5, -1,
+        LAGraph_ADJACENCY_DIRECTED, 7, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_Generate_SBM (&G, n, 4, 0.5, 0.5,
+        LAGraph_KIND_UNKNOWN, 7, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Generate_RMAT
+//------------------------------------------------------------------------------
+
+void test_Generate_RMAT (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    int nthreads_outer, nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+
+    // Graph500 parameters, scale 12
+    int scale = 12, edgefactor = 16 ;
+    GrB_Index n = 1 << scale ;
+    OK (LAGraph_Generate_RMAT (&G, scale, edgefactor, 0.57, 0.19, 0.19,
+        LAGraph_ADJACENCY_UNDIRECTED, 1, msg)) ;
+    GrB_Index nvals = check_graph (G, n) ;
+    printf ("\nRMAT: n %g nvals %g\n", (double) n, (double) nvals) ;
+    TEST_CHECK (nvals > edgefactor * n && nvals <= 2 * edgefactor * n) ;
+
+    // the degrees are skewed
+    int64_t maxdeg ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    OK (GrB_reduce (&maxdeg, NULL, GrB_MAX_MONOID_INT64, G->out_degree,
+        NULL)) ;
+    TEST_CHECK (maxdeg > 20 * (nvals / n)) ;
+
+    // the same graph with one thread
+    OK (LAGraph_SetNumThreads (1, 1, msg)) ;
+    OK (LAGraph_Generate_RMAT (&G2, scale, edgefactor, 0.57, 0.19, 0.19,
+        LAGraph_ADJACENCY_UNDIRECTED, 1, msg)) ;
+    OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner, msg)) ;
+    TEST_CHECK (check_same (G, G2)) ;
+    OK (LAGraph_Delete (&G2, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // uniform quadrants and a directed graph
+    OK (LAGraph_Generate_RMAT (&G, 8, 4, 0.25, 0.25, 0.25,
+        LAGraph_ADJACENCY_DIRECTED, 1, msg)) ;
+    nvals = check_graph (G, 256) ;
+    TEST_CHECK (nvals > 0 && nvals <= 4 * 256) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // error handling
+    int result = LAGraph_Generate_RMAT (&G, 0, 16, 0.57, 0.19, 0.19,
+        LAGraph_ADJACENCY_UNDIRECTED, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_Generate_RMAT (&G, 4, 16, 0.57, 0.5, 0.19,
+        LAGraph_ADJACENCY_UNDIRECTED, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Generate_ChungLu
+//------------------------------------------------------------------------------
+
+void test_Generate_ChungLu (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    GrB_Index n = 10000 ;
+    double avg_degree = 10 ;
+    OK (LAGraph_Generate_ChungLu (&G, n, avg_degree, 2.5,
+        LAGraph_ADJACENCY_UNDIRECTED, 3, msg)) ;
+    GrB_Index nvals = check_graph (G, n) ;
+    printf ("\nChung-Lu: avg degree %g\n", ((double) nvals) / n) ;
+    TEST_CHECK (nvals <= avg_degree * n && nvals > 0.5 * avg_degree * n) ;
+
+    // node 0 has the largest expected degree
+    int64_t d0 = 0, dlast = 0, maxdeg ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    OK (GrB_Vector_extractElement (&d0, G->out_degree, 0)) ;
+    GrB_Vector_extractElement (&dlast, G->out_degree, n-1) ;
+    OK (GrB_reduce (&maxdeg, NULL, GrB_MAX_MONOID_INT64, G->out_degree,
+        NULL)) ;
+    printf ("degree of first node %g, last node %g\n", (double) d0,
+        (double) dlast) ;
+    TEST_CHECK (d0 > 10 * avg_degree && d0 > dlast) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // error handling
+    int result = LAGraph_Generate_ChungLu (&G, n, avg_degree, 1,
+        LAGraph_ADJACENCY_UNDIRECTED, 3, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+//****************************************************************************
+TEST_LIST = {
+    {"Generate_Grid", test_Generate_Grid},
+    {"Generate_ErdosRenyi", test_Generate_ErdosRenyi},
+    {"Generate_SBM", test_Generate_SBM},
+    {"Generate_RMAT", test_Generate_RMAT},
+    {"Generate_ChungLu", test_Generate_ChungLu},
+    {NULL, NULL}
+};
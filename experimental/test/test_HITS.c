@@ -5,6 +5,7 @@
 #include <stdio.h>
 #include <acutest.h>
 #include "LAGraph_test.h"
+#include <LAGraphX.h>
 
 #define LEN 512
 char msg[LAGRAPH_MSG_LEN];
@@ -26,6 +27,18 @@ float difference(GrB_Vector vector, double *expected_result, GrB_Index n) {
     return err;
 }
 
+// Utility function to compare two vectors
+float vector_difference(GrB_Vector x, GrB_Vector y, GrB_Index n) {
+    GrB_Vector diff = NULL;
+    float err = 0.0;
+    OK(GrB_Vector_new(&diff, GrB_FP32, n));
+    OK(GrB_eWiseAdd(diff, NULL, NULL, GrB_MINUS_FP32, x, y, NULL));
+    OK(GrB_apply(diff, NULL, NULL, GrB_ABS_FP32, diff, NULL));
+    OK(GrB_reduce(&err, NULL, GrB_MAX_MONOID_FP32, diff, NULL));
+    OK(GrB_free(&diff));
+    return err;
+}
+
 // Test function for a specific graph
 void test_HITS_on_graph(const char *graph_file, double *expected_hubs, double *expected_authorities, GrB_Index n) {
     GrB_Vector hubs = NULL, authorities = NULL;
@@ -305,9 +318,104 @@ void test_HITS(void) {
     LAGraph_Finalize(msg);
 }
 
+// Compare LAGr_HITSFused with LAGr_HITS
+void test_HITSFused(void) {
+    LAGraph_Init(msg);
+    const char *files[] = {"structure.mtx", "karate.mtx", "west0067.mtx",
+        "ldbc-directed-example.mtx", ""};
+    for (int k = 0; strlen(files[k]) > 0; k++) {
+        GrB_Vector hubs = NULL, authorities = NULL, h = NULL, a = NULL,
+            a0 = NULL;
+        GrB_Matrix A = NULL;
+        int iters = 0, iters1 = 0;
+        printf("\nMatrix: %s\n", files[k]);
+        snprintf(filename, LEN, LG_DATA_DIR "%s", files[k]);
+        FILE *f = fopen(filename, "r");
+        TEST_CHECK(f != NULL);
+        OK(LAGraph_MMRead(&A, f, msg));
+        OK(fclose(f));
+        OK(LAGraph_New(&G, &A, LAGraph_ADJACENCY_DIRECTED, msg));
+        OK(LAGraph_Cached_AT(G, msg));
+        GrB_Index n;
+        OK(GrB_Matrix_nrows(&n, G->A));
+        OK(LAGr_HITS(&hubs, &authorities, &iters1, G, 1e-6, 1000, msg));
+
+        // cold start: same result as LAGr_HITS
+        OK(LAGr_HITSFused(&h, &a, &iters, G, NULL, 1e-6, 0, 1000, msg));
+        float err_hubs = vector_difference(h, hubs, n);
+        float err_auth = vector_difference(a, authorities, n);
+        printf("fused: iters %d (HITS: %d) err %g %g\n", iters, iters1,
+            err_hubs, err_auth);
+        TEST_CHECK(err_hubs < 1e-4 && err_auth < 1e-4);
+        OK(GrB_free(&h));
+
+        // warm start from the result: converges at once
+        int iters2 = 0;
+        OK(GrB_Vector_dup(&a0, a));
+        OK(GrB_free(&a));
+        OK(LAGr_HITSFused(&h, &a, &iters2, G, a0, 1e-6, 0, 1000, msg));
+        printf("warm start: iters %d\n", iters2);
+        TEST_CHECK(iters2 <= iters);
+        OK(GrB_free(&a0));
+        OK(GrB_free(&h));
+        OK(GrB_free(&a));
+
+        // per-node freezing: a small loss of accuracy
+        OK(LAGr_HITSFused(&h, &a, &iters, G, NULL, 1e-6, 1e-7, 1000, msg));
+        err_hubs = vector_difference(h, hubs, n);
+        err_auth = vector_difference(a, authorities, n);
+        printf("frozen: iters %d err %g %g\n", iters, err_hubs, err_auth);
+        TEST_CHECK(err_hubs < 1e-3 && err_auth < 1e-3);
+
+        OK(GrB_free(&h));
+        OK(GrB_free(&a));
+        OK(GrB_free(&hubs));
+        OK(GrB_free(&authorities));
+        OK(LAGraph_Delete(&G, msg));
+    }
+    LAGraph_Finalize(msg);
+}
+
+// Error handling of LAGr_HITSFused
+void test_HITSFused_errors(void) {
+    LAGraph_Init(msg);
+    GrB_Vector h = NULL, a = NULL, a0 = NULL;
+    GrB_Matrix A = NULL;
+    int iters = 0;
+    snprintf(filename, LEN, LG_DATA_DIR "%s", "west0067.mtx");
+    FILE *f = fopen(filename, "r");
+    TEST_CHECK(f != NULL);
+    OK(LAGraph_MMRead(&A, f, msg));
+    OK(fclose(f));
+    OK(LAGraph_New(&G, &A, LAGraph_ADJACENCY_DIRECTED, msg));
+
+    int result = LAGr_HITSFused(NULL, &a, &iters, G, NULL, 1e-4, 0, 100, msg);
+    TEST_CHECK(result == GrB_NULL_POINTER);
+
+    result = LAGr_HITSFused(&h, &a, &iters, G, NULL, 1e-4, -1, 100, msg);
+    printf("\nresult: %d %s\n", result, msg);
+    TEST_CHECK(result == GrB_INVALID_VALUE);
+
+    OK(GrB_Vector_new(&a0, GrB_FP32, 3));
+    result = LAGr_HITSFused(&h, &a, &iters, G, a0, 1e-4, 0, 100, msg);
+    printf("result: %d %s\n", result, msg);
+    TEST_CHECK(result == GrB_DIMENSION_MISMATCH);
+    OK(GrB_free(&a0));
+
+    result = LAGr_HITSFused(&h, &a, &iters, G, NULL, 1e-4, 0, 2, msg);
+    printf("result: %d %s\n", result, msg);
+    TEST_CHECK(result == LAGRAPH_CONVERGENCE_FAILURE);
+    TEST_CHECK(h == NULL && a == NULL);
+
+    OK(LAGraph_Delete(&G, msg));
+    LAGraph_Finalize(msg);
+}
+
 // List of tests to run
 TEST_LIST = {
     {"test_HITS", test_HITS},
+    {"test_HITSFused", test_HITSFused},
+    {"test_HITSFused_errors", test_HITSFused_errors},
     {NULL, NULL}
 };
 
@@ -0,0 +1,162 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MultiSourceShortestPath.c: test batched SSSP
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "jagmesh7.mtx",
+    "ldbc-directed-example.mtx",
+    "west0067.mtx",
+    "karate.mtx",
+    "test_BF.mtx",
+    "skew_fp32.mtx",
+    "matrix_uint64.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// test_MultiSourceShortestPath
+//------------------------------------------------------------------------------
+
+void test_MultiSourceShortestPath (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, D = NULL ;
+    GrB_Vector path_length = NULL ;
+    GrB_Scalar Delta = NULL ;
+    LAGraph_DeltaSplit Split = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // ensure all entries are positive
+        OK (GrB_apply (A, NULL, NULL, GrB_ABS_FP64, A, NULL)) ;
+        OK (GrB_Matrix_select_FP64 (A, NULL, NULL, GrB_VALUENE_FP64, A, 0,
+            NULL)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        OK (LAGraph_SSSP_AutoDelta (&Delta, G, msg)) ;
+        OK (LAGraph_DeltaSplit_New (&Split, G, Delta, msg)) ;
+
+        // sources: a few distinct vertices, and a duplicate
+        GrB_Index sources [5] ;
+        int64_t ns = 0 ;
+        for (int64_t src = 0 ; src < n && ns < 4 ; src += (n/4) + 1)
+        {
+            sources [ns++] = src ;
+        }
+        sources [ns++] = 0 ;
+
+        OK (LAGr_MultiSourceShortestPath (&D, G, sources, ns, Split, msg)) ;
+        GrB_Index nrows, ncols ;
+        OK (GrB_Matrix_nrows (&nrows, D)) ;
+        OK (GrB_Matrix_ncols (&ncols, D)) ;
+        TEST_CHECK (nrows == ns && ncols == n) ;
+
+        // check each row against the single-source result
+        GrB_Type etype ;
+        char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+        OK (LAGraph_Matrix_TypeName (atype_name, G->A, msg)) ;
+        OK (LAGraph_TypeFromName (&etype, atype_name, msg)) ;
+        for (int64_t i = 0 ; i < ns ; i++)
+        {
+            OK (GrB_Vector_new (&path_length, etype, n)) ;
+            OK (GrB_Col_extract (path_length, NULL, NULL, D, GrB_ALL, n, i,
+                GrB_DESC_T0)) ;
+            int res = LG_check_sssp (path_length, G, sources [i], msg) ;
+            if (res != GrB_SUCCESS) printf ("res: %d msg: %s\n", res, msg) ;
+            OK (res) ;
+            OK (GrB_free (&path_length)) ;
+        }
+
+        OK (GrB_free (&D)) ;
+        OK (LAGraph_DeltaSplit_Free (&Split, msg)) ;
+        OK (GrB_free (&Delta)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_MultiSourceShortestPath_errors
+//------------------------------------------------------------------------------
+
+void test_MultiSourceShortestPath_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, D = NULL ;
+    GrB_Scalar Delta = NULL ;
+    LAGraph_DeltaSplit Split = NULL ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_SSSP_AutoDelta (&Delta, G, msg)) ;
+    OK (LAGraph_DeltaSplit_New (&Split, G, Delta, msg)) ;
+
+    GrB_Index sources [2] = { 0, 1000 } ;
+    int result = LAGr_MultiSourceShortestPath (&D, G, sources, 2, Split, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (D == NULL) ;
+
+    result = LAGr_MultiSourceShortestPath (&D, G, sources, 0, Split, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    result = LAGr_MultiSourceShortestPath (&D, G, NULL, 1, Split, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGr_MultiSourceShortestPath (&D, G, sources, 1, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_DeltaSplit_Free (&Split, msg)) ;
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+//****************************************************************************
+TEST_LIST = {
+    {"MultiSourceShortestPath", test_MultiSourceShortestPath},
+    {"MultiSourceShortestPath_errors", test_MultiSourceShortestPath_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,335 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankDelta.c: test LAGr_PageRankDelta
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (x - y))
+//------------------------------------------------------------------------------
+
+static float difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP32, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP32, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP32, diff, NULL)) ;
+    float err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP32, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankDelta: compare with LAGr_PageRank
+//------------------------------------------------------------------------------
+
+void test_PageRankDelta (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector r = NULL, r1 = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        int iters = 0, iters1 = 0 ;
+        OK (LAGr_PageRank (&r1, &iters1, G, 0.85, 1e-6, 200, msg)) ;
+
+        for (int method = 0 ; method <= 1 ; method++)
+        {
+            OK (LAGr_PageRankDelta (&r, &iters, G, 0.85, 1e-6, 200,
+                (LAGr_PageRankDelta_Method) method, msg)) ;
+            float err = difference (r, r1) ;
+            float sum = 0 ;
+            OK (GrB_reduce (&sum, NULL, GrB_PLUS_MONOID_FP32, r, NULL)) ;
+            printf ("method %d: iters %d (PageRank: %d) err %g sum %g\n",
+                method, iters, iters1, err, sum) ;
+            TEST_CHECK (err < 1e-4) ;
+            TEST_CHECK (fabs (sum - 1) < 1e-4) ;
+            OK (GrB_free (&r)) ;
+        }
+
+        OK (GrB_free (&r1)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankIncremental: update a graph and compare with LAGr_PageRank
+//------------------------------------------------------------------------------
+
+void test_PageRankIncremental (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL, A0 = NULL ;
+        GrB_Vector r = NULL, r0 = NULL, r1 = NULL, changed = NULL ;
+        LAGraph_Graph G0 = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        GrB_Index n, nvals ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+        bool undirected = (files [k].kind == LAGraph_ADJACENCY_UNDIRECTED) ;
+
+        // A0 = A with a few edges removed, and changed = their endpoints
+        OK (GrB_Matrix_dup (&A0, A)) ;
+        OK (GrB_Vector_new (&changed, GrB_BOOL, n)) ;
+        GrB_Index *I = NULL, *J = NULL ;
+        OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+        OK (GrB_Matrix_extractTuples (I, J, (bool *) NULL, &nvals, A)) ;
+        for (GrB_Index e = 0 ; e < nvals ; e += LAGRAPH_MAX (nvals / 4, 1))
+        {
+            OK (GrB_Matrix_removeElement (A0, I [e], J [e])) ;
+            if (undirected)
+            {
+                OK (GrB_Matrix_removeElement (A0, J [e], I [e])) ;
+            }
+            OK (GrB_Vector_setElement_BOOL (changed, true, I [e])) ;
+            OK (GrB_Vector_setElement_BOOL (changed, true, J [e])) ;
+        }
+        OK (LAGraph_Free ((void **) &I, NULL)) ;
+        OK (LAGraph_Free ((void **) &J, NULL)) ;
+
+        // r0 = pagerank of the graph before the update
+        OK (LAGraph_New (&G0, &A0, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G0, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G0, msg)) ;
+        int iters = 0, iters1 = 0 ;
+        OK (LAGr_PageRank (&r0, &iters, G0, 0.85, 1e-6, 200, msg)) ;
+        OK (LAGraph_Delete (&G0, msg)) ;
+
+        // r1 = pagerank of the updated graph, from scratch
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        OK (LAGr_PageRank (&r1, &iters1, G, 0.85, 1e-6, 200, msg)) ;
+
+        // r = pagerank of the updated graph, warm-started from r0
+        for (int with_changed = 0 ; with_changed <= 1 ; with_changed++)
+        {
+            OK (LAGr_PageRankIncremental (&r, &iters, G, r0,
+                with_changed ? changed : NULL, 0.85, 1e-6, 200, msg)) ;
+            float err = difference (r, r1) ;
+            printf ("changed %d: iters %d (PageRank: %d) err %g\n",
+                with_changed, iters, iters1, err) ;
+            TEST_CHECK (err < 1e-4) ;
+            OK (GrB_free (&r)) ;
+        }
+
+        // with no update, r0 is already converged
+        OK (LAGr_PageRankIncremental (&r, &iters, G, r1, NULL, 0.85, 1e-4,
+            200, msg)) ;
+        TEST_CHECK (difference (r, r1) < 1e-4) ;
+        printf ("no change: iters %d\n", iters) ;
+        OK (GrB_free (&r)) ;
+
+        OK (GrB_free (&r0)) ;
+        OK (GrB_free (&r1)) ;
+        OK (GrB_free (&changed)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankIncremental_sinks: an update that changes the set of sinks
+//------------------------------------------------------------------------------
+
+void test_PageRankIncremental_sinks (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    // A0 has the edges i->i+1 and i->i+7 (mod n), and A is A0 with the edges
+    // out of node 10 removed, so node 10 is a sink in A but not in A0.  The
+    // update from A0 to A adds a sink, and the update from A to A0 removes it.
+    GrB_Index n = 100 ;
+    GrB_Matrix A [2] = { NULL, NULL } ;
+    GrB_Vector changed = NULL ;
+    for (int t = 0 ; t < 2 ; t++)
+    {
+        OK (GrB_Matrix_new (&(A [t]), GrB_FP32, n, n)) ;
+        for (GrB_Index i = 0 ; i < n ; i++)
+        {
+            if (t == 1 && i == 10) continue ;
+            OK (GrB_Matrix_setElement (A [t], 1, i, (i+1) % n)) ;
+            OK (GrB_Matrix_setElement (A [t], 1, i, (i+7) % n)) ;
+        }
+    }
+    OK (GrB_Vector_new (&changed, GrB_BOOL, n)) ;
+    OK (GrB_Vector_setElement_BOOL (changed, true, 10)) ;
+    OK (GrB_Vector_setElement_BOOL (changed, true, 11)) ;
+    OK (GrB_Vector_setElement_BOOL (changed, true, 17)) ;
+
+    for (int t = 0 ; t < 2 ; t++)
+    {
+        GrB_Matrix M = NULL ;
+        GrB_Vector r = NULL, r0 = NULL, r1 = NULL ;
+        int iters = 0, iters1 = 0 ;
+
+        // r0 = pagerank of the graph before the update
+        OK (GrB_Matrix_dup (&M, A [t])) ;
+        OK (LAGraph_New (&G, &M, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        OK (LAGr_PageRank (&r0, &iters, G, 0.85, 1e-6, 200, msg)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+
+        // r1 = pagerank of the updated graph, from scratch
+        OK (GrB_Matrix_dup (&M, A [1-t])) ;
+        OK (LAGraph_New (&G, &M, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        OK (LAGr_PageRank (&r1, &iters1, G, 0.85, 1e-6, 200, msg)) ;
+
+        // r = pagerank of the updated graph, from the affected region only
+        OK (LAGr_PageRankIncremental (&r, &iters, G, r0, changed, 0.85, 1e-6,
+            200, msg)) ;
+        float err = difference (r, r1) ;
+        printf ("\nsinks %s: iters %d (PageRank: %d) err %g\n",
+            (t == 0) ? "added" : "removed", iters, iters1, err) ;
+        TEST_CHECK (err < 1e-5) ;
+
+        OK (LAGraph_Delete (&G, msg)) ;
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&r0)) ;
+        OK (GrB_free (&r1)) ;
+    }
+
+    OK (GrB_free (&(A [0]))) ;
+    OK (GrB_free (&(A [1]))) ;
+    OK (GrB_free (&changed)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankDelta_errors
+//------------------------------------------------------------------------------
+
+void test_PageRankDelta_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector r = NULL ;
+    int iters = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // G->AT and G->out_degree are required
+    int result = LAGr_PageRankDelta (&r, &iters, G, 0.85, 1e-4, 100,
+        LAGr_PageRankDelta_Push, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    result = LAGr_PageRankDelta (NULL, &iters, G, 0.85, 1e-4, 100,
+        LAGr_PageRankDelta_Push, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGr_PageRankDelta (&r, &iters, G, 0.85, 1e-4, 100,
+        (LAGr_PageRankDelta_Method) 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    result = LAGr_PageRankIncremental (&r, &iters, G, NULL, NULL, 0.85, 1e-4,
+        100, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // not enough iterations
+    for (int method = 0 ; method <= 1 ; method++)
+    {
+        result = LAGr_PageRankDelta (&r, &iters, G, 0.85, 1e-4, 2,
+            (LAGr_PageRankDelta_Method) method, msg) ;
+        printf ("result: %d %s\n", result, msg) ;
+        TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+        TEST_CHECK (r == NULL) ;
+    }
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"PageRankDelta", test_PageRankDelta},
+    {"PageRankIncremental", test_PageRankIncremental},
+    {"PageRankIncremental_sinks", test_PageRankIncremental_sinks},
+    {"PageRankDelta_errors", test_PageRankDelta_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,175 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankFused.c: test LAGr_PageRankFused
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (x - y))
+//------------------------------------------------------------------------------
+
+static float difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP32, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP32, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP32, diff, NULL)) ;
+    float err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP32, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankFused: compare with LAGr_PageRank
+//------------------------------------------------------------------------------
+
+void test_PageRankFused (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector r = NULL, r1 = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        int iters = 0, iters1 = 0 ;
+        OK (LAGr_PageRank (&r1, &iters1, G, 0.85, 1e-6, 200, msg)) ;
+
+        // single precision: the same iteration as LAGr_PageRank
+        OK (LAGr_PageRankFused (&r, &iters, G, 0.85, 1e-6, 200,
+            LAGr_PageRank_FP32, msg)) ;
+        float err = difference (r, r1) ;
+        float sum = 0 ;
+        OK (GrB_reduce (&sum, NULL, GrB_PLUS_MONOID_FP32, r, NULL)) ;
+        printf ("fp32: iters %d (PageRank: %d) err %g sum %g\n",
+            iters, iters1, err, sum) ;
+        TEST_CHECK (err < 1e-5) ;
+        TEST_CHECK (fabs (sum - 1) < 1e-4) ;
+        OK (GrB_free (&r)) ;
+
+        // bfloat16: a looser tolerance
+        OK (LAGr_PageRankFused (&r, &iters, G, 0.85, 1e-3, 500,
+            LAGr_PageRank_BF16, msg)) ;
+        err = difference (r, r1) ;
+        OK (GrB_reduce (&sum, NULL, GrB_PLUS_MONOID_FP32, r, NULL)) ;
+        printf ("bf16: iters %d (PageRank: %d) err %g sum %g\n",
+            iters, iters1, err, sum) ;
+        TEST_CHECK (err < 1e-2) ;
+        TEST_CHECK (fabs (sum - 1) < 1e-2) ;
+        OK (GrB_free (&r)) ;
+
+        OK (GrB_free (&r1)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankFused_errors
+//------------------------------------------------------------------------------
+
+void test_PageRankFused_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector r = NULL ;
+    int iters = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    // G->AT and G->out_degree are required
+    int result = LAGr_PageRankFused (&r, &iters, G, 0.85, 1e-4, 100,
+        LAGr_PageRank_FP32, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    result = LAGr_PageRankFused (NULL, &iters, G, 0.85, 1e-4, 100,
+        LAGr_PageRank_FP32, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGr_PageRankFused (&r, &iters, G, 0.85, 1e-4, 100,
+        (LAGr_PageRank_Storage) 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // not enough iterations
+    result = LAGr_PageRankFused (&r, &iters, G, 0.85, 1e-4, 2,
+        LAGr_PageRank_FP32, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+    TEST_CHECK (r == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"PageRankFused", test_PageRankFused},
+    {"PageRankFused_errors", test_PageRankFused_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,299 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Partition.c: test cases for LAGraph_Partition
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, C = NULL ;
+GrB_Vector part = NULL ;
+GrB_Type atype = NULL ;
+char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "LFAT5_two.mtx",      // 6 components
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, ""
+} ;
+
+const int nparts_list [4] = { 1, 2, 4, 7 } ;
+
+//------------------------------------------------------------------------------
+// check_part: check a partition and return its edge cut
+//------------------------------------------------------------------------------
+
+// Part must be full, with part(i) in the range 0 to nparts-1.  The initial
+// partition has contiguous blocks of equal weight, so a part can exceed the
+// average weight by the weight of one node; refinement moves a node only into
+// a part that stays within 3% of the average.
+
+static int64_t check_part (int64_t *Part, LAGraph_Graph G, GrB_Vector part,
+    int nparts)
+{
+    // Part = dense copy of part, which must be full
+    GrB_Matrix A = G->A ;
+    GrB_Index n, nvals, np ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    OK (GrB_Vector_nvals (&np, part)) ;
+    TEST_CHECK (np == n) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Vector_extractElement (&(Part [i]), part, i)) ;
+        TEST_CHECK (Part [i] >= 0 && Part [i] < nparts) ;
+    }
+
+    // check the balance: the weight of a node is 1 plus its out-degree
+    int64_t *PartWeight = NULL, wmax = 0 ;
+    OK (LAGraph_Calloc ((void **) &PartWeight, nparts, sizeof (int64_t),
+        msg)) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        int64_t w = 0 ;
+        int result = GrB_Vector_extractElement (&w, G->out_degree, i) ;
+        TEST_CHECK (result == GrB_SUCCESS || result == GrB_NO_VALUE) ;
+        w++ ;
+        PartWeight [Part [i]] += w ;
+        wmax = LAGRAPH_MAX (wmax, w) ;
+    }
+    double average = ((double) (n + nvals)) / nparts ;
+    double limit = LAGRAPH_MAX (1.03 * average + 1, average + wmax) ;
+    for (int k = 0 ; k < nparts ; k++)
+    {
+        TEST_CHECK (PartWeight [k] <= limit) ;
+    }
+    LAGraph_Free ((void **) &PartWeight, NULL) ;
+
+    // count the entries A(i,j) with Part [i] != Part [j]
+    GrB_Index *I = NULL, *J = NULL ;
+    OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    OK (GrB_Matrix_extractTuples_BOOL (I, J, NULL, &nvals, A)) ;
+    int64_t cut = 0 ;
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        if (Part [I [k]] != Part [J [k]]) cut++ ;
+    }
+    LAGraph_Free ((void **) &I, NULL) ;
+    LAGraph_Free ((void **) &J, NULL) ;
+    return (cut) ;
+}
+
+//------------------------------------------------------------------------------
+// clique_ring: create a graph of ncliques cliques of size csize
+//------------------------------------------------------------------------------
+
+// Clique k holds nodes k*csize to (k+1)*csize-1.  If ring is true, the last
+// node of each clique is joined to the first node of the next one, and the
+// last clique to the first; otherwise the cliques are disconnected.  With
+// one part per clique, the optimal edge cut is 2*ncliques entries for the
+// ring, and zero otherwise.
+
+static void clique_ring (GrB_Matrix *A, int ncliques, int csize, bool ring)
+{
+    GrB_Index n = ncliques * csize ;
+    OK (GrB_Matrix_new (A, GrB_BOOL, n, n)) ;
+    for (int k = 0 ; k < ncliques ; k++)
+    {
+        int64_t first = k * csize ;
+        for (int64_t i = first ; i < first + csize ; i++)
+        {
+            for (int64_t j = first ; j < first + csize ; j++)
+            {
+                if (i != j) OK (GrB_Matrix_setElement (*A, (bool) true, i, j)) ;
+            }
+        }
+        if (ring && ncliques > 1)
+        {
+            int64_t i = first + csize - 1 ;
+            int64_t j = ((k + 1) % ncliques) * csize ;
+            OK (GrB_Matrix_setElement (*A, (bool) true, i, j)) ;
+            OK (GrB_Matrix_setElement (*A, (bool) true, j, i)) ;
+        }
+    }
+    OK (GrB_wait (*A, GrB_MATERIALIZE)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Partition
+//------------------------------------------------------------------------------
+
+void test_Partition (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+
+        for (int kp = 0 ; kp < 4 ; kp++)
+        {
+            int nparts = nparts_list [kp] ;
+
+            // load the graph
+            snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+            FILE *f = fopen (filename, "r") ;
+            TEST_CHECK (f != NULL) ;
+            OK (LAGraph_MMRead (&A, f, msg)) ;
+            OK (fclose (f)) ;
+            GrB_Matrix A0 = NULL ;
+            OK (GrB_Matrix_dup (&A0, A)) ;
+            OK (LAGraph_New (&G, &A, kind, msg)) ;
+            if (kind == LAGraph_ADJACENCY_DIRECTED)
+            {
+                OK (LAGraph_Cached_AT (G, msg)) ;
+            }
+            GrB_Index n ;
+            OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+            // partition the graph
+            int64_t edgecut = -1 ;
+            OK (LAGraph_Partition (&part, &edgecut, G, nparts, msg)) ;
+            int64_t *Part = NULL ;
+            OK (LAGraph_Malloc ((void **) &Part, n, sizeof (int64_t), msg)) ;
+            int64_t cut = check_part (Part, G, part, nparts) ;
+            printf ("nparts %d: edgecut %" PRId64 "\n", nparts, edgecut) ;
+            TEST_CHECK (cut == edgecut) ;
+            if (nparts == 1) TEST_CHECK (edgecut == 0) ;
+
+            // make each part a block of rows
+            int64_t *P = NULL, Bounds [8] ;
+            OK (LAGraph_PartitionLayout (G, &P, Bounds, part, nparts, msg)) ;
+            OK (LAGraph_CheckGraph (G, msg)) ;
+            TEST_CHECK (Bounds [0] == 0 && Bounds [nparts] == n) ;
+            for (int kk = 0 ; kk < nparts ; kk++)
+            {
+                for (int64_t i = Bounds [kk] ; i < Bounds [kk+1] ; i++)
+                {
+                    // the nodes of each part keep their relative order
+                    TEST_CHECK (Part [P [i]] == kk) ;
+                    TEST_CHECK (i == Bounds [kk] || P [i-1] < P [i]) ;
+                }
+            }
+
+            // G->A must be A0 (P,P), and G->AT its transpose
+            bool ok ;
+            OK (LAGraph_Matrix_TypeName (atype_name, A0, msg)) ;
+            OK (LAGraph_TypeFromName (&atype, atype_name, msg)) ;
+            OK (GrB_Matrix_new (&C, atype, n, n)) ;
+            OK (GrB_extract (C, NULL, NULL, A0, (GrB_Index *) P, n,
+                (GrB_Index *) P, n, NULL)) ;
+            OK (LAGraph_Matrix_IsEqual (&ok, C, G->A, msg)) ;
+            TEST_CHECK (ok) ;
+            if (G->AT != NULL)
+            {
+                OK (GrB_transpose (C, NULL, NULL, C, NULL)) ;
+                OK (LAGraph_Matrix_IsEqual (&ok, C, G->AT, msg)) ;
+                TEST_CHECK (ok) ;
+            }
+
+            OK (GrB_free (&C)) ;
+            OK (GrB_free (&A0)) ;
+            OK (GrB_free (&part)) ;
+            LAGraph_Free ((void **) &P, NULL) ;
+            LAGraph_Free ((void **) &Part, NULL) ;
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Partition_cliques: partition graphs with a known optimal edge cut
+//------------------------------------------------------------------------------
+
+void test_Partition_cliques (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    int nparts = 4, csize = 20 ;
+    GrB_Index n = nparts * csize ;
+
+    for (int ring = 0 ; ring <= 1 ; ring++)
+    {
+        // with one part per clique, the cut is optimal and every part has
+        // exactly the average weight
+        clique_ring (&A, nparts, csize, ring) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        int64_t edgecut = -1 ;
+        OK (LAGraph_Partition (&part, &edgecut, G, nparts, msg)) ;
+        printf ("\ncliques (ring %d): edgecut %" PRId64 "\n", ring, edgecut) ;
+        TEST_CHECK (edgecut == (ring ? 2 * nparts : 0)) ;
+        int64_t *Part = NULL ;
+        OK (LAGraph_Malloc ((void **) &Part, n, sizeof (int64_t), msg)) ;
+        TEST_CHECK (check_part (Part, G, part, nparts) == edgecut) ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            TEST_CHECK (Part [i] == i / csize) ;
+        }
+        LAGraph_Free ((void **) &Part, NULL) ;
+        OK (GrB_free (&part)) ;
+
+        // a single part cuts nothing
+        OK (LAGraph_Partition (&part, &edgecut, G, 1, msg)) ;
+        TEST_CHECK (edgecut == 0) ;
+        OK (GrB_free (&part)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    // error handling
+    clique_ring (&A, nparts, csize, true) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    int result = LAGraph_Partition (&part, NULL, G, 0, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_Partition (NULL, NULL, G, nparts, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (GrB_Vector_new (&part, GrB_INT64, n)) ;
+    OK (GrB_Vector_setElement (part, (int64_t) nparts, 0)) ;
+    result = LAGraph_PartitionLayout (G, NULL, NULL, part, nparts, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    OK (GrB_free (&part)) ;
+    OK (GrB_Vector_new (&part, GrB_INT64, n+1)) ;
+    result = LAGraph_PartitionLayout (G, NULL, NULL, part, nparts, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    OK (GrB_free (&part)) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+//****************************************************************************
+TEST_LIST = {
+    {"Partition", test_Partition},
+    {"Partition_cliques", test_Partition_cliques},
+    {NULL, NULL}
+};
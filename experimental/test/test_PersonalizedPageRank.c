@@ -0,0 +1,323 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PersonalizedPageRank.c: test personalized PR
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (x - y))
+//------------------------------------------------------------------------------
+
+static float difference (GrB_Vector x, GrB_Vector y)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, x)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP32, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP32, x, y, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP32, diff, NULL)) ;
+    float err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP32, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PersonalizedPageRank
+//------------------------------------------------------------------------------
+
+void test_PersonalizedPageRank (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL, T = NULL, C = NULL ;
+        GrB_Vector v = NULL, r = NULL, r1 = NULL, c = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        int iters = 0 ;
+
+        // a uniform teleport gives the standard PageRank
+        OK (GrB_Vector_new (&v, GrB_FP32, n)) ;
+        OK (GrB_assign (v, NULL, NULL, (float) 3, GrB_ALL, n, NULL)) ;
+        OK (LAGr_PersonalizedPageRank (&r, &iters, G, v, 0.85, 1e-6, 100,
+            msg)) ;
+        OK (LAGr_PageRank (&r1, &iters, G, 0.85, 1e-6, 100, msg)) ;
+        float err = difference (r, r1) ;
+        printf ("\nuniform teleport: err %g\n", err) ;
+        TEST_CHECK (err < 1e-4) ;
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&r1)) ;
+
+        // T(:,c) = a seed set of c+1 nodes, for c = 0:nseeds-1
+        GrB_Index nseeds = LAGRAPH_MIN (n, 8) ;
+        OK (GrB_Matrix_new (&T, GrB_FP32, n, nseeds)) ;
+        for (GrB_Index c = 0 ; c < nseeds ; c++)
+        {
+            for (GrB_Index i = 0 ; i <= c ; i++)
+            {
+                OK (GrB_Matrix_setElement_FP32 (T, 1, (i * 7) % n, c)) ;
+            }
+        }
+        int citers [8] ;
+        OK (LAGr_PersonalizedPageRankBatch (&C, citers, G, T, 0.85, 1e-6,
+            100, msg)) ;
+
+        // each column of C matches a single personalized PageRank
+        OK (GrB_Vector_new (&c, GrB_FP32, n)) ;
+        for (GrB_Index j = 0 ; j < nseeds ; j++)
+        {
+            OK (GrB_Col_extract (v, NULL, NULL, T, GrB_ALL, n, j, NULL)) ;
+            OK (LAGr_PersonalizedPageRank (&r, &iters, G, v, 0.85, 1e-6, 100,
+                msg)) ;
+            OK (GrB_Col_extract (c, NULL, NULL, C, GrB_ALL, n, j, NULL)) ;
+            err = difference (r, c) ;
+            float sum = 0 ;
+            OK (GrB_reduce (&sum, NULL, GrB_PLUS_MONOID_FP32, c, NULL)) ;
+            printf ("column %d: iters %d err %g sum %g\n", (int) j,
+                citers [j], err, sum) ;
+            TEST_CHECK (err < 1e-5) ;
+            TEST_CHECK (fabs (sum - 1) < 1e-4) ;
+            OK (GrB_free (&r)) ;
+        }
+
+        OK (GrB_free (&v)) ;
+        OK (GrB_free (&c)) ;
+        OK (GrB_free (&T)) ;
+        OK (GrB_free (&C)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PersonalizedPageRankPush: compare with LAGr_PersonalizedPageRank
+//------------------------------------------------------------------------------
+
+void test_PersonalizedPageRankPush (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL ;
+        GrB_Vector v = NULL, r = NULL, p = NULL, res = NULL, t = NULL ;
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (GrB_Vector_new (&t, GrB_FP64, n)) ;
+
+        for (GrB_Index seed = 0 ; seed < n ; seed += 5)
+        {
+            int iters = 0 ;
+            OK (GrB_Vector_new (&v, GrB_FP32, n)) ;
+            OK (GrB_Vector_setElement_FP32 (v, 1, seed)) ;
+            OK (LAGr_PersonalizedPageRank (&r, &iters, G, v, 0.85, 1e-6, 200,
+                msg)) ;
+
+            for (double epsilon = 1e-3 ; epsilon >= 1e-7 ; epsilon /= 100)
+            {
+                OK (LAGr_PersonalizedPageRankPush (&p, &res, G, v, 0.85,
+                    epsilon, msg)) ;
+
+                // sum (p) + sum (res) = 1
+                double psum = 0, rsum = 0 ;
+                OK (GrB_reduce (&psum, NULL, GrB_PLUS_MONOID_FP64, p, NULL)) ;
+                OK (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP64, res,
+                    NULL)) ;
+                TEST_CHECK (fabs (psum + rsum - 1) < 1e-10) ;
+
+                // res (i) < epsilon * max (1, out_degree (i))
+                for (GrB_Index i = 0 ; i < n ; i++)
+                {
+                    double ri = 0 ;
+                    int64_t di = 1 ;
+                    int result = GrB_Vector_extractElement (&ri, res, i) ;
+                    TEST_CHECK (result == GrB_SUCCESS ||
+                        result == GrB_NO_VALUE) ;
+                    result = GrB_Vector_extractElement (&di, G->out_degree,
+                        i) ;
+                    TEST_CHECK (result == GrB_SUCCESS ||
+                        result == GrB_NO_VALUE) ;
+                    TEST_CHECK (ri < epsilon * di) ;
+                }
+
+                // 0 <= r - p <= sum (res), to within the tolerance of r
+                OK (GrB_eWiseAdd (t, NULL, NULL, GrB_MINUS_FP64, r, p, NULL)) ;
+                double tmin = 0, tmax = 0 ;
+                OK (GrB_reduce (&tmin, NULL, GrB_MIN_MONOID_FP64, t, NULL)) ;
+                OK (GrB_reduce (&tmax, NULL, GrB_MAX_MONOID_FP64, t, NULL)) ;
+                printf ("seed %d eps %g: sum(res) %g, r-p in [%g,%g]\n",
+                    (int) seed, epsilon, rsum, tmin, tmax) ;
+                TEST_CHECK (tmin > -2e-5) ;
+                TEST_CHECK (tmax < rsum + 2e-5) ;
+                OK (GrB_free (&p)) ;
+                OK (GrB_free (&res)) ;
+            }
+
+            OK (GrB_free (&v)) ;
+            OK (GrB_free (&r)) ;
+        }
+
+        OK (GrB_free (&t)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PersonalizedPageRank_errors
+//------------------------------------------------------------------------------
+
+void test_PersonalizedPageRank_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector v = NULL, r = NULL ;
+    int iters = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (GrB_Vector_new (&v, GrB_FP32, n)) ;
+    OK (GrB_Vector_setElement_FP32 (v, 1, 0)) ;
+
+    // G->AT and G->out_degree are required
+    int result = LAGr_PersonalizedPageRank (&r, &iters, G, v, 0.85, 1e-4, 100,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    result = LAGr_PersonalizedPageRank (NULL, &iters, G, v, 0.85, 1e-4, 100,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // not enough iterations
+    result = LAGr_PersonalizedPageRank (&r, &iters, G, v, 0.85, 1e-4, 2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+    TEST_CHECK (r == NULL) ;
+
+    // negative teleport
+    OK (GrB_Vector_setElement_FP32 (v, -1, 1)) ;
+    result = LAGr_PersonalizedPageRank (&r, &iters, G, v, 0.85, 1e-4, 100,
+        msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // empty teleport
+    OK (GrB_Vector_clear (v)) ;
+    result = LAGr_PersonalizedPageRank (&r, &iters, G, v, 0.85, 1e-4, 100,
+        msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // wrong size
+    OK (GrB_free (&v)) ;
+    OK (GrB_Vector_new (&v, GrB_FP32, n+1)) ;
+    OK (GrB_Vector_setElement_FP32 (v, 1, 0)) ;
+    result = LAGr_PersonalizedPageRank (&r, &iters, G, v, 0.85, 1e-4, 100,
+        msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+
+    result = LAGr_PersonalizedPageRankPush (&r, NULL, G, v, 0.85, 1e-6,
+        msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    OK (GrB_free (&v)) ;
+    OK (GrB_Vector_new (&v, GrB_FP32, n)) ;
+    OK (GrB_Vector_setElement_FP32 (v, 1, 0)) ;
+    result = LAGr_PersonalizedPageRankPush (&r, NULL, G, v, 0.85, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGr_PersonalizedPageRankPush (&r, NULL, G, v, 1, 1e-6, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (r == NULL) ;
+
+    OK (GrB_free (&v)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"PersonalizedPageRank", test_PersonalizedPageRank},
+    {"PersonalizedPageRankPush", test_PersonalizedPageRankPush},
+    {"PersonalizedPageRank_errors", test_PersonalizedPageRank_errors},
+    {NULL, NULL}
+} ;
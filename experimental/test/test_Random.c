@@ -76,11 +76,113 @@ void test_Random (void)
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// test_Random_Fill: fill vectors and matrices with random values
+//------------------------------------------------------------------------------
+
+void test_Random_Fill (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Vector V = NULL, W = NULL ;
+    GrB_Matrix A = NULL, B = NULL ;
+    GrB_Index n = 10000 ;
+    uint64_t seed = 42 ;
+    bool ok ;
+
+    int nthreads_outer, nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+
+    // V = a full random vector, with 1 thread
+    OK (LAGraph_SetNumThreads (1, 1, msg)) ;
+    OK (GrB_Vector_new (&V, GrB_FP64, n)) ;
+    OK (GrB_Vector_assign_FP64 (V, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+    OK (LAGraph_Random_FillVector (V, seed, msg)) ;
+    OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner, msg)) ;
+
+    // W = the same, with all threads
+    OK (GrB_Vector_new (&W, GrB_FP64, n)) ;
+    OK (GrB_Vector_assign_FP64 (W, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+    OK (LAGraph_Random_FillVector (W, seed, msg)) ;
+    OK (LAGraph_Vector_IsEqual (&ok, V, W, msg)) ;
+    TEST_CHECK (ok) ;
+
+    // all values are in the range [0,1)
+    double vmin, vmax ;
+    OK (GrB_reduce (&vmin, NULL, GrB_MIN_MONOID_FP64, V, NULL)) ;
+    OK (GrB_reduce (&vmax, NULL, GrB_MAX_MONOID_FP64, V, NULL)) ;
+    printf ("\nFP64 values in [%g, %g]\n", vmin, vmax) ;
+    TEST_CHECK (vmin >= 0 && vmax < 1) ;
+
+    // a sparse vector gets the same values as the full one
+    OK (GrB_free (&W)) ;
+    OK (GrB_Vector_new (&W, GrB_FP64, n)) ;
+    for (int64_t i = 0 ; i < n ; i += 7)
+    {
+        OK (GrB_Vector_setElement_FP64 (W, 0, i)) ;
+    }
+    OK (LAGraph_Random_FillVector (W, seed, msg)) ;
+    for (int64_t i = 0 ; i < n ; i += 7)
+    {
+        double v, w ;
+        OK (GrB_Vector_extractElement_FP64 (&v, V, i)) ;
+        OK (GrB_Vector_extractElement_FP64 (&w, W, i)) ;
+        TEST_CHECK (v == w) ;
+    }
+    GrB_Index nvals ;
+    OK (GrB_Vector_nvals (&nvals, W)) ;
+    TEST_CHECK (nvals == (n + 6) / 7) ;
+
+    // the next seeds keep the pattern of the vector
+    OK (GrB_free (&W)) ;
+    OK (GrB_Vector_new (&W, GrB_UINT64, n)) ;
+    for (int64_t i = 0 ; i < n ; i += 3)
+    {
+        OK (GrB_Vector_setElement_UINT64 (W, 0, i)) ;
+    }
+    OK (LAGraph_Random_Seed (W, seed, msg)) ;
+    OK (LAGraph_Random_Next (W, msg)) ;
+    OK (GrB_Vector_nvals (&nvals, W)) ;
+    TEST_CHECK (nvals == (n + 2) / 3) ;
+
+    // a sparse random matrix has the same values as the full one
+    GrB_Index nrows = 100, ncols = 200 ;
+    OK (GrB_Matrix_new (&A, GrB_INT32, nrows, ncols)) ;
+    OK (GrB_Matrix_assign_INT32 (A, NULL, NULL, 0, GrB_ALL, nrows, GrB_ALL,
+        ncols, NULL)) ;
+    OK (LAGraph_Random_FillMatrix (A, seed, msg)) ;
+    OK (LAGraph_Random_Matrix (&B, GrB_INT32, nrows, ncols, 0.1, seed, msg)) ;
+    OK (GrB_Matrix_nvals (&nvals, B)) ;
+    TEST_CHECK (nvals > 0 && nvals <= nrows * ncols / 10) ;
+    GrB_Matrix C = NULL ;
+    OK (GrB_Matrix_new (&C, GrB_INT32, nrows, ncols)) ;
+    OK (GrB_Matrix_assign (C, B, NULL, A, GrB_ALL, nrows, GrB_ALL, ncols,
+        GrB_DESC_S)) ;
+    OK (LAGraph_Matrix_IsEqual (&ok, B, C, msg)) ;
+    TEST_CHECK (ok) ;
+    OK (GrB_free (&C)) ;
+
+    // unsupported types
+    GrB_Type MyInt ;
+    OK (GrB_Type_new (&MyInt, sizeof (int))) ;
+    OK (GrB_free (&V)) ;
+    OK (GrB_Vector_new (&V, MyInt, n)) ;
+    int result = LAGraph_Random_FillVector (V, seed, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+    OK (GrB_free (&MyInt)) ;
+
+    OK (GrB_free (&V)) ;
+    OK (GrB_free (&W)) ;
+    OK (GrB_free (&A)) ;
+    OK (GrB_free (&B)) ;
+    LAGraph_Finalize (msg) ;
+}
+
 //------------------------------------------------------------------------------
 // Test list
 //------------------------------------------------------------------------------
 
 TEST_LIST = {
     {"Random", test_Random},
+    {"Random_Fill", test_Random_Fill},
     {NULL, NULL}
 };
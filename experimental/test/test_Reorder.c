@@ -0,0 +1,225 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Reorder.c: test cases for LAGraph_Reorder
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, C = NULL ;
+GrB_Type atype = NULL ;
+char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "LFAT5.mtx",          // 3 components
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, ""
+} ;
+
+const LAGraph_ReorderMethod methods [4] =
+{
+    LAGraph_REORDER_DEGREE,
+    LAGraph_REORDER_HUB_CLUSTER,
+    LAGraph_REORDER_RCM,
+    LAGraph_REORDER_COMMUNITY
+} ;
+
+//------------------------------------------------------------------------------
+// bandwidth: max |i-j| for all entries A(i,j)
+//------------------------------------------------------------------------------
+
+static int64_t bandwidth (GrB_Matrix A)
+{
+    GrB_Index n, nvals ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    GrB_Index *I = NULL, *J = NULL ;
+    OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    OK (GrB_Matrix_extractTuples_BOOL (I, J, NULL, &nvals, A)) ;
+    int64_t b = 0 ;
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        int64_t d = (int64_t) I [k] - (int64_t) J [k] ;
+        b = LAGRAPH_MAX (b, (d < 0) ? -d : d) ;
+    }
+    LAGraph_Free ((void **) &I, NULL) ;
+    LAGraph_Free ((void **) &J, NULL) ;
+    return (b) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Reorder
+//------------------------------------------------------------------------------
+
+void test_Reorder (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+
+        for (int m = 0 ; m < 4 ; m++)
+        {
+            // load the graph, with all cached properties
+            snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+            FILE *f = fopen (filename, "r") ;
+            TEST_CHECK (f != NULL) ;
+            OK (LAGraph_MMRead (&A, f, msg)) ;
+            OK (fclose (f)) ;
+            GrB_Matrix A0 = NULL ;
+            OK (GrB_Matrix_dup (&A0, A)) ;
+            OK (LAGraph_New (&G, &A, kind, msg)) ;
+            int result = LAGraph_Cached_AT (G, msg) ;
+            TEST_CHECK (result == GrB_SUCCESS ||
+                result == LAGRAPH_CACHE_NOT_NEEDED) ;
+            OK (LAGraph_Cached_OutDegree (G, msg)) ;
+            result = LAGraph_Cached_InDegree (G, msg) ;
+            TEST_CHECK (result == GrB_SUCCESS ||
+                result == LAGRAPH_CACHE_NOT_NEEDED) ;
+            OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+            int64_t nself_edges = G->nself_edges ;
+            int64_t bw0 = bandwidth (G->A) ;
+
+            // renumber the graph
+            int64_t *P = NULL ;
+            OK (LAGraph_Reorder (G, &P, methods [m], msg)) ;
+            OK (LAGraph_CheckGraph (G, msg)) ;
+            GrB_Index n ;
+            OK (GrB_Matrix_nrows (&n, G->A)) ;
+            int64_t bw = bandwidth (G->A) ;
+            printf ("method %d: bandwidth %" PRId64 " (was %" PRId64 ")\n",
+                m, bw, bw0) ;
+
+            // P must be a permutation
+            bool *mark = NULL ;
+            OK (LAGraph_Calloc ((void **) &mark, n, sizeof (bool), msg)) ;
+            for (int64_t i = 0 ; i < n ; i++)
+            {
+                TEST_CHECK (P [i] >= 0 && P [i] < n && !mark [P [i]]) ;
+                mark [P [i]] = true ;
+            }
+            LAGraph_Free ((void **) &mark, NULL) ;
+
+            // G->A must be A0 (P,P)
+            bool ok ;
+            OK (LAGraph_Matrix_TypeName (atype_name, A0, msg)) ;
+            OK (LAGraph_TypeFromName (&atype, atype_name, msg)) ;
+            OK (GrB_Matrix_new (&C, atype, n, n)) ;
+            OK (GrB_extract (C, NULL, NULL, A0, (GrB_Index *) P, n,
+                (GrB_Index *) P, n, NULL)) ;
+            OK (LAGraph_Matrix_IsEqual (&ok, C, G->A, msg)) ;
+            TEST_CHECK (ok) ;
+
+            // the cached properties must be consistent with G->A
+            GrB_Matrix A2 = NULL ;
+            LAGraph_Graph G2 = NULL ;
+            OK (GrB_Matrix_dup (&A2, G->A)) ;
+            OK (LAGraph_New (&G2, &A2, kind, msg)) ;
+            OK (LAGraph_Cached_OutDegree (G2, msg)) ;
+            OK (LAGraph_Vector_IsEqual (&ok, G->out_degree, G2->out_degree,
+                msg)) ;
+            TEST_CHECK (ok) ;
+            if (kind == LAGraph_ADJACENCY_DIRECTED)
+            {
+                OK (LAGraph_Cached_AT (G2, msg)) ;
+                OK (LAGraph_Cached_InDegree (G2, msg)) ;
+                OK (LAGraph_Matrix_IsEqual (&ok, G->AT, G2->AT, msg)) ;
+                TEST_CHECK (ok) ;
+                OK (LAGraph_Vector_IsEqual (&ok, G->in_degree,
+                    G2->in_degree, msg)) ;
+                TEST_CHECK (ok) ;
+            }
+            TEST_CHECK (G->nself_edges == nself_edges) ;
+
+            OK (LAGraph_Delete (&G2, msg)) ;
+            OK (GrB_free (&C)) ;
+            OK (GrB_free (&A0)) ;
+            LAGraph_Free ((void **) &P, NULL) ;
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Reorder_path: RCM on a path graph with its nodes scrambled
+//------------------------------------------------------------------------------
+
+void test_Reorder_path (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    // node Q [k] is the k-th node on the path
+    GrB_Index n = 1000 ;
+    int64_t *Q = NULL ;
+    OK (LAGraph_Malloc ((void **) &Q, n, sizeof (int64_t), msg)) ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        Q [k] = (k * 617) % n ;
+    }
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    for (int64_t k = 0 ; k < n-1 ; k++)
+    {
+        OK (GrB_Matrix_setElement (A, (bool) true, Q [k], Q [k+1])) ;
+        OK (GrB_Matrix_setElement (A, (bool) true, Q [k+1], Q [k])) ;
+    }
+    LAGraph_Free ((void **) &Q, NULL) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    TEST_CHECK (bandwidth (G->A) > 1) ;
+
+    // the bandwidth of a path in Cuthill-McKee order is 1
+    OK (LAGraph_Reorder (G, NULL, LAGraph_REORDER_RCM, msg)) ;
+    TEST_CHECK (bandwidth (G->A) == 1) ;
+
+    // error handling
+    int result = LAGraph_Reorder (G, NULL, 42, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGraph_Reorder (NULL, NULL, LAGraph_REORDER_RCM, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//****************************************************************************
+//****************************************************************************
+TEST_LIST = {
+    {"Reorder", test_Reorder},
+    {"Reorder_path", test_Reorder_path},
+    {NULL, NULL}
+};
@@ -0,0 +1,616 @@
+//------------------------------------------------------------------------------
+// LAGraph_Generate: synthetic graph generators
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// Parallel generators for synthetic graphs, so that benchmarks can be run at
+// any scale without reading a graph from a file:
+
+// LAGraph_Generate_RMAT:       R-MAT / Graph500 Kronecker graph
+// LAGraph_Generate_ErdosRenyi: G(n,p) random graph
+// LAGraph_Generate_SBM:        stochastic block model
+// LAGraph_Generate_ChungLu:    Chung-Lu graph with a power-law degree sequence
+// LAGraph_Generate_Grid:       2D or 3D grid (5-point or 7-point stencil)
+
+// The random graphs use the counter-based generator of LAGraph_Random (see
+// LG_rand_counter in LG_internal.h): each random choice is computed from the
+// seed and the index of the edge (or row) it belongs to, so the graph depends
+// only on the seed and the parameters, not on the number of threads.  Each
+// generator builds a list of edges in parallel, and the graph is then
+// constructed by GrB_Matrix_build, with duplicate edges and self-edges
+// removed.  If the graph is undirected, the edges are generated in one
+// direction and G->A is made symmetric with A = A|A'.
+
+// G->A is returned as a GrB_BOOL matrix with all entries true, with no
+// self-edges (G->nself_edges is zero).  Use LAGraph_Random_FillMatrix to give
+// the edges random weights.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &J, NULL) ;             \
+    LAGraph_Free ((void **) &Cp, NULL) ;            \
+    LAGraph_Free ((void **) &Cw, NULL) ;            \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LG_gen_unif: a uniform random value in the range (0,1]
+//------------------------------------------------------------------------------
+
+static inline double LG_gen_unif (uint64_t key, uint64_t c)
+{
+    return (((double) ((LG_rand_counter (key, c) >> 11) + 1)) * 0x1.0p-53) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_gen_nthreads: # of threads for a loop of n iterations
+//------------------------------------------------------------------------------
+
+static inline int LG_gen_nthreads (int64_t n)
+{
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 4096) ;
+    return (LAGRAPH_MAX (nthreads, 1)) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_gen_build: construct a graph from a list of edges
+//------------------------------------------------------------------------------
+
+// G->A is built from the edges (I [k], J [k]) for k = 0 to nedges-1, which
+// may include duplicates and self-edges.  I and J are freed on output.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LAGraph_Free ((void **) I, NULL) ;              \
+    LAGraph_Free ((void **) J, NULL) ;              \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+    GrB_free (&A) ;                                 \
+}
+
+static int LG_gen_build
+(
+    // output:
+    LAGraph_Graph *G,
+    // input/output:
+    GrB_Index **I,          // row indices of the edges; freed on output
+    GrB_Index **J,          // column indices of the edges; freed on output
+    // input:
+    int64_t nedges,         // # of edges in I and J
+    GrB_Index n,            // # of nodes
+    LAGraph_Kind kind,      // directed or undirected
+    char *msg
+)
+{
+    bool *X = NULL ;
+    GrB_Matrix A = NULL ;
+
+    // X = true (nedges,1)
+    LG_TRY (LAGraph_Malloc ((void **) &X, nedges, sizeof (bool), msg)) ;
+    int nthreads = LG_gen_nthreads (nedges) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nedges ; k++)
+    {
+        X [k] = true ;
+    }
+
+    // A = sparse (I, J, X), dropping duplicates and self-edges
+    GRB_TRY (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_Matrix_build_BOOL (A, *I, *J, X, nedges, GrB_LOR)) ;
+    LAGraph_Free ((void **) I, NULL) ;
+    LAGraph_Free ((void **) J, NULL) ;
+    LAGraph_Free ((void **) &X, NULL) ;
+    GRB_TRY (GrB_select (A, NULL, NULL, GrB_OFFDIAG, A, 0, NULL)) ;
+
+    // A = A|A' if the graph is undirected
+    if (kind == LAGraph_ADJACENCY_UNDIRECTED)
+    {
+        GRB_TRY (GrB_eWiseAdd (A, NULL, NULL, GrB_LOR, A, A, GrB_DESC_T1)) ;
+    }
+
+    // G = the graph of A, which has no self-edges
+    LG_TRY (LAGraph_New (G, &A, kind, msg)) ;
+    (*G)->nself_edges = 0 ;
+    return (GrB_SUCCESS) ;
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LG_FREE_WORK
+
+//------------------------------------------------------------------------------
+// LAGraph_Generate_RMAT: R-MAT / Graph500 Kronecker graph
+//------------------------------------------------------------------------------
+
+// Generates edgefactor * 2^scale edges on n = 2^scale nodes.  Each edge is
+// placed by descending scale levels of the recursive 2-by-2 partition of the
+// adjacency matrix, choosing the top-left, top-right, bottom-left, or
+// bottom-right quadrant with probabilities a, b, c, and 1-a-b-c (Chakrabarti,
+// Zhan, and Faloutsos, "R-MAT: A Recursive Model for Graph Mining", SDM 2004).
+// The Graph500 benchmark uses a = 0.57, b = c = 0.19, edgefactor = 16, and an
+// undirected graph.  As in Graph500, the node numbers are then scrambled, so
+// the high-degree nodes are not clustered at the start; the scrambling is a
+// bijection on 0:n-1 that depends on the seed.
+
+static inline uint64_t LG_gen_scramble (uint64_t v, uint64_t mult,
+    uint64_t add, int scale, uint64_t mask)
+{
+    // each step is a bijection on the integers 0:2^scale-1
+    v = (v * mult + add) & mask ;
+    v ^= (v >> ((scale + 1) / 2)) ;
+    v = (v * mult) & mask ;
+    v ^= (v >> ((scale + 2) / 3)) ;
+    return (v) ;
+}
+
+int LAGraph_Generate_RMAT
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n = 2^scale nodes
+    // input:
+    int scale,              // log2 of the number of nodes
+    int edgefactor,         // # of edges to generate is edgefactor*n
+    double a,               // quadrant probabilities; the 4th is 1-a-b-c
+    double b,
+    double c,
+    LAGraph_Kind kind,      // directed or undirected
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    int64_t *Cp = NULL ;
+    double *Cw = NULL ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+    (*G) = NULL ;
+    LG_ASSERT_MSG (scale >= 1 && scale <= 48, GrB_INVALID_VALUE,
+        "scale must be in the range 1 to 48") ;
+    LG_ASSERT_MSG (edgefactor >= 1, GrB_INVALID_VALUE,
+        "edgefactor must be >= 1") ;
+    LG_ASSERT_MSG (a >= 0 && b >= 0 && c >= 0 && a + b + c <= 1,
+        GrB_INVALID_VALUE, "invalid quadrant probabilities") ;
+    LG_ASSERT_MSG (kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        kind == LAGraph_ADJACENCY_DIRECTED, GrB_INVALID_VALUE,
+        "invalid graph kind") ;
+
+    //--------------------------------------------------------------------------
+    // generate the edges
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = ((GrB_Index) 1) << scale ;
+    uint64_t mask = n - 1 ;
+    int64_t nedges = (int64_t) edgefactor * (int64_t) n ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, nedges, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, nedges, sizeof (GrB_Index), msg)) ;
+
+    uint64_t key = LG_rand_mix (seed) ;
+    uint64_t mult = LG_rand_counter (key, UINT64_MAX - 1) | 1 ;
+    uint64_t add  = LG_rand_counter (key, UINT64_MAX - 2) ;
+    double ab = a + b, abc = a + b + c ;
+    int nthreads = LG_gen_nthreads (nedges) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nedges ; k++)
+    {
+        uint64_t i = 0, j = 0, c0 = ((uint64_t) k) * scale ;
+        for (int level = 0 ; level < scale ; level++)
+        {
+            double u = LG_gen_unif (key, c0 + level) ;
+            uint64_t ibit = (u > ab) ;
+            uint64_t jbit = (u > a && u <= ab) || (u > abc) ;
+            i = (i << 1) | ibit ;
+            j = (j << 1) | jbit ;
+        }
+        I [k] = LG_gen_scramble (i, mult, add, scale, mask) ;
+        J [k] = LG_gen_scramble (j, mult, add, scale, mask) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the graph
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_gen_build (G, &I, &J, nedges, n, kind, msg)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Generate_SBM: stochastic block model
+//------------------------------------------------------------------------------
+
+// The n nodes are split into nblocks blocks of nearly equal size (block b is
+// nodes floor(b*n/nblocks) to floor((b+1)*n/nblocks)-1).  Each edge (i,j),
+// i != j, is present with probability p_in if i and j are in the same block,
+// or p_out otherwise, independently of all other edges.  For an undirected
+// graph, this holds for each pair i < j.
+
+// The edges of row i are sampled with geometric skips over the columns, in
+// O(1) time per edge, with random numbers drawn from a stream that depends
+// only on the seed and i.  The rows are counted and then filled in two
+// passes that draw the same random numbers, in parallel.
+
+static inline int64_t LG_gen_block_start (int64_t b, int64_t n, int nblocks)
+{
+    return ((b * n) / nblocks) ;
+}
+
+static int64_t LG_gen_sbm_row   // returns # of entries in row i
+(
+    GrB_Index *Jrow,        // column indices of row i; count only if NULL
+    uint64_t rowkey,        // random number key for row i
+    int64_t i,
+    int64_t n,
+    int nblocks,
+    double p_in,
+    double p_out,
+    bool directed
+)
+{
+    int64_t cnt = 0 ;
+    uint64_t t = 0 ;
+    int64_t bi = ((i + 1) * nblocks - 1) / n ;  // block that contains i
+    for (int64_t b = 0 ; b < nblocks ; b++)
+    {
+        // columns c0:c1-1 are in block b
+        int64_t c0 = LG_gen_block_start (b, n, nblocks) ;
+        int64_t c1 = LG_gen_block_start (b+1, n, nblocks) ;
+        if (!directed) c0 = LAGRAPH_MAX (c0, i+1) ;
+        double p = (b == bi) ? p_in : p_out ;
+        if (c0 >= c1 || p <= 0) continue ;
+        if (p >= 1)
+        {
+            // all of the columns c0:c1-1
+            for (int64_t j = c0 ; j < c1 ; j++)
+            {
+                if (Jrow != NULL) Jrow [cnt] = j ;
+                cnt++ ;
+            }
+            continue ;
+        }
+        // skip to the next column with probability p
+        double logq = log1p (-p) ;
+        int64_t j = c0 - 1 ;
+        while (true)
+        {
+            double skip = floor (log (LG_gen_unif (rowkey, t++)) / logq) ;
+            if (skip >= (double) (c1 - j - 1)) break ;
+            j += 1 + (int64_t) skip ;
+            if (Jrow != NULL) Jrow [cnt] = j ;
+            cnt++ ;
+        }
+    }
+    return (cnt) ;
+}
+
+int LAGraph_Generate_SBM
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    int nblocks,            // # of blocks
+    double p_in,            // probability of an edge inside a block
+    double p_out,           // probability of an edge between blocks
+    LAGraph_Kind kind,      // directed or undirected
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    int64_t *Cp = NULL ;
+    double *Cw = NULL ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+    (*G) = NULL ;
+    LG_ASSERT_MSG (n >= 1 && nblocks >= 1 && nblocks <= n, GrB_INVALID_VALUE,
+        "nblocks must be in the range 1 to n") ;
+    LG_ASSERT_MSG (p_in >= 0 && p_in <= 1 && p_out >= 0 && p_out <= 1,
+        GrB_INVALID_VALUE, "probabilities must be in the range 0 to 1") ;
+    LG_ASSERT_MSG (kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        kind == LAGraph_ADJACENCY_DIRECTED, GrB_INVALID_VALUE,
+        "invalid graph kind") ;
+    bool directed = (kind == LAGraph_ADJACENCY_DIRECTED) ;
+
+    //--------------------------------------------------------------------------
+    // count the entries in each row
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &Cp, n+1, sizeof (int64_t), msg)) ;
+    uint64_t key = LG_rand_mix (seed) ;
+    int nthreads = LG_gen_nthreads (n) ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        Cp [i] = LG_gen_sbm_row (NULL, LG_rand_counter (key, i), i, n,
+            nblocks, p_in, p_out, directed) ;
+    }
+
+    // Cp = cumsum (Cp)
+    int64_t nedges = 0 ;
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        int64_t cnt = Cp [i] ;
+        Cp [i] = nedges ;
+        nedges += cnt ;
+    }
+    Cp [n] = nedges ;
+
+    //--------------------------------------------------------------------------
+    // generate the edges
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, nedges, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, nedges, sizeof (GrB_Index), msg)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        LG_gen_sbm_row (J + Cp [i], LG_rand_counter (key, i), i, n, nblocks,
+            p_in, p_out, directed) ;
+        for (int64_t p = Cp [i] ; p < Cp [i+1] ; p++)
+        {
+            I [p] = i ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the graph
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_gen_build (G, &I, &J, nedges, n, kind, msg)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Generate_ErdosRenyi: G(n,p) random graph
+//------------------------------------------------------------------------------
+
+// Each edge (i,j), i != j, is present with probability p, independently of
+// all other edges (i < j for an undirected graph).  This is the stochastic
+// block model with a single block.
+
+int LAGraph_Generate_ErdosRenyi
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    double p,               // probability of each edge
+    LAGraph_Kind kind,      // directed or undirected
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+    return (LAGraph_Generate_SBM (G, n, 1, p, p, kind, seed, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Generate_ChungLu: Chung-Lu graph with a power-law degree sequence
+//------------------------------------------------------------------------------
+
+// Node i has the weight w(i) = (i+1)^(-1/(gamma-1)), so that the expected
+// degrees follow a power law with exponent gamma; node 0 has the largest
+// expected degree.  n*avg_degree/2 edges (n*avg_degree for a directed graph)
+// are generated, each with both end points chosen independently with
+// probability proportional to w (the edge-sampling form of the Chung-Lu
+// model; see also Miller and Hagberg, "Efficient Generation of Networks with
+// Given Expected Degrees", WAW 2011).  Duplicate edges and self-edges are
+// removed, so the average degree of the result is slightly less than
+// avg_degree.
+
+int LAGraph_Generate_ChungLu
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    double avg_degree,      // average degree
+    double gamma,           // power-law exponent; must be > 1
+    LAGraph_Kind kind,      // directed or undirected
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    int64_t *Cp = NULL ;
+    double *Cw = NULL ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+    (*G) = NULL ;
+    LG_ASSERT_MSG (n >= 1, GrB_INVALID_VALUE, "n must be >= 1") ;
+    LG_ASSERT_MSG (avg_degree >= 0, GrB_INVALID_VALUE,
+        "avg_degree must be >= 0") ;
+    LG_ASSERT_MSG (gamma > 1, GrB_INVALID_VALUE, "gamma must be > 1") ;
+    LG_ASSERT_MSG (kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        kind == LAGraph_ADJACENCY_DIRECTED, GrB_INVALID_VALUE,
+        "invalid graph kind") ;
+
+    //--------------------------------------------------------------------------
+    // Cw = cumulative sum of the node weights
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &Cw, n+1, sizeof (double), msg)) ;
+    double e = -1 / (gamma - 1) ;
+    int nthreads = LG_gen_nthreads (n) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        Cw [k+1] = pow ((double) (k+1), e) ;
+    }
+    Cw [0] = 0 ;
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        Cw [k+1] += Cw [k] ;
+    }
+    double wtotal = Cw [n] ;
+
+    //--------------------------------------------------------------------------
+    // generate the edges
+    //--------------------------------------------------------------------------
+
+    double nx = round (n * avg_degree /
+        ((kind == LAGraph_ADJACENCY_UNDIRECTED) ? 2 : 1)) ;
+    int64_t nedges = (int64_t) nx ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, nedges, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, nedges, sizeof (GrB_Index), msg)) ;
+    uint64_t key = LG_rand_mix (seed) ;
+    nthreads = LG_gen_nthreads (nedges) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nedges ; k++)
+    {
+        for (int t = 0 ; t < 2 ; t++)
+        {
+            // find the node i with Cw [i] < x <= Cw [i+1]
+            double x = LG_gen_unif (key, 2*k + t) * wtotal ;
+            int64_t lo = 0, hi = n ;
+            while (hi - lo > 1)
+            {
+                int64_t mid = (lo + hi) / 2 ;
+                if (Cw [mid] < x)
+                {
+                    lo = mid ;
+                }
+                else
+                {
+                    hi = mid ;
+                }
+            }
+            if (t == 0)
+            {
+                I [k] = lo ;
+            }
+            else
+            {
+                J [k] = lo ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the graph
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_gen_build (G, &I, &J, nedges, n, kind, msg)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Generate_Grid: 2D or 3D grid
+//------------------------------------------------------------------------------
+
+// Generates the undirected graph of an nx-by-ny-by-nz grid, where each node
+// is connected to its neighbors in the x, y, and z directions (the 7-point
+// stencil, or the 5-point stencil if nz is 1).  The node (x,y,z) is number
+// x + nx*(y + ny*z).
+
+int LAGraph_Generate_Grid
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with nx*ny*nz nodes
+    // input:
+    GrB_Index nx,           // size of the grid in each dimension
+    GrB_Index ny,
+    GrB_Index nz,           // 1 for a 2D grid
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    int64_t *Cp = NULL ;
+    double *Cw = NULL ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+    (*G) = NULL ;
+    LG_ASSERT_MSG (nx >= 1 && ny >= 1 && nz >= 1, GrB_INVALID_VALUE,
+        "grid dimensions must be >= 1") ;
+
+    //--------------------------------------------------------------------------
+    // generate the edges in the +x, +y, and +z directions
+    //--------------------------------------------------------------------------
+
+    // the edges in the +x direction are numbered first, then +y, then +z
+    GrB_Index n = nx * ny * nz ;
+    int64_t ex = (nx - 1) * ny * nz ;
+    int64_t ey = nx * (ny - 1) * nz ;
+    int64_t ez = nx * ny * (nz - 1) ;
+    int64_t nedges = ex + ey + ez ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, nedges, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, nedges, sizeof (GrB_Index), msg)) ;
+    int nthreads = LG_gen_nthreads (nedges) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nedges ; k++)
+    {
+        int64_t x, y, z, i, dx, dy ;
+        if (k < ex)
+        {
+            // edge from (x,y,z) to (x+1,y,z), for x < nx-1
+            dx = nx - 1 ; dy = ny ; i = 1 ;
+            x = k % dx ; y = (k / dx) % dy ; z = k / (dx * dy) ;
+        }
+        else if (k < ex + ey)
+        {
+            // edge from (x,y,z) to (x,y+1,z), for y < ny-1
+            int64_t kk = k - ex ;
+            dx = nx ; dy = ny - 1 ; i = nx ;
+            x = kk % dx ; y = (kk / dx) % dy ; z = kk / (dx * dy) ;
+        }
+        else
+        {
+            // edge from (x,y,z) to (x,y,z+1), for z < nz-1
+            int64_t kk = k - ex - ey ;
+            dx = nx ; dy = ny ; i = nx * ny ;
+            x = kk % dx ; y = (kk / dx) % dy ; z = kk / (dx * dy) ;
+        }
+        I [k] = x + nx * (y + ny * z) ;
+        J [k] = I [k] + i ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the graph
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_gen_build (G, &I, &J, nedges, n, LAGraph_ADJACENCY_UNDIRECTED,
+        msg)) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,291 @@
+//------------------------------------------------------------------------------
+// LAGraph_PartitionLayout: renumber a graph so each part is a row block
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_PartitionLayout renumbers the nodes of G in place (with
+// LAGraph_Permute), so that the nodes of each part of a partition (from
+// LAGraph_Partition, for example) are numbered contiguously: part k holds
+// nodes Bounds [k] to Bounds [k+1]-1, in their original relative order.  Each
+// part is then a block of rows of G->A (and of G->AT, if present).
+
+// With SuiteSparse:GraphBLAS, the memory of each row block of G->A and G->AT
+// is then first touched by the threads assigned to that part: if there are
+// at least as many threads as parts, the threads are split into nparts
+// groups of consecutive threads, and otherwise each thread takes a range of
+// consecutive parts.  The matrix is unpacked in CSR form, copied into newly
+// allocated arrays by those threads, and packed back.  On a NUMA machine
+// with the threads bound to the sockets in order (OMP_PROC_BIND=close, for
+// example) and nparts equal to the number of sockets, this places each row
+// block in the memory of the socket whose threads work on it.  With any
+// other GraphBLAS library, G is only renumbered.
+
+// On output, *P is the permutation, of size n, if P is not NULL (node P [k] of
+// the input graph is node k of the output graph).  It must be freed by
+// LAGraph_Free.  Bounds, if not NULL, is an array of size nparts+1 provided by
+// the caller.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &Key, NULL) ;           \
+    LAGraph_Free ((void **) &W, NULL) ;             \
+    LAGraph_Free ((void **) &Count, NULL) ;         \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    LAGraph_Free ((void **) &Perm, NULL) ;          \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// LG_first_touch: copy the row blocks of A with the threads of each part
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LAGraph_Free ((void **) &Range, NULL) ;         \
+    LAGraph_Free ((void **) &Tp, NULL) ;            \
+    LAGraph_Free ((void **) &Tj, NULL) ;            \
+    LAGraph_Free ((void **) &Tx, NULL) ;            \
+}
+
+static int LG_first_touch
+(
+    GrB_Matrix A,               // matrix to copy in place
+    const int64_t *Bounds,      // part k is rows Bounds [k] to Bounds [k+1]-1
+    int nparts,                 // number of parts
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the size and type of A
+    //--------------------------------------------------------------------------
+
+    int64_t *Range = NULL ;
+    GrB_Index *Tp = NULL, *Tj = NULL ;
+    void *Tx = NULL ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+    GrB_Type atype ;
+    size_t tsize ;
+    LG_TRY (LAGraph_Matrix_TypeName (atype_name, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&atype, atype_name, msg)) ;
+    GRB_TRY (GxB_Type_size (&tsize, atype)) ;
+
+    //--------------------------------------------------------------------------
+    // assign the rows of each part to its threads
+    //--------------------------------------------------------------------------
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Range, nthreads + 1, sizeof (int64_t),
+        msg)) ;
+    if (nthreads >= nparts)
+    {
+        // part k is split by rows among threads t0 to t1-1
+        for (int k = 0 ; k < nparts ; k++)
+        {
+            int t0 = (int) (((int64_t) k * nthreads) / nparts) ;
+            int t1 = (int) (((int64_t) (k+1) * nthreads) / nparts) ;
+            int64_t rows = Bounds [k+1] - Bounds [k] ;
+            for (int t = t0 ; t < t1 ; t++)
+            {
+                Range [t] = Bounds [k] + ((t - t0) * rows) / (t1 - t0) ;
+            }
+        }
+    }
+    else
+    {
+        // each thread takes a range of consecutive parts
+        for (int t = 0 ; t < nthreads ; t++)
+        {
+            Range [t] = Bounds [((int64_t) t * nparts) / nthreads] ;
+        }
+    }
+    Range [nthreads] = n ;
+
+    //--------------------------------------------------------------------------
+    // allocate the new arrays, but do not touch them yet
+    //--------------------------------------------------------------------------
+
+    GrB_Index Tp_size = (n + 1) * sizeof (GrB_Index) ;
+    GrB_Index Tj_size = LAGRAPH_MAX (nvals, 1) * sizeof (GrB_Index) ;
+    GrB_Index Tx_size = LAGRAPH_MAX (nvals, 1) * tsize ;
+    LG_TRY (LAGraph_Malloc ((void **) &Tp, n + 1, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Tj, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Tx, nvals, tsize, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // unpack A, copy it into the new arrays, and pack them back into A
+    //--------------------------------------------------------------------------
+
+    // no GraphBLAS errors can occur between the unpack and pack
+    GrB_Index *Ap = NULL, *Aj = NULL ;
+    void *Ax = NULL ;
+    GrB_Index Ap_size, Aj_size, Ax_size ;
+    bool iso, jumbled ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+        &Ax_size, &iso, &jumbled, NULL)) ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t i1 = Range [tid], i2 = Range [tid+1] ;
+        if (tid == 0) Tp [0] = 0 ;
+        for (int64_t i = i1 ; i < i2 ; i++)
+        {
+            Tp [i+1] = Ap [i+1] ;
+        }
+        int64_t p1 = Ap [i1], p2 = Ap [i2] ;
+        memcpy (Tj + p1, Aj + p1, (p2 - p1) * sizeof (GrB_Index)) ;
+        if (!iso)
+        {
+            memcpy (((uint8_t *) Tx) + p1 * tsize,
+                ((uint8_t *) Ax) + p1 * tsize, (p2 - p1) * tsize) ;
+        }
+    }
+    if (iso)
+    {
+        memcpy (Tx, Ax, tsize) ;
+    }
+
+    GRB_TRY (GxB_Matrix_pack_CSR (A, &Tp, &Tj, &Tx, Tp_size, Tj_size,
+        Tx_size, iso, jumbled, NULL)) ;
+
+    // the old arrays are owned by LAGraph after the unpack
+    LAGraph_Free ((void **) &Ap, NULL) ;
+    LAGraph_Free ((void **) &Aj, NULL) ;
+    LAGraph_Free ((void **) &Ax, NULL) ;
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    LAGraph_Free ((void **) &Perm, NULL) ;          \
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_PartitionLayout
+//------------------------------------------------------------------------------
+
+int LAGraph_PartitionLayout
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to renumber in place
+    // output:
+    int64_t **P,            // permutation of size n; may be NULL
+    int64_t *Bounds,        // array of size nparts+1; may be NULL
+    // input:
+    const GrB_Vector part,  // part(i) = k if node i is in part k
+    int nparts,             // number of parts
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *Key = NULL, *W = NULL, *Count = NULL, *Perm = NULL ;
+    if (P != NULL) (*P) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (part != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (nparts >= 1, GrB_INVALID_VALUE, "nparts must be >= 1") ;
+
+    GrB_Index n, psize, np ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Vector_size (&psize, part)) ;
+    LG_ASSERT_MSG (psize == n, GrB_DIMENSION_MISMATCH,
+        "part must have size n") ;
+
+    //--------------------------------------------------------------------------
+    // Key = dense copy of part, and count the size of each part
+    //--------------------------------------------------------------------------
+
+    // nodes not present in part are placed in part 0
+    LG_TRY (LAGraph_Calloc ((void **) &Key, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &W, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Perm, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Count, nparts + 1, sizeof (int64_t),
+        msg)) ;
+    np = n ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 ((GrB_Index *) Perm, W, &np,
+        part)) ;
+    for (int64_t k = 0 ; k < (int64_t) np ; k++)
+    {
+        LG_ASSERT_MSG (W [k] >= 0 && W [k] < nparts, GrB_INVALID_VALUE,
+            "part(i) must be in the range 0 to nparts-1") ;
+        Key [Perm [k]] = W [k] ;
+    }
+    for (int64_t i = 0 ; i < (int64_t) n ; i++)
+    {
+        Count [Key [i] + 1]++ ;
+        Perm [i] = i ;
+    }
+    for (int k = 0 ; k < nparts ; k++)
+    {
+        Count [k+1] += Count [k] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // renumber G so that the nodes are sorted by (part, node)
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_msort2 (Key, Perm, n, msg)) ;
+    LG_TRY (LAGraph_Permute (G, Perm, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // first touch each row block with the threads of its part
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+    LG_TRY (LG_first_touch (G->A, Count, nparts, msg)) ;
+    if (G->AT != NULL)
+    {
+        LG_TRY (LG_first_touch (G->AT, Count, nparts, msg)) ;
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (Bounds != NULL)
+    {
+        memcpy (Bounds, Count, (nparts + 1) * sizeof (int64_t)) ;
+    }
+    if (P != NULL)
+    {
+        (*P) = Perm ;
+        Perm = NULL ;
+    }
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+// LAGraph_Permute: renumber the nodes of a graph with a given permutation
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_Permute renumbers the nodes of G in place, so that node P [k] of the
+// input graph becomes node k of the output graph: G->A = G->A (P,P).  The
+// cached G->AT, G->out_degree, and G->in_degree are permuted along with G->A,
+// if present.  The other cached properties do not depend on the node
+// numbering and are left unchanged.  P is not checked; it must be a
+// permutation of 0:n-1.  This is used by LAGraph_Reorder and
+// LAGraph_PartitionLayout.
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    GrB_free (&C) ;                                 \
+    GrB_free (&CT) ;                                \
+    GrB_free (&dout) ;                              \
+    GrB_free (&din) ;                               \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_Permute
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to renumber in place
+    // input:
+    const int64_t *P,       // permutation of size n
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix C = NULL, CT = NULL ;
+    GrB_Vector dout = NULL, din = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (P != NULL, GrB_NULL_POINTER) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+
+    //--------------------------------------------------------------------------
+    // permute G->A, G->AT, G->out_degree, and G->in_degree
+    //--------------------------------------------------------------------------
+
+    GrB_Index *Pi = (GrB_Index *) P ;
+    char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+    GrB_Type atype ;
+    LG_TRY (LAGraph_Matrix_TypeName (atype_name, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&atype, atype_name, msg)) ;
+
+    GRB_TRY (GrB_Matrix_new (&C, atype, n, n)) ;
+    GRB_TRY (GrB_extract (C, NULL, NULL, A, Pi, n, Pi, n, NULL)) ;
+    if (G->AT != NULL)
+    {
+        GRB_TRY (GrB_Matrix_new (&CT, atype, n, n)) ;
+        GRB_TRY (GrB_extract (CT, NULL, NULL, G->AT, Pi, n, Pi, n, NULL)) ;
+    }
+    if (G->out_degree != NULL)
+    {
+        GRB_TRY (GrB_Vector_new (&dout, GrB_INT64, n)) ;
+        GRB_TRY (GrB_extract (dout, NULL, NULL, G->out_degree, Pi, n, NULL)) ;
+    }
+    if (G->in_degree != NULL)
+    {
+        GRB_TRY (GrB_Vector_new (&din, GrB_INT64, n)) ;
+        GRB_TRY (GrB_extract (din, NULL, NULL, G->in_degree, Pi, n, NULL)) ;
+    }
+
+    // all GraphBLAS work is done; G can now be safely modified
+    GrB_free (&(G->A)) ;
+    G->A = C ; C = NULL ;
+    GrB_free (&(G->AT)) ;
+    G->AT = CT ; CT = NULL ;
+    GrB_free (&(G->out_degree)) ;
+    G->out_degree = dout ; dout = NULL ;
+    GrB_free (&(G->in_degree)) ;
+    G->in_degree = din ; din = NULL ;
+    return (GrB_SUCCESS) ;
+}
@@ -15,77 +15,443 @@
 
 //------------------------------------------------------------------------------
 
-// A very simple thread-safe parallel pseudo-random nuumber generator.
-
-// FUTURE: add LAGraph_Random_Init to LAGraph_Init,
-// and added LAGraph_Random_Finalize to LAGraph_Finalize.
+// A counter-based, thread-safe, parallel pseudo-random number generator.
+
+// Each random value is computed from a key (derived from the seed) and a
+// counter, with the SplitMix64 mixing function (LG_rand_counter in
+// LG_internal.h).  LAGraph_Random_FillVector and LAGraph_Random_FillMatrix
+// use the index of each entry as its counter (i for v(i), and i*ncols+j for
+// A(i,j)), so the value of an entry depends only on the seed and its
+// position: not on the sparsity structure, the storage format, or the number
+// of threads.  With SuiteSparse:GraphBLAS, the values are written directly
+// into the unpacked arrays by a parallel loop, at about the speed of memory.
+
+// Earlier versions of these methods used a linear congruential generator
+// applied through a user-defined GrB_UnaryOp, which could not be vectorized
+// and had poor low-order bits.  LAGraph_Random_Init and
+// LAGraph_Random_Finalize are no longer needed, but are kept so that existing
+// code still works.
 
 #include "LG_internal.h"
 #include "LAGraphX.h"
 
 //------------------------------------------------------------------------------
-// LG_RAND macros
+// LG_rand_type: the types that can be filled with random values
 //------------------------------------------------------------------------------
 
-// Generate the next seed
-#define LG_RAND_NEXT(seed) ((seed) * 1103515245 + 12345)
+typedef enum
+{
+    LG_RAND_BOOL, LG_RAND_INT8, LG_RAND_INT16, LG_RAND_INT32, LG_RAND_INT64,
+    LG_RAND_UINT8, LG_RAND_UINT16, LG_RAND_UINT32, LG_RAND_UINT64,
+    LG_RAND_FP32, LG_RAND_FP64, LG_RAND_UNSUPPORTED
+}
+LG_rand_type ;
 
-// extract a random 15-bit value from a seed (no longer used)
-// #define LG_RAND_15_MAX 32767
-// #define LG_RAND_15(seed) (((seed)/65536) % (LG_RAND_15_MAX + 1))
+static LG_rand_type LG_rand_typecode (GrB_Type type)
+{
+    if (type == GrB_BOOL  ) return (LG_RAND_BOOL) ;
+    if (type == GrB_INT8  ) return (LG_RAND_INT8) ;
+    if (type == GrB_INT16 ) return (LG_RAND_INT16) ;
+    if (type == GrB_INT32 ) return (LG_RAND_INT32) ;
+    if (type == GrB_INT64 ) return (LG_RAND_INT64) ;
+    if (type == GrB_UINT8 ) return (LG_RAND_UINT8) ;
+    if (type == GrB_UINT16) return (LG_RAND_UINT16) ;
+    if (type == GrB_UINT32) return (LG_RAND_UINT32) ;
+    if (type == GrB_UINT64) return (LG_RAND_UINT64) ;
+    if (type == GrB_FP32  ) return (LG_RAND_FP32) ;
+    if (type == GrB_FP64  ) return (LG_RAND_FP64) ;
+    return (LG_RAND_UNSUPPORTED) ;
+}
 
 //------------------------------------------------------------------------------
-// global operator
+// LG_rand_set: X [k] = a random value of the given type, from u
 //------------------------------------------------------------------------------
 
-// This operator can be shared by all threads in a user application, and thus
-// is safely declared as a global object.
+// Integers are the low bits of u (all bits of SplitMix64 are equally good), a
+// bool is the top bit of u, and floating-point values are uniform in [0,1),
+// from the top 24 (float) or 53 (double) bits of u.
 
-GrB_UnaryOp LG_rand_next_op = NULL ;
+static inline void LG_rand_set
+(
+    void *X,
+    int64_t k,
+    LG_rand_type tcode,
+    uint64_t u
+)
+{
+    switch (tcode)
+    {
+        case LG_RAND_BOOL   : ((bool     *) X) [k] = (bool) (u >> 63) ; break ;
+        case LG_RAND_INT8   : ((int8_t   *) X) [k] = (int8_t  ) u ; break ;
+        case LG_RAND_INT16  : ((int16_t  *) X) [k] = (int16_t ) u ; break ;
+        case LG_RAND_INT32  : ((int32_t  *) X) [k] = (int32_t ) u ; break ;
+        case LG_RAND_INT64  : ((int64_t  *) X) [k] = (int64_t ) u ; break ;
+        case LG_RAND_UINT8  : ((uint8_t  *) X) [k] = (uint8_t ) u ; break ;
+        case LG_RAND_UINT16 : ((uint16_t *) X) [k] = (uint16_t) u ; break ;
+        case LG_RAND_UINT32 : ((uint32_t *) X) [k] = (uint32_t) u ; break ;
+        case LG_RAND_UINT64 : ((uint64_t *) X) [k] = u ; break ;
+        case LG_RAND_FP32   :
+            ((float  *) X) [k] = ((float ) (u >> 40)) * 0x1.0p-24f ; break ;
+        case LG_RAND_FP64   :
+            ((double *) X) [k] = ((double) (u >> 11)) * 0x1.0p-53 ; break ;
+        default: ;
+    }
+}
 
 //------------------------------------------------------------------------------
-// LG_rand_next_f:  unary operator to construct the next seed
+// LG_rand_fill: fill an array of values with random values
 //------------------------------------------------------------------------------
 
-// z = f(x), where x is the old seed and z is the new seed.
+// The entry with counter c is given the value LG_rand_counter (key, c).  The
+// counter of entry p is i*ncols + Ai [p] if Ap is not NULL (entry p in row i
+// of a CSR matrix), Ai [p] if Ap is NULL (a sparse vector, or a list of
+// counters), or p itself if both Ap and Ai are NULL (a full vector, or a full
+// matrix held by row).
 
-void LG_rand_next_f (void *z, const void *x)
+static void LG_rand_fill
+(
+    void *X,                    // array of size nvals to fill
+    LG_rand_type tcode,         // type of X
+    uint64_t key,               // from the random number seed
+    const GrB_Index *Ap,        // CSR row pointers of size nrows+1, or NULL
+    const GrB_Index *Ai,        // column indices or counters, or NULL
+    int64_t nrows,              // # of rows, if Ap is not NULL
+    uint64_t ncols,             // # of columns, if Ap is not NULL
+    int64_t nvals               // # of entries
+)
 {
-    uint64_t seed = (*((uint64_t *) x)) ;
-    seed = LG_RAND_NEXT (seed) ;
-    seed = LG_RAND_NEXT (seed) ;
-    seed = LG_RAND_NEXT (seed) ;
-    seed = LG_RAND_NEXT (seed) ;
-    seed = LG_RAND_NEXT (seed) ;
-    (*((uint64_t *) z)) = seed ;
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, nvals / 4096) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    int64_t k ;
+    if (Ap != NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+        for (k = 0 ; k < nrows ; k++)
+        {
+            uint64_t c = ((uint64_t) k) * ncols ;
+            for (int64_t p = Ap [k] ; p < (int64_t) Ap [k+1] ; p++)
+            {
+                LG_rand_set (X, p, tcode, LG_rand_counter (key, c + Ai [p])) ;
+            }
+        }
+    }
+    else if (Ai != NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nvals ; k++)
+        {
+            LG_rand_set (X, k, tcode, LG_rand_counter (key, Ai [k])) ;
+        }
+    }
+    else
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nvals ; k++)
+        {
+            LG_rand_set (X, k, tcode, LG_rand_counter (key, k)) ;
+        }
+    }
 }
 
+#if !LAGRAPH_SUITESPARSE
+
 //------------------------------------------------------------------------------
-// LAGraph_Random_Init:  create the random seed operator
+// LG_rand_vanilla_type: type of the workspace for the vanilla methods
 //------------------------------------------------------------------------------
 
-#undef  LG_FREE_WORK
-#define LG_FREE_WORK                                        \
-{                                                           \
-    GrB_UnaryOp_free (&LG_rand_next_op) ;                   \
+// Without SuiteSparse:GraphBLAS, the random values are built into a workspace
+// of type bool, uint64_t, float, or double, which is then typecast into the
+// output by GrB_assign.  The typecast from uint64_t to any integer type takes
+// its low bits, just as LG_rand_set does.
+
+static LG_rand_type LG_rand_vanilla_type (LG_rand_type tcode, GrB_Type *ttype,
+    size_t *tsize)
+{
+    switch (tcode)
+    {
+        case LG_RAND_BOOL :
+            (*ttype) = GrB_BOOL   ; (*tsize) = sizeof (bool) ;     break ;
+        case LG_RAND_FP32 :
+            (*ttype) = GrB_FP32   ; (*tsize) = sizeof (float) ;    break ;
+        case LG_RAND_FP64 :
+            (*ttype) = GrB_FP64   ; (*tsize) = sizeof (double) ;   break ;
+        default :
+            (*ttype) = GrB_UINT64 ; (*tsize) = sizeof (uint64_t) ;
+            tcode = LG_RAND_UINT64 ;
+            break ;
+    }
+    return (tcode) ;
 }
 
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_Random_Init:  no longer needed
+//------------------------------------------------------------------------------
+
 int LAGraph_Random_Init (char *msg)
 {
     LG_CLEAR_MSG ;
-    LG_rand_next_op = NULL ;
-    GRB_TRY (GrB_UnaryOp_new (&LG_rand_next_op, LG_rand_next_f,
-        GrB_UINT64, GrB_UINT64)) ;
     return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
-// LAGraph_Random_Finalize:  free the random seed operator
+// LAGraph_Random_Finalize:  no longer needed
 //------------------------------------------------------------------------------
 
 int LAGraph_Random_Finalize (char *msg)
 {
     LG_CLEAR_MSG ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Random_FillVector: fill the entries of a vector with random values
+//------------------------------------------------------------------------------
+
+// Each entry v(i) present in V is given a random value that depends only on
+// the seed and i.  The sparsity pattern of V is unchanged.  V may have any
+// built-in type (see LG_rand_set for the distribution of each type).
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &X, NULL) ;         \
+    GrB_free (&T) ;                             \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LG_FREE_WORK
+
+int LAGraph_Random_FillVector
+(
+    // input/output
+    GrB_Vector V,       // vector to fill; its sparsity pattern is unchanged
+    // input
+    uint64_t seed,      // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL ;
+    void *X = NULL ;
+    GrB_Vector T = NULL ;
+    LG_ASSERT (V != NULL, GrB_NULL_POINTER) ;
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    GrB_Type type ;
+    LG_TRY (LAGraph_Vector_TypeName (type_name, V, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&type, type_name, msg)) ;
+    LG_rand_type tcode = LG_rand_typecode (type) ;
+    LG_ASSERT_MSG (tcode != LG_RAND_UNSUPPORTED, GrB_NOT_IMPLEMENTED,
+        "unsupported type") ;
+    uint64_t key = LG_rand_mix (seed) ;
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Vector_size (&n, V)) ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, V)) ;
+    if (nvals == 0) return (GrB_SUCCESS) ;
+
+    #if LAGRAPH_SUITESPARSE
+    {
+
+        //----------------------------------------------------------------------
+        // unpack V, fill its values in place, and pack it back
+        //----------------------------------------------------------------------
+
+        // V is unpacked as non-iso, so X has room for all nvals values
+        GrB_Index I_size, X_size ;
+        bool jumbled ;
+        if (nvals == n)
+        {
+            GRB_TRY (GxB_Vector_unpack_Full (V, &X, &X_size, NULL, NULL)) ;
+            LG_rand_fill (X, tcode, key, NULL, NULL, 0, 0, nvals) ;
+            GRB_TRY (GxB_Vector_pack_Full (V, &X, X_size, false, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Vector_unpack_CSC (V, &I, &X, &I_size, &X_size, NULL,
+                &nvals, &jumbled, NULL)) ;
+            LG_rand_fill (X, tcode, key, NULL, I, 0, 0, nvals) ;
+            GRB_TRY (GxB_Vector_pack_CSC (V, &I, &X, I_size, X_size, false,
+                nvals, jumbled, NULL)) ;
+        }
+
+    }
+    #else
+    {
+
+        //----------------------------------------------------------------------
+        // T = random values with the pattern of V, then V = (type) T
+        //----------------------------------------------------------------------
+
+        GrB_Type ttype ;
+        size_t tsize ;
+        tcode = LG_rand_vanilla_type (tcode, &ttype, &tsize) ;
+        LG_TRY (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &X, nvals, tsize, msg)) ;
+        GRB_TRY (GrB_Vector_extractTuples_BOOL (I, NULL, &nvals, V)) ;
+        LG_rand_fill (X, tcode, key, NULL, I, 0, 0, nvals) ;
+        GRB_TRY (GrB_Vector_new (&T, ttype, n)) ;
+        switch (tcode)
+        {
+            case LG_RAND_BOOL :
+                GRB_TRY (GrB_Vector_build_BOOL (T, I, X, nvals, GrB_LOR)) ;
+                break ;
+            case LG_RAND_FP32 :
+                GRB_TRY (GrB_Vector_build_FP32 (T, I, X, nvals,
+                    GrB_PLUS_FP32)) ;
+                break ;
+            case LG_RAND_FP64 :
+                GRB_TRY (GrB_Vector_build_FP64 (T, I, X, nvals,
+                    GrB_PLUS_FP64)) ;
+                break ;
+            default :
+                GRB_TRY (GrB_Vector_build_UINT64 (T, I, X, nvals,
+                    GrB_PLUS_UINT64)) ;
+                break ;
+        }
+        GRB_TRY (GrB_assign (V, NULL, NULL, T, GrB_ALL, n, NULL)) ;
+
+    }
+    #endif
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Random_FillMatrix: fill the entries of a matrix with random values
+//------------------------------------------------------------------------------
+
+// Each entry A(i,j) present in A is given a random value that depends only on
+// the seed and the position i*ncols+j.  The sparsity pattern of A is
+// unchanged.  A may have any built-in type (see LG_rand_set).
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &J, NULL) ;         \
+    LAGraph_Free ((void **) &Cnt, NULL) ;       \
+    LAGraph_Free ((void **) &X, NULL) ;         \
+    GrB_free (&T) ;                             \
+}
+
+int LAGraph_Random_FillMatrix
+(
+    // input/output
+    GrB_Matrix A,       // matrix to fill; its sparsity pattern is unchanged
+    // input
+    uint64_t seed,      // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    uint64_t *Cnt = NULL ;
+    void *X = NULL ;
+    GrB_Matrix T = NULL ;
+    LG_ASSERT (A != NULL, GrB_NULL_POINTER) ;
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    GrB_Type type ;
+    LG_TRY (LAGraph_Matrix_TypeName (type_name, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&type, type_name, msg)) ;
+    LG_rand_type tcode = LG_rand_typecode (type) ;
+    LG_ASSERT_MSG (tcode != LG_RAND_UNSUPPORTED, GrB_NOT_IMPLEMENTED,
+        "unsupported type") ;
+    uint64_t key = LG_rand_mix (seed) ;
+
+    GrB_Index nrows, ncols, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    if (nvals == 0) return (GrB_SUCCESS) ;
+
+    #if LAGRAPH_SUITESPARSE
+    {
+
+        //----------------------------------------------------------------------
+        // unpack A by row, fill its values in place, and pack it back
+        //----------------------------------------------------------------------
+
+        // A is unpacked as non-iso, so X has room for all nvals values
+        GrB_Index I_size, J_size, X_size ;
+        bool jumbled ;
+        if (((double) nrows) * ((double) ncols) == (double) nvals)
+        {
+            GRB_TRY (GxB_Matrix_unpack_FullR (A, &X, &X_size, NULL, NULL)) ;
+            LG_rand_fill (X, tcode, key, NULL, NULL, 0, 0, nvals) ;
+            GRB_TRY (GxB_Matrix_pack_FullR (A, &X, X_size, false, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Matrix_unpack_CSR (A, &I, &J, &X, &I_size, &J_size,
+                &X_size, NULL, &jumbled, NULL)) ;
+            LG_rand_fill (X, tcode, key, I, J, nrows, ncols, nvals) ;
+            GRB_TRY (GxB_Matrix_pack_CSR (A, &I, &J, &X, I_size, J_size,
+                X_size, false, jumbled, NULL)) ;
+        }
+
+    }
+    #else
+    {
+
+        //----------------------------------------------------------------------
+        // T = random values with the pattern of A, then A = (type) T
+        //----------------------------------------------------------------------
+
+        GrB_Type ttype ;
+        size_t tsize ;
+        tcode = LG_rand_vanilla_type (tcode, &ttype, &tsize) ;
+        LG_TRY (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Cnt, nvals, sizeof (uint64_t),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &X, nvals, tsize, msg)) ;
+        GRB_TRY (GrB_Matrix_extractTuples_BOOL (I, J, NULL, &nvals, A)) ;
+        // Cnt [k] = the counter of the kth entry A(i,j)
+        for (int64_t k = 0 ; k < (int64_t) nvals ; k++)
+        {
+            Cnt [k] = I [k] * ncols + J [k] ;
+        }
+        LG_rand_fill (X, tcode, key, NULL, Cnt, 0, 0, nvals) ;
+        GRB_TRY (GrB_Matrix_new (&T, ttype, nrows, ncols)) ;
+        switch (tcode)
+        {
+            case LG_RAND_BOOL :
+                GRB_TRY (GrB_Matrix_build_BOOL (T, I, J, X, nvals, GrB_LOR)) ;
+                break ;
+            case LG_RAND_FP32 :
+                GRB_TRY (GrB_Matrix_build_FP32 (T, I, J, X, nvals,
+                    GrB_PLUS_FP32)) ;
+                break ;
+            case LG_RAND_FP64 :
+                GRB_TRY (GrB_Matrix_build_FP64 (T, I, J, X, nvals,
+                    GrB_PLUS_FP64)) ;
+                break ;
+            default :
+                GRB_TRY (GrB_Matrix_build_UINT64 (T, I, J, X, nvals,
+                    GrB_PLUS_UINT64)) ;
+                break ;
+        }
+        GRB_TRY (GrB_assign (A, NULL, NULL, T, GrB_ALL, nrows, GrB_ALL, ncols,
+            NULL)) ;
+
+    }
+    #endif
+
     LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
@@ -96,10 +462,10 @@ int LAGraph_Random_Finalize (char *msg)
 
 // Initializes a vector with random seed values.  The Seed vector must be
 // allocated on input, and should be of type GrB_UINT64.  Its sparsity
-// structure is unchanged.
+// structure is unchanged.  Seed (i) depends only on seed and i.
 
 #undef  LG_FREE_WORK
-#define LG_FREE_WORK GrB_free (&T) ;
+#define LG_FREE_WORK ;
 
 #if defined ( COVERAGE )
 // for testing only
@@ -117,26 +483,10 @@ int LAGraph_Random_Seed     // construct a random seed vector
 {
     // check inputs
     LG_CLEAR_MSG ;
-    GrB_Vector T = NULL ;
     LG_ASSERT (Seed != NULL, GrB_NULL_POINTER) ;
 
-    // T = 1:n but only for entries present in the Seed vector.  This
-    // requires a typecast from int64 to uint64.
-    GrB_Index n ;
-    GRB_TRY (GrB_Vector_size (&n, Seed)) ;
-    GRB_TRY (GrB_Vector_new (&T, GrB_UINT64, n)) ;
-    GRB_TRY (GrB_Vector_apply_IndexOp_INT64 (T, NULL, NULL,
-        GrB_ROWINDEX_INT64, Seed, 1, NULL)) ;
-
-    // Seed = T * INT32_MAX
-    GRB_TRY (GrB_apply (Seed, NULL, NULL, GrB_TIMES_UINT64, T,
-        (uint64_t) INT32_MAX, NULL)) ;
-
-    // Seed = Seed + seed
-    GRB_TRY (GrB_apply (Seed, NULL, NULL, GrB_PLUS_UINT64, Seed, seed, NULL)) ;
-
-    // Seed = next (Seed)
-    GRB_TRY (GrB_Vector_apply (Seed, NULL, NULL, LG_rand_next_op, Seed, NULL)) ;
+    // Seed (i) = LG_rand_counter (key, i) for each entry present in Seed
+    LG_TRY (LAGraph_Random_FillVector (Seed, seed, msg)) ;
 
     #if defined ( COVERAGE )
     if (random_hack)
@@ -149,7 +499,6 @@ int LAGraph_Random_Seed     // construct a random seed vector
     }
     #endif
 
-    LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
 
@@ -157,8 +506,16 @@ int LAGraph_Random_Seed     // construct a random seed vector
 // LAGraph_Random_Next: return next vector of random seeds
 //------------------------------------------------------------------------------
 
+// Each seed s is replaced with LG_rand_mix (s + LG_RAND_GAMMA), the next step
+// of a SplitMix64 sequence started at s.  This is a bijection, so distinct
+// seeds remain distinct.
+
 #undef  LG_FREE_WORK
-#define LG_FREE_WORK ;
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &X, NULL) ;         \
+}
 
 int LAGraph_Random_Next     // advance to next random vector
 (
@@ -167,10 +524,85 @@ int LAGraph_Random_Next     // advance to next random vector
     char *msg
 )
 {
+
+    //--------------------------------------------------------------------------
     // check inputs
+    //--------------------------------------------------------------------------
+
     LG_CLEAR_MSG ;
+    GrB_Index *I = NULL ;
+    uint64_t *X = NULL ;
     LG_ASSERT (Seed != NULL, GrB_NULL_POINTER) ;
-    // Seed = next (Seed)
-    GRB_TRY (GrB_Vector_apply (Seed, NULL, NULL, LG_rand_next_op, Seed, NULL)) ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Vector_size (&n, Seed)) ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, Seed)) ;
+    if (nvals == 0) return (GrB_SUCCESS) ;
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, nvals / 4096) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    int64_t k ;
+
+    #if LAGRAPH_SUITESPARSE
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    GrB_Type type ;
+    LG_TRY (LAGraph_Vector_TypeName (type_name, Seed, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&type, type_name, msg)) ;
+    if (type == GrB_UINT64)
+    {
+
+        //----------------------------------------------------------------------
+        // unpack Seed, advance each seed in place, and pack it back
+        //----------------------------------------------------------------------
+
+        GrB_Index I_size, X_size ;
+        bool iso, jumbled ;
+        if (nvals == n)
+        {
+            GRB_TRY (GxB_Vector_unpack_Full (Seed, (void **) &X, &X_size,
+                &iso, NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Vector_unpack_CSC (Seed, &I, (void **) &X, &I_size,
+                &X_size, &iso, &nvals, &jumbled, NULL)) ;
+        }
+        // if Seed is iso, all its seeds are the same, and stay that way
+        int64_t nx = iso ? 1 : nvals ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nx ; k++)
+        {
+            X [k] = LG_rand_mix (X [k] + LG_RAND_GAMMA) ;
+        }
+        if (nvals == n)
+        {
+            GRB_TRY (GxB_Vector_pack_Full (Seed, (void **) &X, X_size, iso,
+                NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GxB_Vector_pack_CSC (Seed, &I, (void **) &X, I_size,
+                X_size, iso, nvals, jumbled, NULL)) ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // extract the seeds, advance them, and put them back in Seed
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, nvals, sizeof (uint64_t), msg)) ;
+    GRB_TRY (GrB_Vector_extractTuples_UINT64 (I, X, &nvals, Seed)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < (int64_t) nvals ; k++)
+    {
+        X [k] = LG_rand_mix (X [k] + LG_RAND_GAMMA) ;
+    }
+    GRB_TRY (GrB_Vector_clear (Seed)) ;
+    GRB_TRY (GrB_Vector_build_UINT64 (Seed, I, X, nvals, GrB_PLUS_UINT64)) ;
+
+    LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
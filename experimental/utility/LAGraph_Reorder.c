@@ -0,0 +1,392 @@
+//------------------------------------------------------------------------------
+// LAGraph_Reorder: renumber the nodes of a graph for better memory locality
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_Reorder computes a permutation P of the nodes of G and renumbers G
+// in place, so that node P [k] of the input graph becomes node k of the
+// output graph: G->A = G->A (P,P), with LAGraph_Permute.  The cached
+// properties of G are permuted along with G->A (G->AT, G->out_degree, and
+// G->in_degree); the others do not depend on the node numbering and are left
+// unchanged.
+
+// The ordering methods are:
+
+// LAGraph_REORDER_DEGREE: nodes in descending order of out-degree, with ties
+//      broken by node number.  High-degree nodes, which are accessed most
+//      often, are placed together.
+
+// LAGraph_REORDER_HUB_CLUSTER: hub nodes (those with an out-degree larger
+//      than the average) first, then all others.  The original order is
+//      kept within each group, so the locality of the original numbering is
+//      mostly preserved.  The partition is a parallel stable prefix sum.
+
+// LAGraph_REORDER_RCM: reverse Cuthill-McKee, which reduces the bandwidth of
+//      the structure of A+A'.  Isolated nodes are placed last, with no
+//      traversal.  Each other connected component is traversed breadth-first
+//      from an unvisited node of minimum degree.  The nodes of each BFS level
+//      are found with a single GrB_vxm, which also finds the position of the
+//      first visited neighbor of each node (a min.first semiring), and each
+//      level is then sorted in parallel by that position, by degree, and by
+//      node number (LG_msort3).  The ranks of a whole level are set with one
+//      GrB_assign.
+
+// LAGraph_REORDER_COMMUNITY: nodes of each community are placed together,
+//      in the spirit of Rabbit order and Gorder.  The communities are found
+//      with a few iterations of label propagation (LAGraph_cdlp), and the
+//      nodes are sorted in parallel by community, then by descending degree.
+//      The full Rabbit order (incremental aggregation into a dendrogram) and
+//      Gorder (a sliding-window greedy score) are sequential heuristics and
+//      are not used here.
+
+// On output, *P is the permutation, of size n, if P is not NULL.  It must be
+// freed by LAGraph_Free.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &W0, NULL) ;            \
+    LAGraph_Free ((void **) &W1, NULL) ;            \
+    LAGraph_Free ((void **) &W2, NULL) ;            \
+    LAGraph_Free ((void **) &Degree, NULL) ;        \
+    LAGraph_Free ((void **) &Start, NULL) ;         \
+    LAGraph_Free ((void **) &Count, NULL) ;         \
+    LAGraph_Free ((void **) &visited, NULL) ;       \
+    GrB_free (&S) ;                                 \
+    GrB_free (&q) ;                                 \
+    GrB_free (&next) ;                              \
+    GrB_free (&rank) ;                              \
+    GrB_free (&label) ;                             \
+    GrB_free (&dout) ;                              \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    LAGraph_Free ((void **) &Perm, NULL) ;          \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// number of label propagation iterations for LAGraph_REORDER_COMMUNITY
+#define LG_REORDER_CDLP_ITERS 10
+
+int LAGraph_Reorder
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to renumber in place
+    // output:
+    int64_t **P,            // permutation of size n; may be NULL
+    // input:
+    LAGraph_ReorderMethod method,   // ordering method to use
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *Perm = NULL, *W0 = NULL, *W1 = NULL, *W2 = NULL, *Degree = NULL,
+        *Start = NULL, *Count = NULL ;
+    bool *visited = NULL ;
+    GrB_Matrix S = NULL ;
+    GrB_Vector q = NULL, next = NULL, rank = NULL, label = NULL,
+        dout = NULL ;
+    if (P != NULL) (*P) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (method == LAGraph_REORDER_DEGREE ||
+        method == LAGraph_REORDER_HUB_CLUSTER ||
+        method == LAGraph_REORDER_RCM ||
+        method == LAGraph_REORDER_COMMUNITY, GrB_INVALID_VALUE,
+        "method not recognized") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    bool symmetric = (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE) ;
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, (int64_t) n / 4096) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // Degree = dense copy of the out-degree (or the degree of A+A' for RCM)
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    GrB_Vector d = G->out_degree ;
+    if (method == LAGraph_REORDER_RCM && !symmetric)
+    {
+        // S = structure of A+A', and d = its row degree
+        GRB_TRY (GrB_Matrix_new (&S, GrB_BOOL, n, n)) ;
+        if (G->AT != NULL)
+        {
+            GRB_TRY (GrB_eWiseAdd (S, NULL, NULL, GrB_ONEB_BOOL, A, G->AT,
+                NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GrB_eWiseAdd (S, NULL, NULL, GrB_ONEB_BOOL, A, A,
+                GrB_DESC_T1)) ;
+        }
+        GRB_TRY (GrB_Vector_new (&dout, GrB_INT64, n)) ;
+        GRB_TRY (GrB_reduce (dout, NULL, NULL, GrB_PLUS_MONOID_INT64, S,
+            NULL)) ;
+        d = dout ;
+    }
+
+    GrB_Index nd = n ;
+    LG_TRY (LAGraph_Calloc ((void **) &Degree, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &W0, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &W1, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &W2, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Perm, n, sizeof (int64_t), msg)) ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 ((GrB_Index *) W0, W1, &nd, d)) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < (int64_t) nd ; k++)
+    {
+        Degree [W0 [k]] = W1 [k] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the permutation
+    //--------------------------------------------------------------------------
+
+    switch (method)
+    {
+
+        //----------------------------------------------------------------------
+        case LAGraph_REORDER_DEGREE:
+        //----------------------------------------------------------------------
+
+            // sort by (-Degree, node)
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < (int64_t) n ; k++)
+            {
+                W0 [k] = -Degree [k] ;
+                Perm [k] = k ;
+            }
+            LG_TRY (LG_msort2 (W0, Perm, n, msg)) ;
+            break ;
+
+        //----------------------------------------------------------------------
+        case LAGraph_REORDER_HUB_CLUSTER:
+        //----------------------------------------------------------------------
+
+        {
+            // a hub has a degree larger than the average degree
+            double davg = (n == 0) ? 0 : (((double) nvals) / n) ;
+            LG_TRY (LAGraph_Calloc ((void **) &Count, 2*nthreads + 2,
+                sizeof (int64_t), msg)) ;
+            int tid ;
+
+            // count the hubs and non-hubs in each slice of the nodes
+            #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t kfirst = LG_PART (tid, n, nthreads) ;
+                int64_t klast  = LG_PART (tid+1, n, nthreads) ;
+                int64_t nhubs = 0 ;
+                for (int64_t i = kfirst ; i < klast ; i++)
+                {
+                    if (Degree [i] > davg) nhubs++ ;
+                }
+                Count [tid] = nhubs ;
+                Count [nthreads + tid] = (klast - kfirst) - nhubs ;
+            }
+
+            // cumulative sum: hubs of each slice, then non-hubs of each slice
+            int64_t s = 0 ;
+            for (tid = 0 ; tid < 2*nthreads ; tid++)
+            {
+                int64_t c = Count [tid] ;
+                Count [tid] = s ;
+                s += c ;
+            }
+
+            // scatter the nodes, keeping the original order in each group
+            #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t kfirst = LG_PART (tid, n, nthreads) ;
+                int64_t klast  = LG_PART (tid+1, n, nthreads) ;
+                int64_t phub = Count [tid] ;
+                int64_t pother = Count [nthreads + tid] ;
+                for (int64_t i = kfirst ; i < klast ; i++)
+                {
+                    if (Degree [i] > davg)
+                    {
+                        Perm [phub++] = i ;
+                    }
+                    else
+                    {
+                        Perm [pother++] = i ;
+                    }
+                }
+            }
+        }
+        break ;
+
+        //----------------------------------------------------------------------
+        case LAGraph_REORDER_RCM:
+        //----------------------------------------------------------------------
+
+        {
+            GrB_Matrix Sym = (S == NULL) ? A : S ;
+
+            // Start = nodes in ascending order of degree, to pick the root of
+            // each connected component
+            LG_TRY (LAGraph_Malloc ((void **) &Start, n, sizeof (int64_t),
+                msg)) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < (int64_t) n ; k++)
+            {
+                W0 [k] = Degree [k] ;
+                Start [k] = k ;
+            }
+            LG_TRY (LG_msort2 (W0, Start, n, msg)) ;
+            LG_TRY (LAGraph_Calloc ((void **) &visited, n, sizeof (bool),
+                msg)) ;
+
+            // rank(i) = position of node i in the Cuthill-McKee order
+            GRB_TRY (GrB_Vector_new (&rank, GrB_INT64, n)) ;
+            GRB_TRY (GrB_Vector_new (&q, GrB_INT64, n)) ;
+            GRB_TRY (GrB_Vector_new (&next, GrB_INT64, n)) ;
+
+            // isolated nodes lead the list Start; each is a component on its
+            // own and is placed at the front of the order without a BFS.  No
+            // node reaches them, so they are not added to rank.
+            int64_t nisolated = 0 ;
+            while (nisolated < (int64_t) n && W0 [nisolated] == 0) nisolated++ ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < nisolated ; k++)
+            {
+                int64_t i = Start [k] ;
+                Perm [k] = i ;
+                visited [i] = true ;
+            }
+
+            int64_t pos = nisolated, s = nisolated ;
+            while (pos < (int64_t) n)
+            {
+                // the root is an unvisited node of smallest degree, and is
+                // the first level of its component
+                while (visited [Start [s]]) s++ ;
+                W2 [0] = Start [s] ;
+                GrB_Index nq = 1 ;
+
+                while (true)
+                {
+                    // append the level W2 [0..nq-1] to the order, and make it
+                    // the frontier: q(i) = rank(i) = position of node i
+                    #pragma omp parallel for num_threads(nthreads) \
+                        schedule(static)
+                    for (k = 0 ; k < (int64_t) nq ; k++)
+                    {
+                        int64_t i = W2 [k] ;
+                        Perm [pos + k] = i ;
+                        visited [i] = true ;
+                        W0 [k] = pos + k ;
+                    }
+                    GRB_TRY (GrB_Vector_clear (q)) ;
+                    GRB_TRY (GrB_Vector_build (q, (GrB_Index *) W2, W0, nq,
+                        GrB_PLUS_INT64)) ;
+                    GRB_TRY (GrB_assign (rank, q, NULL, q, GrB_ALL, n,
+                        GrB_DESC_S)) ;
+                    pos += nq ;
+
+                    // next<!rank> = position of the first visited neighbor
+                    GRB_TRY (GrB_vxm (next, rank, NULL,
+                        GrB_MIN_FIRST_SEMIRING_INT64, q, Sym, GrB_DESC_RSC)) ;
+                    GRB_TRY (GrB_Vector_nvals (&nq, next)) ;
+                    if (nq == 0) break ;
+
+                    // sort the level by (parent position, degree, node)
+                    GRB_TRY (GrB_Vector_extractTuples_INT64 (
+                        (GrB_Index *) W2, W0, &nq, next)) ;
+                    #pragma omp parallel for num_threads(nthreads) \
+                        schedule(static)
+                    for (k = 0 ; k < (int64_t) nq ; k++)
+                    {
+                        W1 [k] = Degree [W2 [k]] ;
+                    }
+                    LG_TRY (LG_msort3 (W0, W1, W2, nq, msg)) ;
+                }
+            }
+
+            // reverse the Cuthill-McKee order
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < (int64_t) n ; k++)
+            {
+                W0 [k] = Perm [n-1-k] ;
+            }
+            memcpy (Perm, W0, n * sizeof (int64_t)) ;
+        }
+        break ;
+
+        //----------------------------------------------------------------------
+        case LAGraph_REORDER_COMMUNITY:
+        //----------------------------------------------------------------------
+
+        {
+            // label (i) = community of node i
+            double t [2] ;
+            LG_TRY (LAGraph_cdlp (&label, A, symmetric, true,
+                LG_REORDER_CDLP_ITERS, t, msg)) ;
+            GrB_Index nl = n ;
+            GRB_TRY (GrB_Vector_extractTuples_INT64 ((GrB_Index *) W2, W1,
+                &nl, label)) ;
+            LG_ASSERT (nl == n, GrB_INVALID_VALUE) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < (int64_t) n ; k++)
+            {
+                W0 [W2 [k]] = W1 [k] ;
+            }
+
+            // sort by (community, -Degree, node)
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < (int64_t) n ; k++)
+            {
+                W1 [k] = -Degree [k] ;
+                Perm [k] = k ;
+            }
+            LG_TRY (LG_msort3 (W0, W1, Perm, n, msg)) ;
+        }
+        break ;
+
+        default: ;
+    }
+
+    //--------------------------------------------------------------------------
+    // permute G->A, G->AT, G->out_degree, and G->in_degree
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Permute (G, Perm, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (P != NULL)
+    {
+        (*P) = Perm ;
+        Perm = NULL ;
+    }
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
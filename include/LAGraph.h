@@ -503,6 +503,126 @@ int LAGraph_Free            // free a block of memory and set p to NULL
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Workspace: a reusable pool of workspace memory
+//------------------------------------------------------------------------------
+
+/** LAGraph_Workspace: a pool of workspace memory, reused across calls to
+ * LAGraph.  Many LAGraph methods allocate and free large workspace arrays on
+ * each call.  An application that calls LAGraph many times from the same
+ * thread can create a workspace with LAGraph_Workspace_New and attach it to
+ * the thread with LAGraph_Workspace_Attach.  Workspace freed by LAGraph is
+ * then kept in the pools of the workspace, in free lists by size class, and
+ * reused by later calls instead of being returned to the system.  The
+ * attachment is thread-local: each thread should have its own workspace, and
+ * a workspace must be attached to at most one thread at a time.  Only
+ * internal workspace is drawn from the pools; the results of LAGraph methods
+ * are always allocated with LAGraph_Malloc.
+ */
+
+typedef struct LAGraph_Workspace_struct *LAGraph_Workspace ;
+
+/** LAGraph_Workspace_New: create a workspace, with empty pools.
+ *
+ * @param[out] ws       the new workspace.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if ws is NULL.
+ * @retval GrB_OUT_OF_MEMORY if out of memory.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Workspace_New
+(
+    // output:
+    LAGraph_Workspace *ws,  // the new workspace, with empty pools
+    char *msg
+) ;
+
+/** LAGraph_Workspace_Delete: free a workspace and all memory in its pools.
+ * If the workspace is attached to the calling thread, it is detached.  Does
+ * nothing if ws or *ws are NULL.
+ *
+ * @param[in,out] ws    the workspace to free; set to NULL on output.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_INVALID_VALUE if memory from the workspace is still in use.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Workspace_Delete
+(
+    // input/output:
+    LAGraph_Workspace *ws,  // workspace to free; set to NULL on output
+    char *msg
+) ;
+
+/** LAGraph_Workspace_Attach: attach a workspace to the calling thread, so
+ * that subsequent calls to LAGraph from this thread use it.  If ws is NULL,
+ * the current workspace of the calling thread (if any) is detached.
+ *
+ * @param[in] ws        the workspace to attach, or NULL.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_INVALID_OBJECT if ws is not a valid workspace.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Workspace_Attach
+(
+    // input:
+    LAGraph_Workspace ws,   // workspace to attach, or NULL to detach
+    char *msg
+) ;
+
+/** LAGraph_Workspace_Release: free all memory held in the pools of a
+ * workspace, and reset its high-water mark to the memory currently in use.
+ *
+ * @param[in,out] ws    the workspace.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if ws is NULL.
+ * @retval GrB_INVALID_OBJECT if ws is not a valid workspace.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Workspace_Release
+(
+    // input/output:
+    LAGraph_Workspace ws,
+    char *msg
+) ;
+
+/** LAGraph_Workspace_Stats: report the memory usage of a workspace, in bytes.
+ *
+ * @param[out] inuse        memory currently in use; may be NULL.
+ * @param[out] high_water   largest memory in use since the workspace was
+ *                          created or last released; may be NULL.
+ * @param[out] cached       memory held in the pools for reuse; may be NULL.
+ * @param[in] ws            the workspace.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if ws is NULL.
+ * @retval GrB_INVALID_OBJECT if ws is not a valid workspace.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Workspace_Stats
+(
+    // output:
+    size_t *inuse,          // bytes in blocks in use; may be NULL
+    size_t *high_water,     // high-water mark of inuse; may be NULL
+    size_t *cached,         // bytes held in the pools for reuse; may be NULL
+    // input:
+    const LAGraph_Workspace ws,
+    char *msg
+) ;
+
 //==============================================================================
 // LAGraph data structures
 //==============================================================================
@@ -1005,6 +1125,12 @@ int LAGraph_Cached_AT
  * graph G has a symmetric sparsity structure.  No work is performed if the
  * cached property is already known.
  *
+ * G->out_degree and G->in_degree are computed if not already known, and are
+ * compared first; if they differ, the structure is not symmetric.  Otherwise,
+ * the structure of G->A is compared with G->AT if it exists.  If it does not,
+ * SuiteSparse:GraphBLAS checks each row of G->A in place, in parallel,
+ * without computing G->AT; other GraphBLAS libraries compute G->AT.
+ *
  * @param[in,out] G     graph for which G->is_symmetric_structure is computed.
  * @param[in,out] msg   any error messages.
  *
@@ -1114,7 +1240,8 @@ int LAGraph_Cached_NSelfEdges
 //------------------------------------------------------------------------------
 
 /** LAGraph_Cached_EMin: computes the G->emin, the smallest entry in G->A.
- * Not computed if G->emin already exists.
+ * Not computed if G->emin already exists and G->emin_state is LAGraph_VALUE;
+ * a bound on the smallest entry is replaced with its exact value.
  *
  * @param[in,out] G     graph for which G->emin is computed.
  * @param[in,out] msg   any error messages.
@@ -1142,7 +1269,8 @@ int LAGraph_Cached_EMin
 //------------------------------------------------------------------------------
 
 /** LAGraph_Cached_EMax: computes the G->emax, the largest entry in G->A.
- * Not computed if G->emax already exists.
+ * Not computed if G->emax already exists and G->emax_state is LAGraph_VALUE;
+ * a bound on the largest entry is replaced with its exact value.
  *
  * @param[in,out] G     graph for which G->emax is computed.
  * @param[in,out] msg   any error messages.
@@ -1165,13 +1293,71 @@ int LAGraph_Cached_EMax
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Cached_All: compute a set of cached properties
+//------------------------------------------------------------------------------
+
+/** LAGraph_CacheFlags: selects the cached properties computed by
+ * @sphinxref{LAGraph_Cached_All}.  The flags are combined with a bitwise OR.
+ */
+
+typedef enum
+{
+    LAGraph_CACHE_AT = 1,                       /**< G->AT */
+    LAGraph_CACHE_OUT_DEGREE = 2,               /**< G->out_degree */
+    LAGraph_CACHE_IN_DEGREE = 4,                /**< G->in_degree */
+    LAGraph_CACHE_NSELF_EDGES = 8,              /**< G->nself_edges */
+    LAGraph_CACHE_IS_SYMMETRIC_STRUCTURE = 16,  /**< symmetric structure */
+    LAGraph_CACHE_EMIN = 32,                    /**< G->emin */
+    LAGraph_CACHE_EMAX = 64,                    /**< G->emax */
+    LAGraph_CACHE_ALL = 127                     /**< all of the above */
+}
+LAGraph_CacheFlags ;
+
+/** LAGraph_Cached_All: computes the cached properties of G selected by flags,
+ * with the same results as the individual LAGraph_Cached_* methods, but with
+ * work shared between them.  G->AT is computed at most once and is used for
+ * both G->in_degree and G->is_symmetric_structure; both degrees are computed
+ * as row degrees; and the symmetry test is skipped if the degrees already
+ * show that the structure of G->A is unsymmetric.  Properties that are
+ * already cached are not recomputed.  G->AT and G->in_degree are not
+ * computed for an undirected graph, but this is not an error.
+ *
+ * @param[in,out] G     graph for which the properties are computed.
+ * @param[in] flags     bitwise OR of LAGraph_CacheFlags; LAGraph_CACHE_ALL
+ *                      computes all of them.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_INVALID_VALUE if flags is not a combination of
+ *      LAGraph_CacheFlags.
+ * @retval GrB_NOT_IMPLEMENTED if G->emin or G->emax is requested and G does
+ *      not have a built-in real type.
+ * @retval GrB_NULL_POINTER if G is NULL.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid (G->A missing, or G->kind
+ *      not a recognized kind).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Cached_All
+(
+    // input/output:
+    LAGraph_Graph G,    // graph for which to compute cached properties
+    // input:
+    int flags,          // bitwise OR of LAGraph_CacheFlags
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGraph_DeleteSelfEdges: remove all diagonal entries from G->A
 //------------------------------------------------------------------------------
 
-/** LAGraph_DeleteSelfEdges: removes any diagonal entries from G->A.  Most
- * cached properties are cleared or set to LAGRAPH_UNKNOWN.  G->nself_edges is
- * set to zero, and G->is_symmetric_structure is left unchanged.
+/** LAGraph_DeleteSelfEdges: removes any diagonal entries from G->A (and
+ * G->AT, if present), in place.  The cached properties are updated rather
+ * than deleted, as in @sphinxref{LAGraph_RemoveEdges} (G->emin and G->emax
+ * become bounds).  G->nself_edges is set to zero, and
+ * G->is_symmetric_structure is left unchanged.
  *
  * @param[in,out] G     graph for which G->A is modified.
  * @param[in,out] msg   any error messages.
@@ -1187,8 +1373,81 @@ LAGRAPH_PUBLIC
 int LAGraph_DeleteSelfEdges
 (
     // input/output:
-    LAGraph_Graph G,    // diagonal entries removed, most cached properties
-                        // cleared
+    LAGraph_Graph G,    // diagonal entries removed, cached properties
+                        // updated
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_AddEdges: add a batch of edges to G->A
+//------------------------------------------------------------------------------
+
+/** LAGraph_AddEdges: adds the entries of E to G->A, as G->A<struct(E)> = E.
+ * Entries of E not in G->A are new edges; the others change the weights of
+ * existing edges.  If G is undirected, E' is added as well, with E(i,j) taking
+ * precedence over E(j,i).  The cached properties of G are updated with work
+ * proportional to the number of entries in E, rather than deleted: G->AT is
+ * patched with E', the degrees and G->nself_edges are incremented, and
+ * G->is_symmetric_structure is checked against the new edges if it was true
+ * (it becomes unknown if it was false).  G->emin and G->emax are combined with
+ * the min and max of E, and become bounds if any existing edge was changed.
+ *
+ * @param[in,out] G     graph for which G->A is modified.
+ * @param[in] E         edges to add, the same size as G->A.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or E are NULL.
+ * @retval GrB_DIMENSION_MISMATCH if E and G->A have different sizes.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid (G->A missing, or G->kind
+ *      not a recognized kind).
+ * @returns any GraphBLAS errors that may have been encountered.  If G->A has
+ *      been modified when an error occurs, all cached properties are deleted.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_AddEdges
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to modify
+    // input:
+    const GrB_Matrix E,     // edges to add, or whose weights are changed
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_RemoveEdges: remove a batch of edges from G->A
+//------------------------------------------------------------------------------
+
+/** LAGraph_RemoveEdges: removes the edges in the structure of R from G->A;
+ * the values of R, and entries of R that are not edges of G, are ignored.  If
+ * G is undirected, the edges in the structure of R' are removed as well.  The
+ * cached properties of G are updated with work proportional to the number of
+ * entries in R, rather than deleted: the edges are removed from G->AT, the
+ * degrees and G->nself_edges are decremented, and G->is_symmetric_structure is
+ * checked against the removed edges if it was true (it becomes unknown if it
+ * was false).  G->emin and G->emax are kept as bounds.
+ *
+ * @param[in,out] G     graph for which G->A is modified.
+ * @param[in] R         edges to remove, the same size as G->A.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or R are NULL.
+ * @retval GrB_DIMENSION_MISMATCH if R and G->A have different sizes.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid (G->A missing, or G->kind
+ *      not a recognized kind).
+ * @returns any GraphBLAS errors that may have been encountered.  If G->A has
+ *      been modified when an error occurs, all cached properties are deleted.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_RemoveEdges
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to modify
+    // input:
+    const GrB_Matrix R,     // edges to remove
     char *msg
 ) ;
 
@@ -2187,6 +2446,88 @@ int LAGr_SampleDegree
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_SampleQuantiles: sample the quantiles and mean of a vector
+//------------------------------------------------------------------------------
+
+/** LAGraph_SampleQuantiles estimates quantiles and the mean of the entries of
+ * a vector, from a random sample of its entries.  The values of v are typecast
+ * to int64_t, and entries not present in v are taken as zero, so a degree
+ * vector such as G->out_degree can be sampled directly.  All samples are
+ * extracted with a single GrB_extract, and then sorted and summed in
+ * parallel.  The estimate of the q [k]-th quantile is the sample of rank
+ * floor (q [k] * nsamples); q [k] = 0.5 gives the sampled median.
+ *
+ * @param[out] quantiles    array of size nq, with the sampled quantiles.
+ * @param[out] sample_mean  sampled mean; not computed if NULL.
+ * @param[in] v         vector to sample.
+ * @param[in] q         array of size nq, with each q [k] in the range [0,1].
+ * @param[in] nq        number of quantiles to estimate (may be zero).
+ * @param[in] nsamples  number of samples to take.
+ * @param[in] seed      random number seed.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if v is NULL, or if nq > 0 and quantiles or q is
+ *      NULL.
+ * @retval GrB_INVALID_VALUE if any q [k] is outside the range [0,1], or v
+ *      has size zero.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_SampleQuantiles
+(
+    // output:
+    double *quantiles,      // array of size nq; may be NULL if nq is zero
+    double *sample_mean,    // sampled mean; may be NULL if not needed
+    // input:
+    const GrB_Vector v,     // vector to sample
+    const double *q,        // array of size nq, each in the range [0,1]
+    int64_t nq,             // number of quantiles to estimate
+    int64_t nsamples,       // number of samples
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_SampleMode: sample the most frequent entry of a vector
+//------------------------------------------------------------------------------
+
+/** LAGraph_SampleMode estimates the mode (most frequent value) of the entries
+ * of a vector, from a random sample of its entries.  The values of v are
+ * typecast to int64_t, and entries not present in v are taken as zero.  The
+ * mode of the samples is found with a hash table, in time linear in
+ * nsamples.  For example, the mode of a connected components vector is the
+ * representative of the largest component, with high probability.
+ *
+ * @param[out] mode     sampled mode.
+ * @param[out] count    number of samples equal to the mode; not returned if
+ *                      NULL.
+ * @param[in] v         vector to sample.
+ * @param[in] nsamples  number of samples to take.
+ * @param[in] seed      random number seed.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if mode or v is NULL.
+ * @retval GrB_INVALID_VALUE if v has size zero.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_SampleMode
+(
+    // output:
+    int64_t *mode,          // sampled mode
+    int64_t *count,         // # of samples equal to the mode; may be NULL
+    // input:
+    const GrB_Vector v,     // vector to sample
+    int64_t nsamples,       // number of samples
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_BreadthFirstSearch: breadth-first search
 //------------------------------------------------------------------------------
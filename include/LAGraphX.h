@@ -65,6 +65,34 @@ int LAGraph_Random_Next     // advance to next random vector
     char *msg
 ) ;
 
+// LAGraph_Random_FillVector and LAGraph_Random_FillMatrix give each entry
+// present in V or A a random value that depends only on the seed and the
+// position of the entry (i for V(i), i*ncols+j for A(i,j)), so the result is
+// the same for any sparsity structure and any number of threads.  The
+// pattern is unchanged.  Integer types take the low bits of a 64-bit random
+// value, GrB_BOOL takes its top bit, and GrB_FP32 and GrB_FP64 values are
+// uniformly distributed in [0,1).  Other types are not supported.
+
+LAGRAPH_PUBLIC
+int LAGraph_Random_FillVector
+(
+    // input/output
+    GrB_Vector V,       // vector to fill; its sparsity pattern is unchanged
+    // input
+    uint64_t seed,      // random number seed
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Random_FillMatrix
+(
+    // input/output
+    GrB_Matrix A,       // matrix to fill; its sparsity pattern is unchanged
+    // input
+    uint64_t seed,      // random number seed
+    char *msg
+) ;
+
 LAGRAPH_PUBLIC
 GrB_Info LAGraph_Random_Matrix    // random matrix of any built-in type
 (
@@ -81,6 +109,85 @@ GrB_Info LAGraph_Random_Matrix    // random matrix of any built-in type
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Generate_*: synthetic graph generators
+//------------------------------------------------------------------------------
+
+// Each generator returns a new graph *G, where G->A is a GrB_BOOL matrix with
+// no self-edges.  The random graphs depend only on the seed and the
+// parameters, not on the number of threads.  See LAGraph_Generate.c for the
+// details of each model.
+
+LAGRAPH_PUBLIC
+int LAGraph_Generate_RMAT       // R-MAT / Graph500 Kronecker graph
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n = 2^scale nodes
+    // input:
+    int scale,              // log2 of the number of nodes
+    int edgefactor,         // # of edges to generate is edgefactor*n
+    double a,               // quadrant probabilities; the 4th is 1-a-b-c
+    double b,               // (Graph500: a = 0.57, b = c = 0.19)
+    double c,
+    LAGraph_Kind kind,      // directed or undirected
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Generate_ErdosRenyi // G(n,p) random graph
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    double p,               // probability of each edge
+    LAGraph_Kind kind,      // directed or undirected
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Generate_SBM        // stochastic block model
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    int nblocks,            // # of blocks, of nearly equal size
+    double p_in,            // probability of an edge inside a block
+    double p_out,           // probability of an edge between blocks
+    LAGraph_Kind kind,      // directed or undirected
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Generate_ChungLu    // Chung-Lu power-law graph
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    double avg_degree,      // average degree
+    double gamma,           // power-law exponent; must be > 1
+    LAGraph_Kind kind,      // directed or undirected
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Generate_Grid       // undirected 2D or 3D grid
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with nx*ny*nz nodes
+    // input:
+    GrB_Index nx,           // size of the grid in each dimension
+    GrB_Index ny,
+    GrB_Index nz,           // 1 for a 2D grid
+    char *msg
+) ;
+
 //****************************************************************************
 // binary file I/O
 //****************************************************************************
@@ -260,6 +367,126 @@ void LAGraph_SFreeSet           // free a set of matrices
     GrB_Index nmatrices         // # of matrices in the set
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Permute: renumber the nodes of a graph with a given permutation
+//------------------------------------------------------------------------------
+
+/**
+ * LAGraph_Permute: renumbers the nodes of G in place, so that node P [k] of
+ * the input graph becomes node k: G->A = G->A (P,P).  G->AT, G->out_degree,
+ * and G->in_degree are permuted along with G->A, if present.  All other
+ * cached properties are unchanged.
+ *
+ * @param[in,out] G     graph to renumber.
+ * @param[in] P         permutation of 0:n-1, of size n (not checked).
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS      if successful.
+ * @retval GrB_NULL_POINTER if P is NULL.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_Permute
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to renumber in place
+    // input:
+    const int64_t *P,       // permutation of size n
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_Reorder: renumber the nodes of a graph for better memory locality
+//------------------------------------------------------------------------------
+
+typedef enum
+{
+    LAGraph_REORDER_DEGREE = 0,         // descending out-degree
+    LAGraph_REORDER_HUB_CLUSTER = 1,    // hubs first, original order kept
+    LAGraph_REORDER_RCM = 2,            // reverse Cuthill-McKee
+    LAGraph_REORDER_COMMUNITY = 3       // by label propagation community
+}
+LAGraph_ReorderMethod ;
+
+/**
+ * LAGraph_Reorder: renumbers the nodes of G in place, so that node P [k] of
+ * the input graph becomes node k: G->A = G->A (P,P).  G->AT, G->out_degree,
+ * and G->in_degree are permuted along with G->A; G->out_degree is computed
+ * if not already cached.  All other cached properties are unchanged.
+ *
+ * @param[in,out] G     graph to renumber.
+ * @param[out] P        permutation of size n, freed by LAGraph_Free; not
+ *                      returned if NULL.
+ * @param[in] method    ordering method: LAGraph_REORDER_DEGREE,
+ *                      LAGraph_REORDER_HUB_CLUSTER (nodes with above-average
+ *                      degree first), LAGraph_REORDER_RCM (reverse
+ *                      Cuthill-McKee on the structure of A+A'), or
+ *                      LAGraph_REORDER_COMMUNITY (nodes of each community
+ *                      found by label propagation placed together).
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS      if successful.
+ * @retval GrB_INVALID_VALUE if the method is not recognized.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_Reorder
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to renumber in place
+    // output:
+    int64_t **P,            // permutation of size n; may be NULL
+    // input:
+    LAGraph_ReorderMethod method,   // ordering method to use
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_PartitionLayout: renumber a graph so each part is a row block
+//------------------------------------------------------------------------------
+
+/**
+ * LAGraph_PartitionLayout: renumbers the nodes of G in place (with
+ * LAGraph_Permute) so that the nodes of each part of a partition are
+ * contiguous, in their original relative order.  Part k is then the block
+ * of rows Bounds [k] to Bounds [k+1]-1 of G->A and G->AT.  With
+ * SuiteSparse:GraphBLAS, each row block of G->A and G->AT is then copied by
+ * the threads assigned to its part, so that on a NUMA machine with bound
+ * threads, its memory is first touched on the socket that works on it.
+ *
+ * @param[in,out] G     graph to renumber.
+ * @param[out] P        permutation of size n, freed by LAGraph_Free; not
+ *                      returned if NULL.
+ * @param[out] Bounds   array of size nparts+1, allocated by the caller; not
+ *                      returned if NULL.
+ * @param[in] part      part(i) = k if node i is in part k (see
+ *                      LAGraph_Partition); nodes not present are in part 0.
+ * @param[in] nparts    number of parts.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS      if successful.
+ * @retval GrB_NULL_POINTER if part is NULL.
+ * @retval GrB_INVALID_VALUE if nparts < 1 or part(i) is out of range.
+ * @retval GrB_DIMENSION_MISMATCH if part does not have size n.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_PartitionLayout
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to renumber in place
+    // output:
+    int64_t **P,            // permutation of size n; may be NULL
+    int64_t *Bounds,        // array of size nparts+1; may be NULL
+    // input:
+    const GrB_Vector part,  // part(i) = k if node i is in part k
+    int nparts,             // number of parts
+    char *msg
+) ;
+
 //****************************************************************************
 // Algorithms
 //****************************************************************************
@@ -347,6 +574,53 @@ int LAGraph_cc_lacc (
 // Bellman Ford variants
 //****************************************************************************
 
+/**
+ * LAGr_BellmanFord: Bellman-Ford single source shortest paths, with optional
+ * shortest-path tree and hop counts.  This is the recommended Bellman-Ford
+ * method; the LAGraph_BF_* variants below are kept as benchmark baselines
+ * (see experimental/benchmark/bf_demo.c).  Only the vertices whose distance
+ * changed in the last iteration are relaxed, using a push (vxm) or pull (mxv
+ * with AT) step chosen by the size of that frontier.  G->AT (if G is directed)
+ * and G->emin are used if present, but not computed.  A need not have
+ * explicit zeros on its diagonal.
+ *
+ * @param[out]    path_length   path_length (i) is the length of the shortest
+ *                              path from the source to vertex i (GrB_FP64,
+ *                              infinity if i is not reachable).
+ * @param[out]    parent        if not NULL: parent (i) is the parent of vertex
+ *                              i in a shortest-path tree (GrB_INT64, with
+ *                              parent (source) = source, and no entry if i is
+ *                              not reachable).
+ * @param[out]    hops          if not NULL: hops (i) is the fewest number of
+ *                              edges in any shortest path from the source to
+ *                              vertex i (GrB_INT64).
+ * @param[in]     G             the graph, not modified.
+ * @param[in]     source        index of the source.
+ * @param[in,out] msg           any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NO_VALUE         if a negative-weight cycle is reachable from
+ *                              the source; all outputs are then NULL.
+ * @retval GrB_NULL_POINTER     if path_length is NULL.
+ * @retval GrB_INVALID_INDEX    if the source is invalid.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGr_BellmanFord
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    GrB_Vector *parent,         // optional: parent (i) of vertex i in the
+                                // shortest-path tree (NULL if not needed)
+    GrB_Vector *hops,           // optional: hops (i) is the # of edges in the
+                                // shortest path to vertex i (NULL if not needed)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    char *msg
+) ;
+
 /**
  * Bellman-Ford single source shortest paths, returning just the shortest path
  * lengths.
@@ -623,6 +897,420 @@ GrB_Info LAGraph_BF_pure_c_double
     const double  *W
 ) ;
 
+//****************************************************************************
+// Delta-stepping shortest paths
+//****************************************************************************
+
+/**
+ * LAGraph_DeltaSplit: the light/heavy edge split of G->A used by delta-stepping
+ * (LAGr_SingleSourceShortestPath).  Building the split requires two
+ * GrB_select operations on G->A, which can take up to half of the total time
+ * of a single SSSP.  Constructing it once with LAGraph_DeltaSplit_New allows
+ * many SSSP calls on the same graph and Delta to skip this work.  The split
+ * holds copies of the entries of G->A; it must be freed and rebuilt if G->A
+ * is modified.
+ */
+typedef struct
+{
+    GrB_Scalar Delta ;  // the Delta used to split G->A
+    GrB_Matrix AL ;     // AL = A .* (A <= Delta): the light edges
+    GrB_Matrix AH ;     // AH = A .* (A > Delta): the heavy edges
+}
+LAGraph_DeltaSplit_struct ;
+
+typedef LAGraph_DeltaSplit_struct *LAGraph_DeltaSplit ;
+
+/**
+ * LAGraph_SSSP_AutoDelta: selects a Delta for delta-stepping, from the edge
+ * weights of G and its average out-degree.  For random edge weights in the
+ * range [0,emax], a bucket width of emax/d is a good choice, where d is the
+ * average degree (Meyer and Sanders, "Delta-stepping: a parallelizable
+ * shortest path algorithm", J. Algorithms, 2003).  The result is clamped to be
+ * at least G->emin, so that the lightest edges are always light, and is
+ * rounded up to an integer of at least 1 if G->A has an integer type.
+ * G->emin and G->emax are computed if not already present.
+ *
+ * @param[out]    Delta     Delta, a scalar of the same type as G->A.
+ * @param[in,out] G         The graph; G->emin and G->emax are computed if not
+ *                          already cached.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NULL_POINTER     if Delta is NULL.
+ * @retval GrB_NOT_IMPLEMENTED  if the type of G->A is not INT32, INT64,
+ *                              UINT32, UINT64, FP32, or FP64.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_SSSP_AutoDelta
+(
+    // output:
+    GrB_Scalar *Delta,          // Delta for delta-stepping
+    // input/output:
+    LAGraph_Graph G,            // G->emin and G->emax computed if not present
+    char *msg
+) ;
+
+/**
+ * LAGraph_DeltaSplit_New: constructs the light/heavy split of G->A for a
+ * given Delta.
+ *
+ * @param[out]    Split     the new split, freed with LAGraph_DeltaSplit_Free.
+ * @param[in]     G         the graph, not modified.
+ * @param[in]     Delta     Delta for delta-stepping; a copy is kept in Split.
+ *                          If NULL, an error is returned; use
+ *                          LAGraph_SSSP_AutoDelta to compute one.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NULL_POINTER     if Split or Delta is NULL.
+ * @retval GrB_EMPTY_OBJECT     if Delta has no entry.
+ * @retval GrB_NOT_IMPLEMENTED  if the type of G->A is not supported.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_DeltaSplit_New
+(
+    // output:
+    LAGraph_DeltaSplit *Split,  // the light/heavy split of G->A
+    // input:
+    const LAGraph_Graph G,      // graph to split, not modified
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+) ;
+
+/**
+ * LAGraph_DeltaSplit_Free: frees a split created by LAGraph_DeltaSplit_New.
+ *
+ * @param[in,out] Split     the split to free; set to NULL on output.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS      if successful.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_DeltaSplit_Free
+(
+    // input/output:
+    LAGraph_DeltaSplit *Split,  // split to free
+    char *msg
+) ;
+
+/**
+ * LAGr_SingleSourceShortestPath_Split: delta-stepping SSSP, identical to
+ * LAGr_SingleSourceShortestPath but using a light/heavy split of G->A
+ * constructed in advance by LAGraph_DeltaSplit_New.  The split is not
+ * modified, and can be reused for any number of sources.
+ *
+ * @param[out]    path_length   path_length (i) is the length of the shortest
+ *                              path from the source vertex to vertex i.
+ * @param[in]     G             the graph, not modified.  G->emin is used if
+ *                              present, as in LAGr_SingleSourceShortestPath.
+ * @param[in]     source        source vertex.
+ * @param[in]     Split         the light/heavy split of G->A.
+ * @param[in,out] msg           any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NULL_POINTER     if path_length or Split is NULL.
+ * @retval GrB_INVALID_INDEX    if source is invalid.
+ * @retval GrB_DIMENSION_MISMATCH if Split was not built from a graph of the
+ *                              same size as G.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGr_SingleSourceShortestPath_Split
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    const LAGraph_DeltaSplit Split, // light/heavy split of G->A
+    char *msg
+) ;
+
+/**
+ * LAGraph_SingleSourceShortestPath: Basic delta-stepping SSSP.  Delta is
+ * selected with LAGraph_SSSP_AutoDelta.  For repeated calls on the same
+ * graph, use LAGraph_SSSP_AutoDelta and LAGraph_DeltaSplit_New once, and then
+ * LAGr_SingleSourceShortestPath_Split for each source.
+ *
+ * @param[out]    path_length   path_length (i) is the length of the shortest
+ *                              path from the source vertex to vertex i.
+ * @param[in,out] G             the graph; G->emin and G->emax are computed if
+ *                              not already cached.
+ * @param[in]     source        source vertex.
+ * @param[in,out] msg           any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NULL_POINTER     if path_length is NULL.
+ * @retval GrB_INVALID_INDEX    if source is invalid.
+ * @retval GrB_NOT_IMPLEMENTED  if the type of G->A is not supported.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input/output:
+    LAGraph_Graph G,            // input graph; G->emin, G->emax computed
+    // input:
+    GrB_Index source,           // source vertex
+    char *msg
+) ;
+
+/**
+ * LAGr_MultiSourceShortestPath: batched delta-stepping SSSP from ns sources.
+ * All sources are processed together, using ns-by-n matrices in place of the
+ * vectors of LAGr_SingleSourceShortestPath, and one min_plus GrB_mxm per step
+ * in place of one GrB_vxm per source.  Row k of the current bucket holds the
+ * bucket of sources [k].  The light/heavy split of G->A is shared by all
+ * sources.
+ *
+ * @param[out]    path_length   ns-by-n matrix; path_length (k,i) is the length
+ *                              of the shortest path from sources [k] to
+ *                              vertex i.
+ * @param[in]     G             the graph, not modified.  G->emin is used if
+ *                              present, as in LAGr_SingleSourceShortestPath.
+ * @param[in]     sources       array of size ns: the source vertices.
+ * @param[in]     ns            number of source vertices.
+ * @param[in]     Split         the light/heavy split of G->A, from
+ *                              LAGraph_DeltaSplit_New.
+ * @param[in,out] msg           any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NULL_POINTER     if path_length, sources, or Split is NULL.
+ * @retval GrB_INVALID_VALUE    if ns <= 0.
+ * @retval GrB_INVALID_INDEX    if any source is invalid.
+ * @retval GrB_DIMENSION_MISMATCH if Split does not match G.
+ * @retval GrB_NOT_IMPLEMENTED  if the type of G->A is not supported.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGr_MultiSourceShortestPath
+(
+    // output:
+    GrB_Matrix *path_length,    // path_length (k,i) is the length of the
+                                // shortest path from sources [k] to vertex i
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    const GrB_Index *sources,   // source vertices, of size ns
+    int64_t ns,                 // number of source vertices
+    const LAGraph_DeltaSplit Split, // light/heavy split of G->A
+    char *msg
+) ;
+
+//****************************************************************************
+// All-pairs shortest paths
+//****************************************************************************
+
+typedef enum
+{
+    LAGraph_APSP_AUTO = 0,              // select the method automatically
+    LAGraph_APSP_FLOYD_WARSHALL = 1,    // blocked Floyd-Warshall, dense
+    LAGraph_APSP_SQUARING = 2,          // repeated min-plus squaring, sparse
+}
+LAGraph_APSP_Method ;
+
+/**
+ * LAGraph_AllPairsShortestPath: computes the length of the shortest path
+ * between all pairs of vertices.  Blocked Floyd-Warshall is used for dense
+ * graphs, and repeated squaring of the graph with the min-plus semiring for
+ * sparse graphs.  With LAGraph_APSP_AUTO, the method is selected by the
+ * density of G->A, and squaring switches to Floyd-Warshall if the distance
+ * matrix becomes dense.  Edge weights may be negative.
+ *
+ * @param[out]    D             D(i,j) is the length of the shortest path from
+ *                              i to j (GrB_FP64), with D(i,i) = 0.  D(i,j) is
+ *                              not present if j is not reachable from i.
+ * @param[in]     G             the graph, not modified.
+ * @param[in]     method        LAGraph_APSP_AUTO, _FLOYD_WARSHALL, or
+ *                              _SQUARING.
+ * @param[in]     memory_limit  bound on the workspace, in bytes, or 0 for no
+ *                              limit.  Floyd-Warshall needs about 32*n^2
+ *                              bytes; squaring is checked before each step.
+ * @param[in,out] msg           any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NO_VALUE         if the graph has a negative-weight cycle; D is
+ *                              then NULL.
+ * @retval GrB_OUT_OF_MEMORY    if the memory_limit would be exceeded, or if
+ *                              out of memory.
+ * @retval GrB_NULL_POINTER     if D is NULL.
+ * @retval GrB_INVALID_VALUE    if the method is invalid.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_AllPairsShortestPath
+(
+    // output:
+    GrB_Matrix *D,              // D(i,j) is the length of the shortest path
+                                // from i to j; not present if unreachable
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    LAGraph_APSP_Method method, // method to use
+    size_t memory_limit,        // workspace limit in bytes (0: no limit)
+    char *msg
+) ;
+
+//****************************************************************************
+// Landmark-based distance oracle
+//****************************************************************************
+
+typedef enum
+{
+    LAGraph_LANDMARKS_DEGREE = 0,   // the k vertices of highest out-degree
+    LAGraph_LANDMARKS_SAMPLE = 1,   // k random vertices of degree >= median
+}
+LAGraph_Landmark_Method ;
+
+/**
+ * LAGraph_DistanceOracle: the shortest path lengths between k landmark
+ * vertices and all n vertices of a graph, for approximate distance queries.
+ * The distances are held in dense n-by-k arrays in row-major form, so that
+ * the k distances for a single vertex are contiguous.  An unreachable vertex
+ * has a distance of INFINITY.  For an undirected graph, dist_to is the same
+ * array as dist_from.
+ */
+typedef struct
+{
+    int64_t k ;             // number of landmarks
+    GrB_Index n ;           // number of vertices in the graph
+    bool weighted ;         // if false, each edge has length 1
+    GrB_Index *landmarks ;  // array of size k: the landmark vertices
+    double *dist_from ;     // dist_from [v*k+t]: length from landmarks [t] to v
+    double *dist_to ;       // dist_to [v*k+t]: length from v to landmarks [t]
+}
+LAGraph_DistanceOracle_struct ;
+
+typedef LAGraph_DistanceOracle_struct *LAGraph_DistanceOracle ;
+
+/**
+ * LAGraph_DistanceOracleBuild: selects k landmarks and computes the shortest
+ * path lengths from each landmark to all vertices (and from all vertices to
+ * each landmark, if G is directed), with a single batched delta-stepping
+ * search (LAGr_MultiSourceShortestPath) in each direction.  If weighted is
+ * false, each edge has length 1 and the search is a batched breadth-first
+ * search.  The oracle takes O(k*n) memory, and must be rebuilt if G changes.
+ *
+ * @param[out]    Oracle    the new oracle, freed with
+ *                          LAGraph_DistanceOracle_Free.
+ * @param[in,out] G         the graph; G->out_degree is computed if not
+ *                          present.  The edge weights must not be negative.
+ * @param[in]     k         number of landmarks, in the range 1 to n.
+ * @param[in]     method    LAGraph_LANDMARKS_DEGREE or _SAMPLE.
+ * @param[in]     weighted  if true, use the values of G->A as edge lengths.
+ * @param[in]     seed      random number seed, for LAGraph_LANDMARKS_SAMPLE.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NULL_POINTER     if Oracle is NULL.
+ * @retval GrB_INVALID_VALUE    if k or the method is invalid, or if G->A has
+ *                              a negative edge weight.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_DistanceOracleBuild
+(
+    // output:
+    LAGraph_DistanceOracle *Oracle, // the new distance oracle
+    // input/output:
+    LAGraph_Graph G,                // input graph; G->out_degree computed
+    // input:
+    int64_t k,                      // number of landmarks
+    LAGraph_Landmark_Method method, // how to select the landmarks
+    bool weighted,                  // if false, all edges have length 1
+    uint64_t seed,                  // random number seed
+    char *msg
+) ;
+
+/**
+ * LAGraph_DistanceOracle_Free: frees a distance oracle.
+ *
+ * @param[in,out] Oracle    the oracle to free; NULL on output.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS      if successful.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_DistanceOracle_Free
+(
+    // input/output:
+    LAGraph_DistanceOracle *Oracle, // oracle to free
+    char *msg
+) ;
+
+/**
+ * LAGraph_DistanceOracleQuery: returns lower and upper bounds on the length
+ * of the shortest path from u to v, in O(k) time, from the triangle
+ * inequality through each landmark t: d(u,v) <= d(u,t) + d(t,v),
+ * d(u,v) >= d(t,v) - d(t,u), and d(u,v) >= d(u,t) - d(v,t).  The upper bound
+ * is exact if a landmark lies on a shortest path from u to v.  Both bounds
+ * are INFINITY if v is provably unreachable from u; the upper bound is
+ * INFINITY if no landmark connects u to v.
+ *
+ * @param[out]    lower     lower bound on the length of the path from u to v.
+ * @param[out]    upper     upper bound on the length of the path from u to v.
+ * @param[in]     Oracle    the distance oracle.
+ * @param[in]     u         source vertex.
+ * @param[in]     v         destination vertex.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NULL_POINTER     if lower, upper, or Oracle is NULL.
+ * @retval GrB_INVALID_INDEX    if u or v is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_DistanceOracleQuery
+(
+    // output:
+    double *lower,                  // lower bound on d(u,v)
+    double *upper,                  // upper bound on d(u,v)
+    // input:
+    const LAGraph_DistanceOracle Oracle,
+    GrB_Index u,                    // source vertex
+    GrB_Index v,                    // destination vertex
+    char *msg
+) ;
+
+/**
+ * LAGraph_DistanceOracleShortestPath: computes the exact length of the
+ * shortest path from u to v with an A* search, using the lower bounds from
+ * the oracle as the heuristic (the ALT method of Goldberg and Harrelson,
+ * "Computing the shortest path: A* search meets graph theory", SODA 2005).
+ * Vertices whose lower bound shows they cannot improve the path to v are not
+ * explored, so the search typically visits far fewer vertices than a
+ * single-source search.
+ *
+ * @param[out]    dist      length of the shortest path from u to v, or
+ *                          INFINITY if v is not reachable from u.
+ * @param[in]     Oracle    the distance oracle, built for G.
+ * @param[in]     G         the graph, not modified.
+ * @param[in]     u         source vertex.
+ * @param[in]     v         destination vertex.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS          if successful.
+ * @retval GrB_NULL_POINTER     if dist or Oracle is NULL.
+ * @retval GrB_INVALID_INDEX    if u or v is invalid.
+ * @retval GrB_DIMENSION_MISMATCH if Oracle does not match G.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_DistanceOracleShortestPath
+(
+    // output:
+    double *dist,                   // length of the shortest path from u to v
+    // input:
+    const LAGraph_DistanceOracle Oracle,
+    const LAGraph_Graph G,          // graph the oracle was built for
+    GrB_Index u,                    // source vertex
+    GrB_Index v,                    // destination vertex
+    char *msg
+) ;
+
 //****************************************************************************
 /**
  * Community detection using label propagation algorithm
@@ -654,6 +1342,42 @@ int LAGraph_cdlp
     char *msg
 ) ;
 
+//****************************************************************************
+/**
+ * LAGraph_Partition: splits the nodes of G into nparts parts of roughly equal
+ * weight (1 plus the out-degree of each node), with few edges between the
+ * parts, by size-constrained label propagation on the structure of A+A'.
+ * Each part weighs at most 3% more than the average.
+ *
+ * @param[out] part     part(i) = k if node i is in part k; a full GrB_INT64
+ *                      vector of size n.
+ * @param[out] edgecut  number of entries A(i,j) with part(i) != part(j); not
+ *                      computed if NULL.
+ * @param[in,out] G     graph to partition; G->out_degree is computed if not
+ *                      already cached.
+ * @param[in] nparts    number of parts.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS      if successful.
+ * @retval GrB_NULL_POINTER if part is NULL.
+ * @retval GrB_INVALID_VALUE if nparts < 1.
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPH_PUBLIC
+int LAGraph_Partition
+(
+    // output:
+    GrB_Vector *part,       // part(i) = k if node i is in part k
+    int64_t *edgecut,       // # of entries A(i,j) with part(i) != part(j);
+                            // not computed if NULL
+    // input/output:
+    LAGraph_Graph G,        // graph to partition; out_degree may be computed
+    // input:
+    int nparts,             // number of parts
+    char *msg
+) ;
+
 //****************************************************************************
 /**
  * Sparse deep neural network inference. Performs ReLU inference using input
@@ -855,6 +1579,498 @@ int LAGraph_SquareClustering
     char *msg
 ) ;
 
+//****************************************************************************
+// PageRank variants
+//****************************************************************************
+
+/**
+ * LAGr_PersonalizedPageRank: computes the personalized PageRank of a graph,
+ * where the random surfer teleports to node i with probability teleport(i),
+ * rather than uniformly.  The rank held by sinks (nodes with no outgoing
+ * edges) is redistributed according to the teleport distribution, so
+ * sum(centrality) remains 1.  This is an Advanced algorithm (G->AT and
+ * G->out_degree are required).
+ *
+ * @param[out] centrality   centrality(i) is the personalized PageRank of
+ *                          node i (GrB_FP32).
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph.
+ * @param[in] teleport      teleport distribution, a vector of size n.  It is
+ *                          scaled to sum to 1, and is typically nonzero only
+ *                          for a small set of seed nodes.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality, iters, or teleport are NULL.
+ * @retval GrB_INVALID_VALUE if teleport has a negative entry or sums to zero.
+ * @retval GrB_DIMENSION_MISMATCH if teleport does not have size n.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are exceeded.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_PersonalizedPageRank
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): rank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector teleport, // teleport distribution, of size n
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
+/**
+ * LAGr_PersonalizedPageRankBatch: computes k personalized PageRank vectors at
+ * once, one for each column of the n-by-k Teleport matrix.  The n-by-k rank
+ * matrix is updated with a single mxm with the graph per iteration, and each
+ * column stops (and costs nothing further) once it has converged.  This is an
+ * Advanced algorithm (G->AT and G->out_degree are required).
+ *
+ * @param[out] centrality   n-by-k matrix (GrB_FP32); centrality(i,c) is the
+ *                          rank of node i for the teleport distribution
+ *                          Teleport(:,c).
+ * @param[out] iters        array of size k, allocated by the caller;
+ *                          iters [c] is the number of iterations taken by
+ *                          column c.
+ * @param[in] G             input graph.
+ * @param[in] Teleport      n-by-k matrix; each column is a teleport
+ *                          distribution, scaled to sum to 1.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance for each column (typically
+ *                          1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality, iters, or Teleport are NULL.
+ * @retval GrB_INVALID_VALUE if Teleport has no columns, a negative entry, or
+ *      a column that sums to zero.
+ * @retval GrB_DIMENSION_MISMATCH if Teleport does not have n rows.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are exceeded.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_PersonalizedPageRankBatch
+(
+    // output:
+    GrB_Matrix *centrality, // centrality(i,c): rank of node i for column c
+    int *iters,             // iters [c]: # of iterations for column c
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Matrix Teleport, // n-by-k: teleport distribution of each column
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
+/**
+ * LAGr_PersonalizedPageRankPush: approximates the personalized PageRank of
+ * LAGr_PersonalizedPageRank with the forward-push method of Andersen, Chung,
+ * and Lang.  Only nodes whose residual is at least epsilon times their
+ * out-degree are pushed, so the work is O(1/(epsilon*(1-damping))),
+ * independent of the size of the graph, and only the neighborhood of the
+ * seed nodes is explored.  This is an Advanced algorithm (G->out_degree is
+ * required).
+ *
+ * @param[out] centrality   centrality(i) is an underestimate of the personalized
+ *                          PageRank of node i (GrB_FP64, sparse).
+ * @param[out] residual     if not NULL, the residual vector (GrB_FP64,
+ *                          sparse): the mass not yet pushed.  On output,
+ *                          residual(i) < epsilon * out_degree(i) for each
+ *                          node with outgoing edges, and < epsilon for sinks.
+ * @param[in] G             input graph.
+ * @param[in] teleport      teleport distribution, a vector of size n, scaled
+ *                          to sum to 1 (typically one or a few seed nodes).
+ * @param[in] damping       damping factor (typically 0.85), in [0,1).
+ * @param[in] epsilon       push threshold (typically 1e-6).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality or teleport are NULL.
+ * @retval GrB_INVALID_VALUE if epsilon <= 0, damping is out of range, or
+ *      teleport has a negative entry or sums to zero.
+ * @retval GrB_DIMENSION_MISMATCH if teleport does not have size n.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_PersonalizedPageRankPush
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): approximate rank of node i
+    GrB_Vector *residual,   // residual(i): mass not yet pushed (may be NULL)
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector teleport, // teleport distribution, of size n
+    float damping,          // damping factor (typically 0.85)
+    double epsilon,         // push threshold (typically 1e-6)
+    char *msg
+) ;
+
+/** LAGr_PageRankDelta_Method: an enum to select the method used by
+ * LAGr_PageRankDelta.
+ */
+typedef enum
+{
+    LAGr_PageRankDelta_Push = 0,        ///< propagate deltas of active nodes
+    LAGr_PageRankDelta_GaussSeidel = 1, ///< in-place parallel sweeps, in C
+}
+LAGr_PageRankDelta_Method ;
+
+/**
+ * LAGr_PageRankDelta: computes the same PageRank as LAGr_PageRank, with
+ * fewer edge traversals.  LAGr_PageRankDelta_Push propagates only the rank
+ * changes of nodes whose change is still large, with a sparse GrB_mxv over the
+ * shrinking set of active nodes.  LAGr_PageRankDelta_GaussSeidel updates the
+ * ranks in place with parallel block Gauss-Seidel sweeps, which converge in
+ * fewer iterations than the Jacobi iteration of LAGr_PageRank.  Sinks are
+ * handled as in LAGr_PageRank.  This is an Advanced algorithm (G->AT and
+ * G->out_degree are required).
+ *
+ * @param[out] centrality   centrality(i) is the PageRank of node i.
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in] method        LAGr_PageRankDelta_Push or _GaussSeidel.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality or iters are NULL.
+ * @retval GrB_INVALID_VALUE if the method is invalid.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are exceeded.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_PageRankDelta
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    LAGr_PageRankDelta_Method method,   // method to use
+    char *msg
+) ;
+
+/**
+ * LAGr_PageRankIncremental: recomputes the PageRank of G after a small
+ * update, warm-started from the PageRank r0 of the graph before the update.
+ * Only the rank changes caused by the update are propagated, starting from
+ * the nodes whose rank is no longer consistent with the graph, as in
+ * LAGr_PageRankDelta.  If the changed nodes are given, only they and their
+ * out-neighbors are examined at the start.  This is an Advanced algorithm
+ * (G->AT and G->out_degree are required).
+ *
+ * @param[out] centrality   centrality(i) is the PageRank of node i.
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph, after the update.
+ * @param[in] r0            PageRank of the graph before the update, from
+ *                          LAGr_PageRank or any of its variants.
+ * @param[in] changed       if not NULL, a vector of size n whose pattern
+ *                          holds both endpoints of each added or removed
+ *                          edge.  If NULL, all nodes are examined.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality, iters, or r0 are NULL.
+ * @retval GrB_DIMENSION_MISMATCH if r0 or changed do not have size n.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are exceeded.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_PageRankIncremental
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph, after the update
+    const GrB_Vector r0,    // pagerank of the graph before the update
+    const GrB_Vector changed,   // nodes with changed edges (may be NULL)
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
+/** LAGr_PageRank_Storage: an enum to select how LAGr_PageRankFused stores the
+ * scaled ranks that are gathered in each iteration.
+ */
+typedef enum
+{
+    LAGr_PageRank_FP32 = 0,     ///< single precision
+    LAGr_PageRank_BF16 = 1,     ///< bfloat16: half the memory traffic
+}
+LAGr_PageRank_Storage ;
+
+/**
+ * LAGr_PageRankFused: computes the same PageRank as LAGr_PageRank, with each
+ * iteration fused into a single parallel pass over the structure of AT and
+ * the rank vectors: the pull step, the convergence norm, the sink sum, and
+ * the scaling for the next iteration.  Ranks are held in FP32 and the norms
+ * are accumulated in FP64.  The ranks gathered by the pull step may be held
+ * in bfloat16 to reduce memory traffic on very large graphs, at a loss of
+ * accuracy (tol should then be at least about 1e-3).  The structure of AT is
+ * copied, which takes O(|E|) extra memory.  This is an Advanced algorithm
+ * (G->AT and G->out_degree are required).
+ *
+ * @param[out] centrality   centrality(i) is the PageRank of node i.
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in] storage       LAGr_PageRank_FP32 or LAGr_PageRank_BF16.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality or iters are NULL.
+ * @retval GrB_INVALID_VALUE if the storage mode is invalid.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are exceeded.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_PageRankFused
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4)
+    int itermax,            // maximum number of iterations (typically 100)
+    LAGr_PageRank_Storage storage,  // storage of the scaled ranks
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// Betweenness centrality variants
+//------------------------------------------------------------------------------
+
+/**
+ * LAGr_BetweennessApprox: estimates the betweenness centrality of all nodes
+ * (the result of LAGr_Betweenness with all n nodes as sources) by sampling
+ * random sources in batches, until an error bound is met: with probability at
+ * least 1-delta, abs (centrality (v) - bc (v)) <= epsilon * n * (n-1) for all
+ * nodes v.  Each batch is one call to LAGr_Betweenness.  Sampling is adaptive:
+ * it stops early when the empirical Bernstein bound on the sampled
+ * dependencies is met, and otherwise after log (4*n/delta) / (2*epsilon^2)
+ * sources.  This is an Advanced algorithm (G->AT is required).
+ *
+ * @param[out] centrality   centrality(i) is the estimated betweenness of i.
+ * @param[out] nsamples     number of sources sampled.
+ * @param[in] G             input graph.
+ * @param[in] epsilon       error bound, relative to n*(n-1), in (0,1).
+ * @param[in] delta         probability that the bound fails, in (0,1).
+ * @param[in] batch_size    number of sources per batch (typically 32).
+ * @param[in] seed          random number seed.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality or nsamples are NULL.
+ * @retval GrB_INVALID_VALUE if epsilon, delta, or batch_size are invalid.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_BetweennessApprox
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): estimated betweenness of i
+    GrB_Index *nsamples,        // number of sources sampled
+    // input:
+    const LAGraph_Graph G,      // input graph
+    double epsilon,             // error bound, relative to n*(n-1)
+    double delta,               // probability that the bound fails
+    int32_t batch_size,         // sources per batch (typically 32)
+    uint64_t seed,              // random number seed
+    char *msg
+) ;
+
+/**
+ * LAGr_BetweennessBounded: computes the same result as LAGr_Betweenness, with a
+ * bound on the memory used for the levels of the breadth-first searches.
+ * Rather than one matrix per level, the level of each node in each search is
+ * kept in a single ns-by-n GrB_INT32 matrix, and the backward sweep rebuilds
+ * the levels from it in blocks, each using at most max_bytes of workspace (at
+ * least one level per block).  A smaller limit uses less memory but more
+ * passes over the level matrix.  This is an Advanced algorithm (G->AT is
+ * required).
+ *
+ * @param[out] centrality   centrality(i) is the metric for node i.
+ * @param[in] G             input graph.
+ * @param[in] sources       source vertices to compute shortest paths, size ns
+ * @param[in] ns            number of source vertices.
+ * @param[in] max_bytes     workspace limit for a block of levels; 0 builds
+ *                          one level at a time, and SIZE_MAX builds all of
+ *                          them at once.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality or sources are NULL.
+ * @retval GrB_INVALID_INDEX if any source node is invalid.
+ * @retval GrB_NOT_IMPLEMENTED if the graph has 2^31 nodes or more.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_BetweennessBounded
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source vertices to compute shortest paths
+    int32_t ns,                 // number of source vertices
+    size_t max_bytes,           // workspace limit for the BFS levels
+    char *msg
+) ;
+
+/**
+ * LAGr_BetweennessWeighted: computes the betweenness centrality metric of
+ * LAGr_Betweenness, summed over the given sources, with shortest paths
+ * measured by the edge weights of G->A.  The path lengths from all sources
+ * are found at once with LAGr_MultiSourceShortestPath, and the dependencies
+ * are then accumulated over the shortest-path DAG of each source, as in
+ * Brandes' method, with the sources handled in parallel.  Edge weights must
+ * be positive.  This is an Advanced algorithm (the light/heavy split of G->A
+ * is required, from LAGraph_DeltaSplit_New).
+ *
+ * @param[out] centrality   centrality(i) is the metric for node i.
+ * @param[in] G             input graph; G->A holds the edge weights.
+ * @param[in] sources       source vertices to compute shortest paths, size ns
+ * @param[in] ns            number of source vertices.
+ * @param[in] Split         the light/heavy split of G->A.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality, sources, or Split are NULL.
+ * @retval GrB_INVALID_VALUE if ns <= 0, or an edge weight is not positive.
+ * @retval GrB_INVALID_INDEX if any source node is invalid.
+ * @retval GrB_NOT_IMPLEMENTED if the type of G->A is not supported.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_BetweennessWeighted
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source vertices to compute shortest paths
+    int32_t ns,                 // number of source vertices
+    const LAGraph_DeltaSplit Split, // light/heavy split of G->A
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// closeness and harmonic centrality
+//------------------------------------------------------------------------------
+
+/**
+ * LAGr_ClosenessCentrality: computes the closeness centrality of all nodes,
+ * from the lengths d(v,u) of the shortest paths from each node v to the nodes
+ * it reaches, following the direction of the edges.  If r(v) nodes are
+ * reachable from v (including v) with a total distance of S(v), the closeness
+ * of v is ((r(v)-1)/(n-1)) * ((r(v)-1)/S(v)), or zero if r(v) is 1.  The
+ * breadth-first searches are done in batches, one level of all searches in a
+ * batch at a time, as in LAGr_Betweenness.  If nsamples is zero, or at least
+ * n, the result is exact.  Otherwise, nsamples sources are chosen at random
+ * and the result is the estimate of Eppstein and Wang.  The values of G->A are
+ * ignored.  This is an Advanced algorithm (G->AT is required, if the graph is
+ * directed and its structure is not known to be symmetric).
+ *
+ * @param[out] centrality   centrality(i) is the closeness of node i.
+ * @param[in] G             input graph.
+ * @param[in] nsamples      0 for the exact result, or number of samples.
+ * @param[in] seed          random number seed, for the sampled mode.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality is NULL.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_ClosenessCentrality
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): closeness of node i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    GrB_Index nsamples,         // 0 for exact, else # of random sources
+    uint64_t seed,              // random number seed, for sampled mode
+    char *msg
+) ;
+
+/**
+ * LAGr_HarmonicCentrality: computes the harmonic centrality of all nodes, the
+ * sum of 1/d(v,u) over all nodes u != v reachable from v, with the same
+ * batched breadth-first searches and sampling as LAGr_ClosenessCentrality.
+ * In the sampled mode, the sum over the samples is scaled by (n-1)/nsamples.
+ * This is an Advanced algorithm (G->AT is required, if the graph is directed
+ * and its structure is not known to be symmetric).
+ *
+ * @param[out] centrality   centrality(i) is the harmonic centrality of i.
+ * @param[in] G             input graph.
+ * @param[in] nsamples      0 for the exact result, or number of samples.
+ * @param[in] seed          random number seed, for the sampled mode.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if centrality is NULL.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_HarmonicCentrality
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): harmonic centrality of i
+    // input:
+    const LAGraph_Graph G,      // input graph
+    GrB_Index nsamples,         // 0 for exact, else # of random sources
+    uint64_t seed,              // random number seed, for sampled mode
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // a simple example of an algorithm
 //------------------------------------------------------------------------------
@@ -869,6 +2085,26 @@ int LAGraph_HelloWorld // a simple algorithm, just for illustration
     char *msg
 ) ;
 
+/**
+ * LAGr_HITS: computes the hub and authority scores of the Hyperlink-Induced
+ * Topic Search (HITS) algorithm, each scaled to sum to 1.  This is an Advanced
+ * algorithm (G->AT is required, if the graph is directed and its structure
+ * is not known to be symmetric).
+ *
+ * @param[out] hubs         hubs(i) is the hub score of node i.
+ * @param[out] authorities  authorities(i) is the authority score of node i.
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph.
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if hubs or authorities are NULL.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
 LAGRAPH_PUBLIC
 int LAGr_HITS(
     GrB_Vector * hubs,
@@ -880,4 +2116,49 @@ int LAGr_HITS(
     char *msg 
 );
 
+/**
+ * LAGr_HITSFused: computes the same hub and authority scores as LAGr_HITS,
+ * with a single pass over G->A per iteration: each row i gives h(i) = A(i,:)*a
+ * and is then pushed into A'*h, so G->AT is not used.  The iteration can be
+ * warm-started from the authorities of a previous run, and authorities that
+ * change by at most vtol in an iteration can be frozen, so that converged
+ * parts of the graph are skipped.  This is an Advanced algorithm (no cached
+ * properties are required).
+ *
+ * @param[out] hubs         hubs(i) is the hub score of node i.
+ * @param[out] authorities  authorities(i) is the authority score of node i.
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph; the values of G->A are ignored.
+ * @param[in] a0            initial authorities, or NULL for a uniform start.
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] vtol          per-node tolerance for freezing an authority,
+ *                          or 0 to disable freezing.
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if hubs, authorities, or iters are NULL.
+ * @retval GrB_INVALID_VALUE if vtol is negative, G->A has no edges, or a0 has
+ *      a negative entry or a zero sum.
+ * @retval GrB_DIMENSION_MISMATCH if a0 does not have size n.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are exceeded.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ */
+LAGRAPH_PUBLIC
+int LAGr_HITSFused
+(
+    // output:
+    GrB_Vector *hubs,           // hubs(i): hub score of node i
+    GrB_Vector *authorities,    // authorities(i): authority score of node i
+    int *iters,                 // number of iterations taken
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Vector a0,        // initial authorities (may be NULL)
+    float tol,                  // stopping tolerance (typically 1e-4)
+    float vtol,                 // per-node tolerance, or 0 for none
+    int itermax,                // maximum number of iterations
+    char *msg
+) ;
+
 #endif
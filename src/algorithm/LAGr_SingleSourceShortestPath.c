@@ -36,7 +36,13 @@
 // NOTE: this method gets stuck in an infinite loop when there are negative-
 // weight cycles in the graph.
 
-// FUTURE: a Basic algorithm that picks Delta automatically
+// LG_SingleSourceShortestPath is the shared kernel.  If the light/heavy split
+// of G->A (AL and AH) is provided by the caller, it is used as-is, and not
+// rebuilt.  This allows repeated calls on the same graph and Delta to skip the
+// GrB_select of G->A; see LAGraph_DeltaSplit_New and
+// LAGr_SingleSourceShortestPath_Split in LAGraphX.h.  A Basic algorithm that
+// picks Delta automatically is LAGraph_SingleSourceShortestPath, also in
+// LAGraphX.h.
 
 #define LG_FREE_WORK        \
 {                           \
@@ -58,7 +64,7 @@
     GrB_free (&t) ;         \
 }
 
-#include "LG_internal.h"
+#include "LG_alg_internal.h"
 
 #define setelement(s, k)                                                      \
 {                                                                             \
@@ -74,7 +80,11 @@
     }                                                                         \
 }
 
-int LAGr_SingleSourceShortestPath
+//------------------------------------------------------------------------------
+// LG_SingleSourceShortestPath: delta-stepping kernel
+//------------------------------------------------------------------------------
+
+int LG_SingleSourceShortestPath
 (
     // output:
     GrB_Vector *path_length,    // path_length (i) is the length of the shortest
@@ -83,6 +93,8 @@ int LAGr_SingleSourceShortestPath
     const LAGraph_Graph G,      // input graph, not modified
     GrB_Index source,           // source vertex
     GrB_Scalar Delta,           // delta value for delta stepping
+    GrB_Matrix Light,           // if not NULL: Light = A .* (A <= Delta)
+    GrB_Matrix Heavy,           // if not NULL: Heavy = A .* (A > Delta)
     char *msg
 )
 {
@@ -111,6 +123,8 @@ int LAGr_SingleSourceShortestPath
     GrB_Index nvals ;
     LG_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
     LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+    LG_ASSERT_MSG ((Light == NULL) == (Heavy == NULL), GrB_NULL_POINTER,
+        "light and heavy edges must both be present, or both NULL") ;
 
     GrB_Matrix A = G->A ;
     GrB_Index n ;
@@ -279,16 +293,21 @@ int LAGr_SingleSourceShortestPath
     // s (src) = true
     GRB_TRY (GrB_Vector_setElement (s, true, source)) ;
 
-    // AL = A .* (A <= Delta)
-    GRB_TRY (GrB_Matrix_new (&AL, etype, n, n)) ;
-    GRB_TRY (GrB_select (AL, NULL, NULL, le, A, Delta, NULL)) ;
-    GRB_TRY (GrB_wait (AL, GrB_MATERIALIZE)) ;
-
-    // FUTURE: costly for some problems, taking up to 50% of the total time:
-    // AH = A .* (A > Delta)
-    GRB_TRY (GrB_Matrix_new (&AH, etype, n, n)) ;
-    GRB_TRY (GrB_select (AH, NULL, NULL, gt, A, Delta, NULL)) ;
-    GRB_TRY (GrB_wait (AH, GrB_MATERIALIZE)) ;
+    if (Light == NULL)
+    {
+        // AL = A .* (A <= Delta)
+        GRB_TRY (GrB_Matrix_new (&AL, etype, n, n)) ;
+        GRB_TRY (GrB_select (AL, NULL, NULL, le, A, Delta, NULL)) ;
+        GRB_TRY (GrB_wait (AL, GrB_MATERIALIZE)) ;
+
+        // FUTURE: costly for some problems, taking up to 50% of the total
+        // time: AH = A .* (A > Delta)
+        GRB_TRY (GrB_Matrix_new (&AH, etype, n, n)) ;
+        GRB_TRY (GrB_select (AH, NULL, NULL, gt, A, Delta, NULL)) ;
+        GRB_TRY (GrB_wait (AH, GrB_MATERIALIZE)) ;
+        Light = AL ;
+        Heavy = AH ;
+    }
 
     //--------------------------------------------------------------------------
     // while (t >= step*Delta) not empty
@@ -329,7 +348,8 @@ int LAGr_SingleSourceShortestPath
         while (tmasked_nvals > 0)
         {
             // tReq = AL'*tmasked using the min_plus semiring
-            GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, AL, NULL)) ;
+            GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, Light,
+                NULL)) ;
 
             // s<struct(tmasked)> = true
             GRB_TRY (GrB_assign (s, tmasked, NULL, (bool) true, GrB_ALL, n,
@@ -385,7 +405,7 @@ int LAGr_SingleSourceShortestPath
         GRB_TRY (GrB_assign (tmasked, s, NULL, t, GrB_ALL, n, GrB_DESC_S)) ;
 
         // tReq = AH'*tmasked using the min_plus semiring
-        GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, AH, NULL)) ;
+        GRB_TRY (GrB_vxm (tReq, NULL, NULL, min_plus, tmasked, Heavy, NULL)) ;
 
         // tless = (tReq .< t) using set intersection
         GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, less_than, tReq, t, NULL)) ;
@@ -420,3 +440,23 @@ int LAGr_SingleSourceShortestPath
     LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath: delta-stepping SSSP
+//------------------------------------------------------------------------------
+
+int LAGr_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+    return (LG_SingleSourceShortestPath (path_length, G, source, Delta,
+        NULL, NULL, msg)) ;
+}
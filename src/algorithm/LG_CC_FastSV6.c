@@ -169,25 +169,24 @@ static inline GrB_Info fastsv
 // components in the graph G is the number of representatives.
 
 #undef  LG_FREE_WORK
-#define LG_FREE_WORK                            \
-{                                               \
-    LAGraph_Free ((void **) &Tp, NULL) ;        \
-    LAGraph_Free ((void **) &Tj, NULL) ;        \
-    LAGraph_Free ((void **) &Tx, NULL) ;        \
-    LAGraph_Free ((void **) &Cp, NULL) ;        \
-    LAGraph_Free ((void **) &Px, NULL) ;        \
-    LAGraph_Free ((void **) &Cx, NULL) ;        \
-    LAGraph_Free ((void **) &ht_key, NULL) ;    \
-    LAGraph_Free ((void **) &ht_count, NULL) ;  \
-    LAGraph_Free ((void **) &count, NULL) ;     \
-    LAGraph_Free ((void **) &range, NULL) ;     \
-    GrB_free (&C) ;                             \
-    GrB_free (&T) ;                             \
-    GrB_free (&t) ;                             \
-    GrB_free (&y) ;                             \
-    GrB_free (&gp) ;                            \
-    GrB_free (&mngp) ;                          \
-    GrB_free (&gp_new) ;                        \
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &Tp, NULL) ;            \
+    LAGraph_Free ((void **) &Tj, NULL) ;            \
+    LAGraph_Free ((void **) &Tx, NULL) ;            \
+    LAGraph_Free ((void **) &Cp, NULL) ;            \
+    LAGraph_Free ((void **) &Px, NULL) ;            \
+    LAGraph_Free ((void **) &Cx, NULL) ;            \
+    LG_Workspace_Free ((void **) &samples, NULL) ;  \
+    LG_Workspace_Free ((void **) &count, NULL) ;    \
+    LG_Workspace_Free ((void **) &range, NULL) ;    \
+    GrB_free (&C) ;                                 \
+    GrB_free (&T) ;                                 \
+    GrB_free (&t) ;                                 \
+    GrB_free (&y) ;                                 \
+    GrB_free (&gp) ;                                \
+    GrB_free (&mngp) ;                              \
+    GrB_free (&gp_new) ;                            \
 }
 
 #undef  LG_FREE_ALL
@@ -220,13 +219,13 @@ int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
     LG_CLEAR_MSG ;
 
     int64_t *range = NULL ;
-    GrB_Index n, nvals, Cp_size = 0, *ht_key = NULL, *Px = NULL, *Cp = NULL,
+    GrB_Index n, nvals, Cp_size = 0, *Px = NULL, *Cp = NULL,
         *count = NULL, *Tp = NULL, *Tj = NULL ;
     GrB_Vector parent = NULL, gp_new = NULL, mngp = NULL, gp = NULL, t = NULL,
         y = NULL ;
     GrB_Matrix T = NULL, C = NULL ;
     void *Tx = NULL, *Cx = NULL ;
-    int *ht_count = NULL ;
+    int64_t *samples = NULL ;
 
     LG_TRY (LAGraph_CheckGraph (G, msg)) ;
     LG_ASSERT (component != NULL, GrB_NULL_POINTER) ;
@@ -398,9 +397,9 @@ int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
         LG_TRY (LAGraph_Malloc ((void **) &Tj, nvals, sizeof (GrB_Index),
             msg)) ;
         LG_TRY (LAGraph_Calloc ((void **) &Tx, 1, sizeof (bool), msg)) ;
-        LG_TRY (LAGraph_Malloc ((void **) &range, nthreads + 1,
+        LG_TRY (LG_Workspace_Malloc ((void **) &range, nthreads + 1,
             sizeof (int64_t), msg)) ;
-        LG_TRY (LAGraph_Calloc ((void **) &count, nthreads + 1,
+        LG_TRY (LG_Workspace_Calloc ((void **) &count, nthreads + 1,
             sizeof (GrB_Index), msg)) ;
 
         //----------------------------------------------------------------------
@@ -482,47 +481,26 @@ int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
 
         // The sampling below computes an estimate of the mode of the parent
         // vector, the contents of which are currently in the non-opaque Px
-        // array.
+        // array.  See also LAGraph_SampleMode, which does the same for a
+        // GrB_Vector.
 
-        // hash table size must be a power of 2
-        #define HASH_SIZE 1024
         // number of samples to insert into the hash table
-        #define HASH_SAMPLES 864
-        #define HASH(x) (((x << 4) + x) & (HASH_SIZE-1))
-        #define NEXT(x) ((x + 23) & (HASH_SIZE-1))
-
-        // allocate and initialize the hash table
-        LG_TRY (LAGraph_Malloc ((void **) &ht_key, HASH_SIZE,
-            sizeof (GrB_Index), msg)) ;
-        LG_TRY (LAGraph_Calloc ((void **) &ht_count, HASH_SIZE,
-            sizeof (int), msg)) ;
-        for (int k = 0 ; k < HASH_SIZE ; k++)
-        {
-            ht_key [k] = UINT64_MAX ;
-        }
+        #define NSAMPLES 864
 
-        // hash the samples and find the most frequent entry
+        // select NSAMPLES entries from Px at random
+        LG_TRY (LG_Workspace_Malloc ((void **) &samples, NSAMPLES,
+            sizeof (int64_t), msg)) ;
         uint64_t seed = n ;         // random number seed
-        int64_t key = -1 ;          // most frequent entry
-        int max_count = 0 ;         // frequency of most frequent entry
-        for (int64_t k = 0 ; k < HASH_SAMPLES ; k++)
+        for (int64_t k = 0 ; k < NSAMPLES ; k++)
         {
-            // select an entry from Px at random
-            GrB_Index x = Px [LG_Random60 (&seed) % n] ;
-            // find x in the hash table
-            GrB_Index h = HASH (x) ;
-            while (ht_key [h] != UINT64_MAX && ht_key [h] != x) h = NEXT (h) ;
-            // add x to the hash table
-            ht_key [h] = x ;
-            ht_count [h]++ ;
-            // keep track of the most frequent value
-            if (ht_count [h] > max_count)
-            {
-                key = ht_key [h] ;
-                max_count = ht_count [h] ;
-            }
+            samples [k] = (int64_t) Px [LG_Random60 (&seed) % n] ;
         }
 
+        // find the most frequent entry
+        int64_t key, max_count ;
+        LG_TRY (LG_mode (&key, &max_count, samples, NSAMPLES, msg)) ;
+        LG_Workspace_Free ((void **) &samples, NULL) ;
+
         //----------------------------------------------------------------------
         // compact the largest connected component in A
         //----------------------------------------------------------------------
@@ -63,4 +63,19 @@ int LG_CC_Boruvka
     char *msg
 ) ;
 
+// LG_SingleSourceShortestPath is also used by LAGraphX (experimental/algorithm)
+LAGRAPH_PUBLIC
+int LG_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index source,
+    GrB_Scalar Delta,
+    GrB_Matrix Light,       // if not NULL: Light = A .* (A <= Delta)
+    GrB_Matrix Heavy,       // if not NULL: Heavy = A .* (A > Delta)
+    char *msg
+) ;
+
 #endif
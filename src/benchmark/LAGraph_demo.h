@@ -734,6 +734,12 @@ static inline int binread   // returns 0 if successful, -1 if failure
 // test_whatever matrixfile.mtx sourcenodes.mtx
 // The matrixfile may also have a grb suffix.
 
+// If the matrix is not known to be symmetric, readproblem checks its
+// structure with LAGraph_Cached_IsSymmetricStructure, which caches both
+// G->out_degree and G->in_degree as a side effect.  G->AT is computed only if
+// make_symmetric is true and the structure is not symmetric, and it is freed
+// before readproblem returns.
+
 static int readproblem          // returns 0 if successful, -1 if failure
 (
     // output
@@ -1006,19 +1012,21 @@ static int readproblem          // returns 0 if successful, -1 if failure
 
     if (!A_is_symmetric)
     {
-        // compute G->AT and determine if A has a symmetric structure
+        // determine if A has a symmetric structure; this caches G->out_degree
+        // and G->in_degree, but does not compute G->AT
         LAGRAPH_TRY (LAGraph_Cached_IsSymmetricStructure (*G, msg)) ;
         if (((*G)->is_symmetric_structure == LAGraph_TRUE) && structural)
         {
             // if G->A has a symmetric structure, declare the graph undirected
-            // and free G->AT since it isn't needed.
+            // and free G->AT (if present) since it isn't needed.
             (*G)->kind = LAGraph_ADJACENCY_UNDIRECTED ;
             GRB_TRY (GrB_Matrix_free (&((*G)->AT))) ;
         }
         else if (make_symmetric)
         {
-            // make sure G->A is symmetric
+            // make sure G->A is symmetric, which requires G->AT
             bool sym ;
+            LAGRAPH_TRY (LAGraph_Cached_AT (*G, msg)) ;
             LAGRAPH_TRY (LAGraph_Matrix_IsEqual (&sym, (*G)->A, (*G)->AT, msg));
             if (!sym)
             {
@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/benchmark/generate_demo.c: generate a synthetic graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// usage:
+// generate_demo rmat    scale edgefactor           [outfile.grb]
+// generate_demo gnp     n avg_degree               [outfile.grb]
+// generate_demo sbm     n avg_degree nblocks       [outfile.grb]
+// generate_demo chunglu n avg_degree gamma         [outfile.grb]
+// generate_demo grid    nx ny nz                   [outfile.grb]
+
+// Generates an undirected synthetic graph with LAGraph_Generate_*, reports
+// the generation rate, and writes the graph to a binary file if requested.
+// The binary file can then be used as the input to any of the other
+// benchmarks, in place of a GAP matrix.  The rmat graph uses the Graph500
+// parameters.  The sbm graph has 90% of its edges inside the blocks.  The
+// seed is always 1, so the same parameters give the same graph.
+
+#include "LAGraph_demo.h"
+#include "LAGraphX.h"
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LAGraph_Delete (&G, NULL) ;     \
+}
+
+int main (int argc, char **argv)
+{
+    char msg [LAGRAPH_MSG_LEN] ;
+    LAGraph_Graph G = NULL ;
+    LAGraph_Kind kind = LAGraph_ADJACENCY_UNDIRECTED ;
+    uint64_t seed = 1 ;
+
+    // rmat and gnp take 2 parameters, the other models take 3
+    int nparams = 3 ;
+    if (argc > 1 && (strcmp (argv [1], "rmat") == 0 ||
+        strcmp (argv [1], "gnp") == 0))
+    {
+        nparams = 2 ;
+    }
+    if (argc < 2 + nparams || argc > 3 + nparams)
+    {
+        printf ("usage:\n"
+            "generate_demo rmat    scale edgefactor     [outfile.grb]\n"
+            "generate_demo gnp     n avg_degree         [outfile.grb]\n"
+            "generate_demo sbm     n avg_degree nblocks [outfile.grb]\n"
+            "generate_demo chunglu n avg_degree gamma   [outfile.grb]\n"
+            "generate_demo grid    nx ny nz             [outfile.grb]\n") ;
+        exit (1) ;
+    }
+
+    // start GraphBLAS and LAGraph
+    bool burble = false ;
+    demo_init (burble) ;
+
+    int nthreads_outer, nthreads_inner ;
+    LAGRAPH_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    printf ("nthreads: %d\n", nthreads_outer * nthreads_inner) ;
+
+    //--------------------------------------------------------------------------
+    // generate the graph
+    //--------------------------------------------------------------------------
+
+    char *model = argv [1] ;
+    char *outfile = (argc > 2 + nparams) ? argv [2 + nparams] : NULL ;
+    double t = LAGraph_WallClockTime ( ) ;
+    if (strcmp (model, "rmat") == 0)
+    {
+        int scale = atoi (argv [2]) ;
+        int edgefactor = atoi (argv [3]) ;
+        printf ("rmat: scale %d edgefactor %d\n", scale, edgefactor) ;
+        LAGRAPH_TRY (LAGraph_Generate_RMAT (&G, scale, edgefactor,
+            0.57, 0.19, 0.19, kind, seed, msg)) ;
+    }
+    else
+    {
+        GrB_Index n = (GrB_Index) atof (argv [2]) ;
+        double avg_degree = atof (argv [3]) ;
+        if (strcmp (model, "gnp") == 0)
+        {
+            double p = avg_degree / LAGRAPH_MAX (n - 1, 1) ;
+            printf ("gnp: n %" PRIu64 " p %g\n", n, p) ;
+            LAGRAPH_TRY (LAGraph_Generate_ErdosRenyi (&G, n, p, kind, seed,
+                msg)) ;
+        }
+        else if (strcmp (model, "sbm") == 0)
+        {
+            // 90% of the expected degree is inside the block
+            int nblocks = atoi (argv [4]) ;
+            double bsize = ((double) n) / LAGRAPH_MAX (nblocks, 1) ;
+            double p_in = fmin (0.9 * avg_degree / bsize, 1) ;
+            double p_out = fmin (0.1 * avg_degree / fmax (n - bsize, 1), 1) ;
+            printf ("sbm: n %" PRIu64 " nblocks %d p_in %g p_out %g\n",
+                n, nblocks, p_in, p_out) ;
+            LAGRAPH_TRY (LAGraph_Generate_SBM (&G, n, nblocks, p_in, p_out,
+                kind, seed, msg)) ;
+        }
+        else if (strcmp (model, "chunglu") == 0)
+        {
+            double gamma = atof (argv [4]) ;
+            printf ("chunglu: n %" PRIu64 " avg_degree %g gamma %g\n",
+                n, avg_degree, gamma) ;
+            LAGRAPH_TRY (LAGraph_Generate_ChungLu (&G, n, avg_degree, gamma,
+                kind, seed, msg)) ;
+        }
+        else if (strcmp (model, "grid") == 0)
+        {
+            GrB_Index ny = (GrB_Index) atof (argv [3]) ;
+            GrB_Index nz = (GrB_Index) atof (argv [4]) ;
+            printf ("grid: %" PRIu64 "-by-%" PRIu64 "-by-%" PRIu64 "\n",
+                n, ny, nz) ;
+            LAGRAPH_TRY (LAGraph_Generate_Grid (&G, n, ny, nz, msg)) ;
+        }
+        else
+        {
+            printf ("unknown model: %s\n", model) ;
+            exit (1) ;
+        }
+    }
+    t = LAGraph_WallClockTime ( ) - t ;
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    printf ("nodes: %" PRIu64 " entries: %" PRIu64 " time: %g sec "
+        "rate: %g million entries/sec\n", n, nvals, t, 1e-6 * nvals / t) ;
+    fprintf (stderr, "Avg: generate %s: %10.4f sec, %g million entries/sec\n",
+        model, t, 1e-6 * nvals / t) ;
+
+    //--------------------------------------------------------------------------
+    // write the graph to a binary file, if requested
+    //--------------------------------------------------------------------------
+
+    if (outfile != NULL)
+    {
+        double t_binwrite = LAGraph_WallClockTime ( ) ;
+        FILE *f = fopen (outfile, "w") ;
+        if (f == NULL)
+        {
+            printf ("Unable to open binary output file: [%s]\n", outfile) ;
+            exit (1) ;
+        }
+        // binwrite exports and frees G->A
+        if (binwrite (&(G->A), f, model) != 0)
+        {
+            printf ("Unable to create binary file\n") ;
+            exit (1) ;
+        }
+        t_binwrite = LAGraph_WallClockTime ( ) - t_binwrite ;
+        printf ("binary write time: %g sec\n", t_binwrite) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free all workspace and finish
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    LAGRAPH_TRY (LAGraph_Finalize (msg)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,207 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/benchmark/partition_demo.c: benchmark LAGraph_Partition
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// Usage: partition_demo can be used with both stdin or a file as its input,
+// in either grb or mtx format.
+
+// The graph is split into NPARTS parts with LAGraph_Partition, and then
+// renumbered with LAGraph_PartitionLayout so that each part is a block of
+// rows, first touched by the threads of its part.  The BFS (from the source
+// nodes of the problem) and the GAP PageRank are timed on the original graph
+// and on the partitioned graph, and the speedup is reported.  For a NUMA
+// machine, NPARTS should be the number of sockets, and the threads should be
+// bound to the sockets in order (OMP_PROC_BIND=close, for example).
+
+//------------------------------------------------------------------------------
+
+#include "LAGraph_demo.h"
+#include "LAGraphX.h"
+
+// number of parts (the number of NUMA sockets)
+#define NPARTS 4
+
+//------------------------------------------------------------------------------
+// run_algorithms: time the BFS and GAP PageRank on a graph
+//------------------------------------------------------------------------------
+
+// node src of the original graph is node Pinv [src] of G
+
+#define LG_FREE_ALL                             \
+{                                               \
+    GrB_free (&parent) ;                        \
+    GrB_free (&PR) ;                            \
+}
+
+static int run_algorithms
+(
+    double *tbfs,               // average BFS time
+    double *tpr,                // PageRank time
+    int *iters,                 // # of PageRank iterations
+    LAGraph_Graph G,
+    GrB_Matrix SourceNodes,
+    const int64_t *Pinv,
+    char *msg
+)
+{
+    GrB_Vector parent = NULL, PR = NULL ;
+    GrB_Index nsources ;
+    GRB_TRY (GrB_Matrix_nrows (&nsources, SourceNodes)) ;
+
+    (*tbfs) = LAGraph_WallClockTime ( ) ;
+    for (int trial = 0 ; trial < nsources ; trial++)
+    {
+        int64_t src ;
+        GRB_TRY (GrB_Matrix_extractElement (&src, SourceNodes, trial, 0)) ;
+        src-- ; // convert from 1-based to 0-based
+        LAGRAPH_TRY (LAGr_BreadthFirstSearch (NULL, &parent, G, Pinv [src],
+            msg)) ;
+        GrB_free (&parent) ;
+    }
+    (*tbfs) = (LAGraph_WallClockTime ( ) - (*tbfs)) / nsources ;
+
+    (*tpr) = LAGraph_WallClockTime ( ) ;
+    LAGRAPH_TRY (LAGr_PageRankGAP (&PR, iters, G, 0.85, 1e-4, 100, msg)) ;
+    (*tpr) = LAGraph_WallClockTime ( ) - (*tpr) ;
+    GrB_free (&PR) ;
+    return (GrB_SUCCESS) ;
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                             \
+{                                               \
+    LAGraph_Delete (&G, NULL) ;                 \
+    LAGraph_Delete (&G2, NULL) ;                \
+    GrB_free (&A2) ;                            \
+    GrB_free (&part) ;                          \
+    GrB_free (&SourceNodes) ;                   \
+    LAGraph_Free ((void **) &P, NULL) ;         \
+    LAGraph_Free ((void **) &Pinv, NULL) ;      \
+}
+
+int main (int argc, char **argv)
+{
+
+    char msg [LAGRAPH_MSG_LEN] ;
+
+    LAGraph_Graph G = NULL, G2 = NULL ;
+    GrB_Matrix A2 = NULL ;
+    GrB_Matrix SourceNodes = NULL ;
+    GrB_Vector part = NULL ;
+    int64_t *P = NULL, *Pinv = NULL ;
+
+    // start GraphBLAS and LAGraph
+    bool burble = false ;
+    demo_init (burble) ;
+
+    int nthreads_outer, nthreads_inner ;
+    LAGRAPH_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+    printf ("nthreads: %d nparts: %d\n", nthreads, NPARTS) ;
+
+    //--------------------------------------------------------------------------
+    // read in the graph
+    //--------------------------------------------------------------------------
+
+    char *matrix_name = (argc > 1) ? argv [1] : "stdin" ;
+    fprintf (stderr, "\n%s:\n", matrix_name) ;
+    LAGRAPH_TRY (readproblem (&G, &SourceNodes,
+        false, false, true, NULL, false, argc, argv)) ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    LAGRAPH_TRY (LAGraph_Malloc ((void **) &Pinv, n, sizeof (int64_t), msg)) ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        Pinv [k] = k ;
+    }
+
+    // the cached properties are not included in the algorithm timings
+    LAGRAPH_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    if (G->kind == LAGraph_ADJACENCY_DIRECTED)
+    {
+        LAGRAPH_TRY (LAGraph_Cached_AT (G, msg)) ;
+        LAGRAPH_TRY (LAGraph_Cached_InDegree (G, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // BFS and PageRank on the original graph
+    //--------------------------------------------------------------------------
+
+    double tbfs0, tpr0 ;
+    int iters ;
+    LAGRAPH_TRY (run_algorithms (&tbfs0, &tpr0, &iters, G, SourceNodes, Pinv,
+        msg)) ;
+    printf ("original:    bfs (avg): %10.4f sec, pagerank: %10.4f sec "
+        "(%d iters)\n", tbfs0, tpr0, iters) ;
+
+    //--------------------------------------------------------------------------
+    // partition the graph and make each part a first-touched row block
+    //--------------------------------------------------------------------------
+
+    int64_t edgecut, Bounds [NPARTS+1] ;
+    double tpart = LAGraph_WallClockTime ( ) ;
+    LAGRAPH_TRY (LAGraph_Partition (&part, &edgecut, G, NPARTS, msg)) ;
+    tpart = LAGraph_WallClockTime ( ) - tpart ;
+
+    GRB_TRY (GrB_Matrix_dup (&A2, G->A)) ;
+    LAGRAPH_TRY (LAGraph_New (&G2, &A2, G->kind, msg)) ;
+    LAGRAPH_TRY (LAGraph_Cached_OutDegree (G2, msg)) ;
+    if (G2->kind == LAGraph_ADJACENCY_DIRECTED)
+    {
+        LAGRAPH_TRY (LAGraph_Cached_AT (G2, msg)) ;
+        LAGRAPH_TRY (LAGraph_Cached_InDegree (G2, msg)) ;
+    }
+    double tlayout = LAGraph_WallClockTime ( ) ;
+    LAGRAPH_TRY (LAGraph_PartitionLayout (G2, &P, Bounds, part, NPARTS,
+        msg)) ;
+    tlayout = LAGraph_WallClockTime ( ) - tlayout ;
+
+    printf ("partition: %10.4f sec, layout: %10.4f sec, edgecut: %" PRId64
+        " of %" PRIu64 " entries (%.2f%%)\n", tpart, tlayout, edgecut, nvals,
+        100 * ((double) edgecut) / LAGRAPH_MAX (nvals, 1)) ;
+    for (int k = 0 ; k < NPARTS ; k++)
+    {
+        printf ("    part %d: %" PRId64 " nodes\n", k,
+            Bounds [k+1] - Bounds [k]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // BFS and PageRank on the partitioned graph
+    //--------------------------------------------------------------------------
+
+    // node P [k] of G is node k of G2
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        Pinv [P [k]] = k ;
+    }
+    double tbfs, tpr ;
+    LAGRAPH_TRY (run_algorithms (&tbfs, &tpr, &iters, G2, SourceNodes, Pinv,
+        msg)) ;
+    printf ("partitioned: bfs (avg): %10.4f sec, pagerank: %10.4f sec "
+        "(%d iters)\n", tbfs, tpr, iters) ;
+    printf ("speedup:     bfs: %10.4f, pagerank: %10.4f\n",
+        tbfs0 / tbfs, tpr0 / tpr) ;
+    fprintf (stderr, "Avg: partition: %10.4f layout: %10.4f bfs speedup: "
+        "%10.4f pagerank speedup: %10.4f: %s\n", tpart, tlayout,
+        tbfs0 / tbfs, tpr0 / tpr, matrix_name) ;
+
+    //--------------------------------------------------------------------------
+    // free all workspace and finish
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    LAGRAPH_TRY (LAGraph_Finalize (msg)) ;
+    return (GrB_SUCCESS) ;
+}
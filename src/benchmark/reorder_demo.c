@@ -0,0 +1,169 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/benchmark/reorder_demo.c: benchmark LAGraph_Reorder
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// Usage: reorder_demo can be used with both stdin or a file as its input,
+// in either grb or mtx format.
+
+// The graph is renumbered with each method of LAGraph_Reorder, and the BFS
+// (from the source nodes of the problem) and the GAP PageRank are timed on
+// the natural ordering and on each reordered graph.  The time to compute
+// each ordering is also reported, so it can be compared with the time it
+// saves in the algorithms.
+
+//------------------------------------------------------------------------------
+
+#include "LAGraph_demo.h"
+#include "LAGraphX.h"
+
+#define LG_FREE_ALL                             \
+{                                               \
+    LAGraph_Delete (&G, NULL) ;                 \
+    LAGraph_Delete (&G2, NULL) ;                \
+    GrB_free (&A2) ;                            \
+    GrB_free (&parent) ;                        \
+    GrB_free (&PR) ;                            \
+    GrB_free (&SourceNodes) ;                   \
+    LAGraph_Free ((void **) &P, NULL) ;         \
+    LAGraph_Free ((void **) &Pinv, NULL) ;      \
+}
+
+int main (int argc, char **argv)
+{
+
+    char msg [LAGRAPH_MSG_LEN] ;
+
+    LAGraph_Graph G = NULL, G2 = NULL ;
+    GrB_Matrix A2 = NULL ;
+    GrB_Matrix SourceNodes = NULL ;
+    GrB_Vector parent = NULL ;
+    GrB_Vector PR = NULL ;
+    int64_t *P = NULL, *Pinv = NULL ;
+
+    // start GraphBLAS and LAGraph
+    bool burble = false ;
+    demo_init (burble) ;
+
+    int nthreads_outer, nthreads_inner ;
+    LAGRAPH_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+    printf ("nthreads: %d\n", nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // read in the graph
+    //--------------------------------------------------------------------------
+
+    char *matrix_name = (argc > 1) ? argv [1] : "stdin" ;
+    fprintf (stderr, "\n%s:\n", matrix_name) ;
+    LAGRAPH_TRY (readproblem (&G, &SourceNodes,
+        false, false, true, NULL, false, argc, argv)) ;
+    GrB_Index n, nvals, nsources ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nsources, SourceNodes)) ;
+    LAGRAPH_TRY (LAGraph_Malloc ((void **) &Pinv, n, sizeof (int64_t), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // try each ordering
+    //--------------------------------------------------------------------------
+
+    const char *method_name [5] =
+        { "natural", "degree", "hub-cluster", "rcm", "community" } ;
+
+    float damping = 0.85 ;
+    float tol = 1e-4 ;
+    int iters = 0, itermax = 100 ;
+
+    for (int method = -1 ; method <= LAGraph_REORDER_COMMUNITY ; method++)
+    {
+
+        //----------------------------------------------------------------------
+        // renumber a copy of the graph
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_Matrix_dup (&A2, G->A)) ;
+        LAGRAPH_TRY (LAGraph_New (&G2, &A2, G->kind, msg)) ;
+        double treorder = 0 ;
+        if (method >= 0)
+        {
+            treorder = LAGraph_WallClockTime ( ) ;
+            LAGRAPH_TRY (LAGraph_Reorder (G2, &P, method, msg)) ;
+            treorder = LAGraph_WallClockTime ( ) - treorder ;
+            // node P [k] of G is node k of G2
+            for (int64_t k = 0 ; k < n ; k++)
+            {
+                Pinv [P [k]] = k ;
+            }
+            LAGraph_Free ((void **) &P, NULL) ;
+        }
+        else
+        {
+            for (int64_t k = 0 ; k < n ; k++)
+            {
+                Pinv [k] = k ;
+            }
+        }
+
+        // the cached properties are not included in the algorithm timings
+        LAGRAPH_TRY (LAGraph_Cached_OutDegree (G2, msg)) ;
+        if (G2->kind == LAGraph_ADJACENCY_DIRECTED)
+        {
+            LAGRAPH_TRY (LAGraph_Cached_AT (G2, msg)) ;
+            LAGRAPH_TRY (LAGraph_Cached_InDegree (G2, msg)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // BFS from each source node
+        //----------------------------------------------------------------------
+
+        double tbfs = LAGraph_WallClockTime ( ) ;
+        for (int trial = 0 ; trial < nsources ; trial++)
+        {
+            int64_t src ;
+            GRB_TRY (GrB_Matrix_extractElement (&src, SourceNodes, trial, 0)) ;
+            src-- ; // convert from 1-based to 0-based
+            GrB_free (&parent) ;
+            LAGRAPH_TRY (LAGr_BreadthFirstSearch (NULL, &parent, G2,
+                Pinv [src], msg)) ;
+        }
+        tbfs = (LAGraph_WallClockTime ( ) - tbfs) / nsources ;
+
+        //----------------------------------------------------------------------
+        // PageRank
+        //----------------------------------------------------------------------
+
+        GrB_free (&PR) ;
+        double tpr = LAGraph_WallClockTime ( ) ;
+        LAGRAPH_TRY (LAGr_PageRankGAP (&PR, &iters, G2, damping, tol,
+            itermax, msg)) ;
+        tpr = LAGraph_WallClockTime ( ) - tpr ;
+
+        printf ("%-12s reorder: %10.4f sec, bfs (avg): %10.4f sec, "
+            "pagerank: %10.4f sec (%d iters)\n", method_name [method+1],
+            treorder, tbfs, tpr, iters) ;
+        fprintf (stderr, "Avg: %-12s reorder: %10.4f bfs: %10.4f "
+            "pagerank: %10.4f sec: %s\n", method_name [method+1],
+            treorder, tbfs, tpr, matrix_name) ;
+
+        LAGRAPH_TRY (LAGraph_Delete (&G2, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free all workspace and finish
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    LAGRAPH_TRY (LAGraph_Finalize (msg)) ;
+    return (GrB_SUCCESS) ;
+}
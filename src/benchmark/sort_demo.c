@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/benchmark/sort_demo.c: benchmark LAGr_SortByDegree
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// Usage: sort_demo can be used with both stdin or a file as its input,
+// in either grb or mtx format.
+
+// LAGr_SortByDegree is timed with the radix sort (the default for the
+// LG_msort* functions when the keys fit in 64 bits) and with the parallel
+// mergesort, in ascending and descending order, and the two permutations are
+// checked to be the same.
+
+//------------------------------------------------------------------------------
+
+#include "LAGraph_demo.h"
+#include "LG_internal.h"
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                             \
+{                                               \
+    LAGraph_Delete (&G, NULL) ;                 \
+    LAGraph_Free ((void **) &P, NULL) ;         \
+    LAGraph_Free ((void **) &P2, NULL) ;        \
+}
+
+#define NTHREAD_LIST 1
+// #define NTHREAD_LIST 2
+#define THREAD_LIST 0
+
+// #define NTHREAD_LIST 6
+// #define THREAD_LIST 64, 32, 24, 12, 8, 4
+
+#define NTRIALS 8
+
+int main (int argc, char **argv)
+{
+
+    char msg [LAGRAPH_MSG_LEN] ;
+
+    LAGraph_Graph G = NULL ;
+    int64_t *P = NULL, *P2 = NULL ;
+
+    // start GraphBLAS and LAGraph
+    bool burble = false ;
+    demo_init (burble) ;
+
+    int nt = NTHREAD_LIST ;
+    int Nthreads [20] = { 0, THREAD_LIST } ;
+    int nthreads_max, nthreads_outer, nthreads_inner ;
+    LAGRAPH_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads_max = nthreads_outer * nthreads_inner ;
+    if (Nthreads [1] == 0)
+    {
+        // create thread list automatically
+        Nthreads [1] = nthreads_max ;
+        for (int t = 2 ; t <= nt ; t++)
+        {
+            Nthreads [t] = Nthreads [t-1] / 2 ;
+            if (Nthreads [t] == 0) nt = t-1 ;
+        }
+    }
+    printf ("threads to test: ") ;
+    for (int t = 1 ; t <= nt ; t++)
+    {
+        int nthreads = Nthreads [t] ;
+        if (nthreads > nthreads_max) continue ;
+        printf (" %d", nthreads) ;
+    }
+    printf ("\n") ;
+
+    //--------------------------------------------------------------------------
+    // read in the graph
+    //--------------------------------------------------------------------------
+
+    char *matrix_name = (argc > 1) ? argv [1] : "stdin" ;
+    fprintf (stderr, "\n%s:\n", matrix_name) ;
+    LAGRAPH_TRY (readproblem (&G,
+        NULL,   // no source nodes
+        false,  // do not make the graph undirected
+        false,  // do not remove self-edges
+        true,   // structural only, no values needed
+        NULL,   // no type preference
+        false,  // do not ensure all entries positive
+        argc, argv)) ;
+    LAGRAPH_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    //--------------------------------------------------------------------------
+    // LAGr_SortByDegree, with the radix sort and the mergesort
+    //--------------------------------------------------------------------------
+
+    printf ("# of trials: %d\n\n", NTRIALS) ;
+    for (int trial = 1 ; trial <= nt ; trial++)
+    {
+        int nthreads = Nthreads [trial] ;
+        if (nthreads > nthreads_max) continue ;
+        LAGRAPH_TRY (LAGraph_SetNumThreads (1, nthreads, NULL)) ;
+
+        for (int ascending = 0 ; ascending <= 1 ; ascending++)
+        {
+            double t [2] ;
+            for (int radix = 1 ; radix >= 0 ; radix--)
+            {
+                LG_radix_sort = (bool) radix ;
+                double ttt = 0 ;
+                for (int k = 0 ; k < NTRIALS ; k++)
+                {
+                    LAGraph_Free ((void **) &P2, NULL) ;
+                    double ttrial = LAGraph_WallClockTime ( ) ;
+                    LAGRAPH_TRY (LAGr_SortByDegree (&P2, G, true, ascending,
+                        msg)) ;
+                    ttt += LAGraph_WallClockTime ( ) - ttrial ;
+                }
+                t [radix] = ttt / NTRIALS ;
+                printf ("%s %-9s nthreads: %2d Avg: time: %10.4f sec\n",
+                    radix ? "radix:    " : "mergesort:",
+                    ascending ? "ascending" : "descending", nthreads,
+                    t [radix]) ;
+                if (radix)
+                {
+                    // keep the radix sort result, for comparison
+                    P = P2 ;
+                    P2 = NULL ;
+                }
+            }
+
+            // both sorts break ties by node id, so P and P2 must be the same
+            bool same = true ;
+            for (int64_t k = 0 ; k < n && same ; k++)
+            {
+                same = (P [k] == P2 [k]) ;
+            }
+            if (!same) printf ("failure! radix and mergesort differ\n") ;
+            printf ("speedup of radix sort: %g\n\n", t [0] / t [1]) ;
+            fprintf (stderr, "SortByDegree %-9s nthreads: %2d radix: %10.4f "
+                "sec mergesort: %10.4f sec\n", ascending ? "ascending" :
+                "descending", nthreads, t [1], t [0]) ;
+            LAGraph_Free ((void **) &P, NULL) ;
+        }
+    }
+
+    LG_radix_sort = true ;
+    LG_FREE_ALL ;
+    LAGRAPH_TRY (LAGraph_Finalize (msg)) ;
+    return (GrB_SUCCESS) ;
+}
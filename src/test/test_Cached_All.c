@@ -0,0 +1,279 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_Cached_All.c:  test LAGraph_Cached_All
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include "LAGraph_test.h"
+
+//------------------------------------------------------------------------------
+// global variables
+//------------------------------------------------------------------------------
+
+LAGraph_Graph G = NULL, G2 = NULL ;
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Matrix A = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "A.mtx",          // symmetric structure
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "LFAT5.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "matrix_int8.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_same: check that G and G2 have the same cached properties
+//------------------------------------------------------------------------------
+
+static void check_same (void)
+{
+    bool ok ;
+    TEST_CHECK ((G->AT == NULL) == (G2->AT == NULL)) ;
+    if (G->AT != NULL)
+    {
+        OK (LAGraph_Matrix_IsEqual (&ok, G->AT, G2->AT, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    TEST_CHECK ((G->out_degree == NULL) == (G2->out_degree == NULL)) ;
+    if (G->out_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G->out_degree, G2->out_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    TEST_CHECK ((G->in_degree == NULL) == (G2->in_degree == NULL)) ;
+    if (G->in_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G->in_degree, G2->in_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    TEST_CHECK (G->nself_edges == G2->nself_edges) ;
+    TEST_CHECK (G->is_symmetric_structure == G2->is_symmetric_structure) ;
+    TEST_CHECK (G->emin_state == G2->emin_state) ;
+    TEST_CHECK (G->emax_state == G2->emax_state) ;
+    TEST_CHECK ((G->emin == NULL) == (G2->emin == NULL)) ;
+    if (G->emin != NULL)
+    {
+        // the scalars are empty if G->A has no entries
+        double x1 = 0, x2 = 0 ;
+        int r1 = GrB_Scalar_extractElement_FP64 (&x1, G->emin) ;
+        int r2 = GrB_Scalar_extractElement_FP64 (&x2, G2->emin) ;
+        TEST_CHECK (r1 == r2 && x1 == x2) ;
+    }
+    TEST_CHECK ((G->emax == NULL) == (G2->emax == NULL)) ;
+    if (G->emax != NULL)
+    {
+        // the scalars are empty if G->A has no entries
+        double x1 = 0, x2 = 0 ;
+        int r1 = GrB_Scalar_extractElement_FP64 (&x1, G->emax) ;
+        int r2 = GrB_Scalar_extractElement_FP64 (&x2, G2->emax) ;
+        TEST_CHECK (r1 == r2 && x1 == x2) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_Cached_All: compare LAGraph_Cached_All with the individual methods
+//------------------------------------------------------------------------------
+
+void test_Cached_All (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        GrB_Matrix A2 = NULL ;
+        OK (GrB_Matrix_dup (&A2, A)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        OK (LAGraph_New (&G2, &A2, kind, msg)) ;
+
+        // try each single property, and then all of them
+        for (int flags = 1 ; flags <= LAGraph_CACHE_ALL ; flags = flags << 1)
+        {
+            int fl = (flags > LAGraph_CACHE_EMAX) ? LAGraph_CACHE_ALL : flags ;
+            OK (LAGraph_DeleteCached (G, msg)) ;
+            OK (LAGraph_DeleteCached (G2, msg)) ;
+
+            OK (LAGraph_Cached_All (G, fl, msg)) ;
+
+            // compute the same properties one at a time
+            if (fl & LAGraph_CACHE_IS_SYMMETRIC_STRUCTURE)
+            {
+                // this also computes the G2 degrees of a square directed graph
+                OK (LAGraph_Cached_IsSymmetricStructure (G2, msg)) ;
+            }
+            if (fl & LAGraph_CACHE_AT)
+            {
+                int result = LAGraph_Cached_AT (G2, msg) ;
+                TEST_CHECK (result == GrB_SUCCESS ||
+                    result == LAGRAPH_CACHE_NOT_NEEDED) ;
+            }
+            if (fl & LAGraph_CACHE_OUT_DEGREE)
+            {
+                OK (LAGraph_Cached_OutDegree (G2, msg)) ;
+            }
+            if (fl & LAGraph_CACHE_IN_DEGREE)
+            {
+                int result = LAGraph_Cached_InDegree (G2, msg) ;
+                TEST_CHECK (result == GrB_SUCCESS ||
+                    result == LAGRAPH_CACHE_NOT_NEEDED) ;
+            }
+            if (fl & LAGraph_CACHE_NSELF_EDGES)
+            {
+                OK (LAGraph_Cached_NSelfEdges (G2, msg)) ;
+            }
+            if (fl & LAGraph_CACHE_EMIN)
+            {
+                OK (LAGraph_Cached_EMin (G2, msg)) ;
+            }
+            if (fl & LAGraph_CACHE_EMAX)
+            {
+                OK (LAGraph_Cached_EMax (G2, msg)) ;
+            }
+            check_same ( ) ;
+            OK (LAGraph_CheckGraph (G, msg)) ;
+
+            // calling it again does nothing
+            OK (LAGraph_Cached_All (G, fl, msg)) ;
+            check_same ( ) ;
+
+            if (fl == LAGraph_CACHE_ALL) break ;
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+        OK (LAGraph_Delete (&G2, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Cached_All_types: compare the properties found in one sweep over G->A
+//------------------------------------------------------------------------------
+
+void test_Cached_All_types (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    GrB_Type types [11] = { GrB_BOOL, GrB_INT8, GrB_INT16, GrB_INT32,
+        GrB_INT64, GrB_UINT8, GrB_UINT16, GrB_UINT32, GrB_UINT64, GrB_FP32,
+        GrB_FP64 } ;
+    int fl = LAGraph_CACHE_OUT_DEGREE | LAGraph_CACHE_NSELF_EDGES |
+        LAGraph_CACHE_EMIN | LAGraph_CACHE_EMAX ;
+
+    // west0067 has entries of both signs; add some self-edges to it
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    GrB_Matrix Y = NULL ;
+    OK (LAGraph_MMRead (&Y, f, msg)) ;
+    OK (fclose (f)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, Y)) ;
+    for (GrB_Index i = 0 ; i < n ; i += 3)
+    {
+        OK (GrB_Matrix_setElement (Y, (double) (i+1), i, i)) ;
+    }
+
+    for (int t = 0 ; t < 11 ; t++)
+    {
+        for (int trial = 0 ; trial < 3 ; trial++)
+        {
+            // trial 0: typecast Y, trial 1: iso, trial 2: no entries
+            OK (GrB_Matrix_new (&A, types [t], n, n)) ;
+            if (trial == 0)
+            {
+                OK (GrB_assign (A, NULL, NULL, Y, GrB_ALL, n, GrB_ALL, n,
+                    NULL)) ;
+            }
+            else if (trial == 1)
+            {
+                OK (GrB_assign (A, Y, NULL, (double) 3, GrB_ALL, n, GrB_ALL,
+                    n, GrB_DESC_S)) ;
+            }
+            GrB_Matrix A2 = NULL ;
+            OK (GrB_Matrix_dup (&A2, A)) ;
+            OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+            OK (LAGraph_New (&G2, &A2, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+            OK (LAGraph_Cached_All (G, fl, msg)) ;
+            OK (LAGraph_Cached_OutDegree (G2, msg)) ;
+            OK (LAGraph_Cached_NSelfEdges (G2, msg)) ;
+            OK (LAGraph_Cached_EMin (G2, msg)) ;
+            OK (LAGraph_Cached_EMax (G2, msg)) ;
+            check_same ( ) ;
+            OK (LAGraph_CheckGraph (G, msg)) ;
+
+            OK (LAGraph_Delete (&G, msg)) ;
+            OK (LAGraph_Delete (&G2, msg)) ;
+        }
+    }
+
+    OK (GrB_free (&Y)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Cached_All_errors
+//------------------------------------------------------------------------------
+
+void test_Cached_All_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    int result = LAGraph_Cached_All (NULL, LAGraph_CACHE_ALL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 4, 4)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    result = LAGraph_Cached_All (G, 1024, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"Cached_All", test_Cached_All},
+    {"Cached_All_types", test_Cached_All_types},
+    {"Cached_All_errors", test_Cached_All_errors},
+    {NULL, NULL}
+} ;
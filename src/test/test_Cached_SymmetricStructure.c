@@ -143,6 +143,10 @@ void test_Cached_Symmetric_Structure (void)
 
         // compute the is_symmetric_structure cached property
         OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+        #if LAGRAPH_SUITESPARSE
+        // the transpose is not needed to check the structure
+        TEST_CHECK (G->AT == NULL) ;
+        #endif
 
         // check the result
         if (sym_structure)
@@ -187,6 +191,26 @@ void test_Cached_Symmetric_Structure (void)
 
     }
 
+    // a directed cycle has equal row and column degrees, but an unsymmetric
+    // structure
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 5000, 5000)) ;
+    for (GrB_Index i = 0 ; i < 5000 ; i++)
+    {
+        OK (GrB_Matrix_setElement (A, (bool) true, i, (i+1) % 5000)) ;
+    }
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == LAGraph_FALSE) ;
+    // add the reverse edges
+    OK (LAGraph_DeleteCached (G, msg)) ;
+    for (GrB_Index i = 0 ; i < 5000 ; i++)
+    {
+        OK (GrB_Matrix_setElement (G->A, (bool) true, (i+1) % 5000, i)) ;
+    }
+    OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+    TEST_CHECK (G->is_symmetric_structure == LAGraph_TRUE) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
     // check error handling
     int status = LAGraph_Cached_IsSymmetricStructure (NULL, msg) ;
     printf ("\nstatus: %d, msg: %s\n", status, msg) ;
@@ -0,0 +1,279 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_EditEdges.c:  test LAGraph_AddEdges and RemoveEdges
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include "LAGraph_test.h"
+#include "LG_internal.h"
+
+//------------------------------------------------------------------------------
+// global variables
+//------------------------------------------------------------------------------
+
+LAGraph_Graph G = NULL ;
+char msg [LAGRAPH_MSG_LEN] ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "karate.mtx",     // symmetric structure
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, ""
+} ;
+
+//------------------------------------------------------------------------------
+// cache_all: compute all cached properties of G
+//------------------------------------------------------------------------------
+
+static void cache_all (LAGraph_Graph G)
+{
+    // the AT and in_degree are not needed for an undirected graph
+    TEST_CHECK (LAGraph_Cached_AT (G, msg) >= 0) ;
+    TEST_CHECK (LAGraph_Cached_InDegree (G, msg) >= 0) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+    OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+    OK (LAGraph_Cached_EMin (G, msg)) ;
+    OK (LAGraph_Cached_EMax (G, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// check_cache: compare the cached properties of G with a fresh copy
+//------------------------------------------------------------------------------
+
+static void check_cache (LAGraph_Graph G)
+{
+    GrB_Matrix A2 = NULL ;
+    LAGraph_Graph G2 = NULL ;
+    bool ok ;
+    OK (GrB_Matrix_dup (&A2, G->A)) ;
+    OK (LAGraph_New (&G2, &A2, G->kind, msg)) ;
+    cache_all (G2) ;
+
+    if (G->AT != NULL)
+    {
+        OK (LAGraph_Matrix_IsEqual (&ok, G->AT, G2->AT, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    if (G->out_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G->out_degree, G2->out_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    if (G->in_degree != NULL && G2->in_degree != NULL)
+    {
+        OK (LAGraph_Vector_IsEqual (&ok, G->in_degree, G2->in_degree, msg)) ;
+        TEST_CHECK (ok) ;
+    }
+    if (G->nself_edges != LAGRAPH_UNKNOWN)
+    {
+        TEST_CHECK (G->nself_edges == G2->nself_edges) ;
+    }
+    if (G->is_symmetric_structure != LAGRAPH_UNKNOWN)
+    {
+        TEST_CHECK (G->is_symmetric_structure == G2->is_symmetric_structure) ;
+    }
+
+    double emin, emax, emin2, emax2 ;
+    OK (GrB_Scalar_extractElement (&emin, G->emin)) ;
+    OK (GrB_Scalar_extractElement (&emax, G->emax)) ;
+    OK (GrB_Scalar_extractElement (&emin2, G2->emin)) ;
+    OK (GrB_Scalar_extractElement (&emax2, G2->emax)) ;
+    TEST_CHECK (G->emin_state == LAGraph_VALUE ? (emin == emin2)
+        : (G->emin_state == LAGraph_BOUND && emin <= emin2)) ;
+    TEST_CHECK (G->emax_state == LAGraph_VALUE ? (emax == emax2)
+        : (G->emax_state == LAGraph_BOUND && emax >= emax2)) ;
+
+    OK (LAGraph_Delete (&G2, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_EditEdges: add and remove edges, and check the cached properties
+//------------------------------------------------------------------------------
+
+void test_EditEdges (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        GrB_Matrix A = NULL, Aref = NULL, E = NULL, R = NULL ;
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // G->A = double (A), and Aref = G->A
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+        OK (GrB_Matrix_new (&Aref, GrB_FP64, n, n)) ;
+        OK (GrB_assign (Aref, NULL, NULL, A, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        OK (GrB_free (&A)) ;
+        OK (GrB_Matrix_dup (&A, Aref)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        cache_all (G) ;
+
+        //----------------------------------------------------------------------
+        // add a batch of edges, some new and some existing
+        //----------------------------------------------------------------------
+
+        // E has new edges, a self-edge, and changed weights; an undirected
+        // graph gets both E(i,j) and E(j,i) with the same weight.
+        uint64_t seed = k + 1 ;
+        OK (GrB_Matrix_new (&E, GrB_FP64, n, n)) ;
+        for (int e = 0 ; e < 8 ; e++)
+        {
+            GrB_Index i = LG_Random60 (&seed) % n ;
+            GrB_Index j = (e == 0) ? i : (LG_Random60 (&seed) % n) ;
+            double x = ((double) (LG_Random60 (&seed) % 1000)) / 100 - 2 ;
+            OK (GrB_Matrix_setElement (E, x, i, j)) ;
+            if (kind == LAGraph_ADJACENCY_UNDIRECTED)
+            {
+                OK (GrB_Matrix_setElement (E, x, j, i)) ;
+            }
+        }
+        GrB_Index *I = NULL, *J = NULL ;
+        double *X = NULL ;
+        GrB_Index nvals ;
+        OK (GrB_Matrix_nvals (&nvals, Aref)) ;
+        OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &X, nvals, sizeof (double), msg)) ;
+        OK (GrB_Matrix_extractTuples (I, J, X, &nvals, Aref)) ;
+        OK (GrB_Matrix_setElement (E, 100.0, I [0], J [0])) ;
+        OK (GrB_Matrix_setElement (E, 100.0, J [0], I [0])) ;
+
+        // Aref = Aref + E, with E taking precedence
+        OK (GrB_eWiseAdd (Aref, NULL, NULL, GrB_SECOND_FP64, Aref, E, NULL)) ;
+        OK (LAGraph_AddEdges (G, E, msg)) ;
+        bool ok ;
+        OK (LAGraph_Matrix_IsEqual (&ok, G->A, Aref, msg)) ;
+        TEST_CHECK (ok) ;
+        check_cache (G) ;
+
+        //----------------------------------------------------------------------
+        // remove a batch of edges, including all of E
+        //----------------------------------------------------------------------
+
+        OK (GrB_Matrix_dup (&R, E)) ;
+        for (int e = 1 ; e < 4 && e < nvals ; e++)
+        {
+            OK (GrB_Matrix_setElement (R, (double) 0, I [e], J [e])) ;
+            if (kind == LAGraph_ADJACENCY_UNDIRECTED)
+            {
+                OK (GrB_Matrix_setElement (R, (double) 0, J [e], I [e])) ;
+            }
+        }
+        // Aref<!struct(R),replace> = Aref
+        OK (GrB_assign (Aref, R, NULL, Aref, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_RSC)) ;
+        OK (LAGraph_RemoveEdges (G, R, msg)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, G->A, Aref, msg)) ;
+        TEST_CHECK (ok) ;
+        check_cache (G) ;
+
+        // removing them again does nothing
+        OK (LAGraph_RemoveEdges (G, R, msg)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, G->A, Aref, msg)) ;
+        TEST_CHECK (ok) ;
+
+        //----------------------------------------------------------------------
+        // add E back, and delete the self-edges
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_AddEdges (G, E, msg)) ;
+        check_cache (G) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        TEST_CHECK (G->nself_edges == 0) ;
+        TEST_CHECK (G->out_degree != NULL) ;
+        TEST_CHECK (kind == LAGraph_ADJACENCY_UNDIRECTED || G->AT != NULL) ;
+        check_cache (G) ;
+
+        // a bound on emin or emax is recomputed as an exact value
+        OK (LAGraph_Cached_EMin (G, msg)) ;
+        TEST_CHECK (G->emin_state == LAGraph_VALUE) ;
+        OK (LAGraph_Cached_All (G, LAGraph_CACHE_EMAX, msg)) ;
+        TEST_CHECK (G->emax_state == LAGraph_VALUE) ;
+        check_cache (G) ;
+
+        LAGraph_Free ((void **) &I, NULL) ;
+        LAGraph_Free ((void **) &J, NULL) ;
+        LAGraph_Free ((void **) &X, NULL) ;
+        OK (GrB_free (&E)) ;
+        OK (GrB_free (&R)) ;
+        OK (GrB_free (&Aref)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_EditEdges_errors
+//------------------------------------------------------------------------------
+
+void test_EditEdges_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL, E = NULL ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 4, 4)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int result = LAGraph_AddEdges (G, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_RemoveEdges (G, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_AddEdges (NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (GrB_Matrix_new (&E, GrB_FP64, 5, 4)) ;
+    result = LAGraph_AddEdges (G, E, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    result = LAGraph_RemoveEdges (G, E, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+
+    OK (GrB_free (&E)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"EditEdges", test_EditEdges},
+    {"EditEdges_errors", test_EditEdges_errors},
+    {NULL, NULL}
+} ;
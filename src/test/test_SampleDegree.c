@@ -244,6 +244,76 @@ void test_SampleDegree_brutal (void)
 }
 #endif
 
+//-----------------------------------------------------------------------------
+// test_SampleQuantiles: test LAGraph_SampleQuantiles and LAGraph_SampleMode
+//-----------------------------------------------------------------------------
+
+void test_SampleQuantiles (void)
+{
+    setup ( ) ;
+    GrB_Vector v = NULL ;
+    GrB_Index n = 10000 ;
+
+    // v(i) = i % 10, with no entries for the zeros
+    OK (GrB_Vector_new (&v, GrB_INT64, n)) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        if (i % 10 != 0)
+        {
+            OK (GrB_Vector_setElement (v, (int64_t) (i % 10), i)) ;
+        }
+    }
+
+    double q [5] = { 0, 0.25, 0.5, 0.75, 1 }, quantiles [5] ;
+    OK (LAGraph_SampleQuantiles (quantiles, &mean, v, q, 5, 4000, 42, msg)) ;
+    printf ("\nmean %g quantiles: %g %g %g %g %g\n", mean, quantiles [0],
+        quantiles [1], quantiles [2], quantiles [3], quantiles [4]) ;
+    TEST_CHECK (fabs (mean - 4.5) < 0.3) ;
+    TEST_CHECK (quantiles [0] == 0) ;
+    TEST_CHECK (quantiles [4] == 9) ;
+    for (int k = 1 ; k < 5 ; k++)
+    {
+        TEST_CHECK (quantiles [k-1] <= quantiles [k]) ;
+    }
+    TEST_CHECK (fabs (quantiles [2] - 4.5) <= 1) ;
+
+    // the mean alone, and the median alone
+    double mean2 ;
+    OK (LAGraph_SampleQuantiles (NULL, &mean2, v, NULL, 0, 4000, 42, msg)) ;
+    TEST_CHECK (mean == mean2) ;
+    OK (LAGraph_SampleQuantiles (&median, NULL, v, q+2, 1, 4000, 42, msg)) ;
+    TEST_CHECK (median == quantiles [2]) ;
+
+    // v(i) = 7 for 60% of the entries, and i otherwise
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Vector_setElement (v, (int64_t) ((i % 5 < 3) ? 7 : i), i)) ;
+    }
+    int64_t mode, count ;
+    OK (LAGraph_SampleMode (&mode, &count, v, 1000, 1, msg)) ;
+    printf ("mode %" PRId64 " count %" PRId64 "\n", mode, count) ;
+    TEST_CHECK (mode == 7) ;
+    TEST_CHECK (count > 500 && count < 700) ;
+    OK (LAGraph_SampleMode (&mode, NULL, v, 1, 1, msg)) ;
+
+    // error handling
+    ret_code = LAGraph_SampleQuantiles (NULL, &mean, v, q, 5, 10, 1, msg) ;
+    TEST_CHECK (ret_code == GrB_NULL_POINTER) ;
+    q [0] = 2 ;
+    ret_code = LAGraph_SampleQuantiles (quantiles, &mean, v, q, 5, 10, 1,
+        msg) ;
+    TEST_CHECK (ret_code == GrB_INVALID_VALUE) ;
+    ret_code = LAGraph_SampleMode (&mode, &count, NULL, 10, 1, msg) ;
+    TEST_CHECK (ret_code == GrB_NULL_POINTER) ;
+    OK (GrB_free (&v)) ;
+    OK (GrB_Vector_new (&v, GrB_INT64, 0)) ;
+    ret_code = LAGraph_SampleMode (&mode, &count, v, 10, 1, msg) ;
+    TEST_CHECK (ret_code == GrB_INVALID_VALUE) ;
+    OK (GrB_free (&v)) ;
+
+    teardown ( ) ;
+}
+
 //-----------------------------------------------------------------------------
 // TEST_LIST: the list of tasks for this entire test
 //-----------------------------------------------------------------------------
@@ -251,6 +321,7 @@ void test_SampleDegree_brutal (void)
 TEST_LIST =
 {
     { "SampleDegree", test_SampleDegree },
+    { "SampleQuantiles", test_SampleQuantiles },
     #if LAGRAPH_SUITESPARSE
     { "SampleDegree_brutal", test_SampleDegree_brutal },
     #endif
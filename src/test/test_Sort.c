@@ -176,6 +176,106 @@ void test_sort3 (void)
     OK (LAGraph_Finalize (msg)) ;
 }
 
+//-----------------------------------------------------------------------------
+// test_sort_radix: compare the radix sort with the mergesort
+//-----------------------------------------------------------------------------
+
+void test_sort_radix (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_SetNumThreads (1, 4, msg)) ;
+
+    int64_t n = 256 * 1024 ;
+    int64_t *A0, *A1, *A2, *B0, *B1, *B2 ;
+    OK (LAGraph_Malloc ((void **) &A0, n, sizeof (int64_t), msg)) ;
+    OK (LAGraph_Malloc ((void **) &A1, n, sizeof (int64_t), msg)) ;
+    OK (LAGraph_Malloc ((void **) &A2, n, sizeof (int64_t), msg)) ;
+    OK (LAGraph_Malloc ((void **) &B0, n, sizeof (int64_t), msg)) ;
+    OK (LAGraph_Malloc ((void **) &B1, n, sizeof (int64_t), msg)) ;
+    OK (LAGraph_Malloc ((void **) &B2, n, sizeof (int64_t), msg)) ;
+
+    for (int trial = 0 ; trial <= 2 ; trial++)
+    {
+        // trial 0: negative degrees and node ids, as in LAGr_SortByDegree
+        // trial 1: 3 keys of 21 bits each, with negative values
+        // trial 2: keys that do not fit in 64 bits
+        uint64_t seed = trial + 1 ;
+        for (int k = 0 ; k < n ; k++)
+        {
+            if (trial == 0)
+            {
+                A0 [k] = - (int64_t) (LG_Random15 (&seed) % 1000) ;
+                A1 [k] = k ;
+                A2 [k] = 0 ;
+            }
+            else if (trial == 1)
+            {
+                A0 [k] = (int64_t) (LG_Random60 (&seed) % (1 << 21)) - 1000 ;
+                A1 [k] = (int64_t) (LG_Random15 (&seed) % 7) - 3 ;
+                A2 [k] = (int64_t) (LG_Random60 (&seed) % (1 << 21)) ;
+            }
+            else
+            {
+                A0 [k] = (int64_t) LG_Random60 (&seed) - INT64_MAX/2 ;
+                A1 [k] = (int64_t) LG_Random15 (&seed) ;
+                A2 [k] = (int64_t) LG_Random15 (&seed) ;
+            }
+        }
+
+        // sort by the first two keys
+        memcpy (B0, A0, n * sizeof (int64_t)) ;
+        memcpy (B1, A1, n * sizeof (int64_t)) ;
+        LG_radix_sort = true ;
+        OK (LG_msort2 (A0, A1, n, msg)) ;
+        LG_radix_sort = false ;
+        OK (LG_msort2 (B0, B1, n, msg)) ;
+        for (int k = 0 ; k < n ; k++)
+        {
+            TEST_CHECK (A0 [k] == B0 [k] && A1 [k] == B1 [k]) ;
+        }
+
+        // sort by all three keys
+        memcpy (B0, A0, n * sizeof (int64_t)) ;
+        memcpy (B1, A1, n * sizeof (int64_t)) ;
+        memcpy (B2, A2, n * sizeof (int64_t)) ;
+        LG_radix_sort = true ;
+        OK (LG_msort3 (A0, A1, A2, n, msg)) ;
+        LG_radix_sort = false ;
+        OK (LG_msort3 (B0, B1, B2, n, msg)) ;
+        for (int k = 0 ; k < n ; k++)
+        {
+            TEST_CHECK (A0 [k] == B0 [k] && A1 [k] == B1 [k]
+                && A2 [k] == B2 [k]) ;
+        }
+
+        // sort the first key only
+        memcpy (B0, A2, n * sizeof (int64_t)) ;
+        LG_radix_sort = true ;
+        OK (LG_msort1 (A2, n, msg)) ;
+        LG_radix_sort = false ;
+        OK (LG_msort1 (B0, n, msg)) ;
+        for (int k = 0 ; k < n ; k++)
+        {
+            TEST_CHECK (A2 [k] == B0 [k]) ;
+        }
+
+        // LG_rsort declines keys that do not fit in 64 bits
+        bool sorted ;
+        OK (LG_rsort (A0, A1, A2, &sorted, n, msg)) ;
+        TEST_CHECK (sorted == (trial < 2)) ;
+    }
+
+    LG_radix_sort = true ;
+    LAGraph_Free ((void **) &A0, NULL) ;
+    LAGraph_Free ((void **) &A1, NULL) ;
+    LAGraph_Free ((void **) &A2, NULL) ;
+    LAGraph_Free ((void **) &B0, NULL) ;
+    LAGraph_Free ((void **) &B1, NULL) ;
+    LAGraph_Free ((void **) &B2, NULL) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
 //-----------------------------------------------------------------------------
 // test_sort1_brutal
 //-----------------------------------------------------------------------------
@@ -345,6 +445,7 @@ TEST_LIST = {
     {"test_sort1", test_sort1},
     {"test_sort2", test_sort2},
     {"test_sort3", test_sort3},
+    {"test_sort_radix", test_sort_radix},
     #if LAGRAPH_SUITESPARSE
     {"test_sort1_brutal", test_sort1_brutal},
     {"test_sort2_brutal", test_sort2_brutal},
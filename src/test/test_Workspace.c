@@ -0,0 +1,200 @@
+//-----------------------------------------------------------------------------
+// LAGraph/src/test/test_Workspace.c: test LAGraph_Workspace
+//-----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//-----------------------------------------------------------------------------
+
+#include "LAGraph_test.h"
+#include "LG_internal.h"
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Workspace ws = NULL ;
+
+//-----------------------------------------------------------------------------
+// test_Workspace_pool: allocate and free blocks from a workspace
+//-----------------------------------------------------------------------------
+
+void test_Workspace_pool (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_Workspace_New (&ws, msg)) ;
+    TEST_CHECK (ws != NULL) ;
+
+    size_t inuse, high_water, cached ;
+    OK (LAGraph_Workspace_Stats (&inuse, &high_water, &cached, ws, msg)) ;
+    TEST_CHECK (inuse == 0 && high_water == 0 && cached == 0) ;
+
+    // with no workspace attached, the pool is not used
+    int64_t *p = NULL ;
+    OK (LG_Workspace_Malloc ((void **) &p, 1000, sizeof (int64_t), msg)) ;
+    TEST_CHECK (p != NULL) ;
+    OK (LAGraph_Workspace_Stats (&inuse, NULL, NULL, ws, msg)) ;
+    TEST_CHECK (inuse == 0) ;
+    OK (LG_Workspace_Free ((void **) &p, msg)) ;
+    TEST_CHECK (p == NULL) ;
+
+    // attach the workspace and allocate a block from it
+    OK (LAGraph_Workspace_Attach (ws, msg)) ;
+    OK (LG_Workspace_Calloc ((void **) &p, 1000, sizeof (int64_t), msg)) ;
+    for (int k = 0 ; k < 1000 ; k++)
+    {
+        TEST_CHECK (p [k] == 0) ;
+        p [k] = k ;
+    }
+    OK (LAGraph_Workspace_Stats (&inuse, &high_water, &cached, ws, msg)) ;
+    TEST_CHECK (inuse >= 1000 * sizeof (int64_t)) ;
+    TEST_CHECK (inuse <= 1250 * sizeof (int64_t)) ;
+    TEST_CHECK (high_water == inuse) ;
+    TEST_CHECK (cached == 0) ;
+
+    // the workspace cannot be deleted while a block is in use
+    int result = LAGraph_Workspace_Delete (&ws, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (ws != NULL) ;
+
+    // free the block: it is kept in the pool
+    int64_t *p_old = p ;
+    size_t size = inuse ;
+    OK (LG_Workspace_Free ((void **) &p, msg)) ;
+    TEST_CHECK (p == NULL) ;
+    OK (LAGraph_Workspace_Stats (&inuse, &high_water, &cached, ws, msg)) ;
+    TEST_CHECK (inuse == 0 && high_water == size && cached == size) ;
+
+    // a block of a similar size reuses the block from the pool
+    OK (LG_Workspace_Malloc ((void **) &p, 999, sizeof (int64_t), msg)) ;
+    TEST_CHECK (p == p_old) ;
+    OK (LAGraph_Workspace_Stats (&inuse, &high_water, &cached, ws, msg)) ;
+    TEST_CHECK (inuse == size && high_water == size && cached == 0) ;
+
+    // detach the workspace; the block still returns to its own pool
+    OK (LAGraph_Workspace_Attach (NULL, msg)) ;
+    OK (LG_Workspace_Free ((void **) &p, msg)) ;
+    OK (LAGraph_Workspace_Stats (&inuse, &high_water, &cached, ws, msg)) ;
+    TEST_CHECK (inuse == 0 && cached == size) ;
+
+    // release the pools
+    OK (LAGraph_Workspace_Release (ws, msg)) ;
+    OK (LAGraph_Workspace_Stats (&inuse, &high_water, &cached, ws, msg)) ;
+    TEST_CHECK (inuse == 0 && high_water == 0 && cached == 0) ;
+
+    OK (LAGraph_Workspace_Delete (&ws, msg)) ;
+    TEST_CHECK (ws == NULL) ;
+    OK (LAGraph_Workspace_Delete (&ws, msg)) ;
+    OK (LAGraph_Workspace_Delete (NULL, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//-----------------------------------------------------------------------------
+// test_Workspace_reuse: reuse a workspace across calls to LAGraph
+//-----------------------------------------------------------------------------
+
+void test_Workspace_reuse (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_Workspace_New (&ws, msg)) ;
+    OK (LAGraph_Workspace_Attach (ws, msg)) ;
+
+    int64_t n = 256 * 1024 ;
+    int64_t *A_0 = NULL, *A_1 = NULL ;
+    OK (LAGraph_Malloc ((void **) &A_0, n, sizeof (int64_t), msg)) ;
+    OK (LAGraph_Malloc ((void **) &A_1, n, sizeof (int64_t), msg)) ;
+
+    size_t inuse, high_water, cached, high_water_first = 0 ;
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        // sort a random set of pairs
+        uint64_t seed = 42 + trial ;
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            A_0 [k] = LG_Random60 (&seed) % 1000 ;
+            A_1 [k] = LG_Random60 (&seed) % 1000 ;
+        }
+        OK (LG_msort2 (A_0, A_1, n, msg)) ;
+        for (int64_t k = 1 ; k < n ; k++)
+        {
+            TEST_CHECK (A_0 [k-1] < A_0 [k] ||
+                (A_0 [k-1] == A_0 [k] && A_1 [k-1] <= A_1 [k])) ;
+        }
+
+        // find the most frequent entry
+        int64_t mode, count ;
+        OK (LG_mode (&mode, &count, A_0, n, msg)) ;
+        TEST_CHECK (count > 0) ;
+
+        // all workspace is returned to the pools, and after the first trial
+        // no new memory is needed
+        OK (LAGraph_Workspace_Stats (&inuse, &high_water, &cached, ws, msg)) ;
+        TEST_CHECK (inuse == 0) ;
+        TEST_CHECK (high_water > 0) ;
+        TEST_CHECK (cached > 0) ;
+        if (trial == 0)
+        {
+            high_water_first = high_water ;
+        }
+        else
+        {
+            TEST_CHECK (high_water == high_water_first) ;
+        }
+    }
+
+    OK (LAGraph_Free ((void **) &A_0, msg)) ;
+    OK (LAGraph_Free ((void **) &A_1, msg)) ;
+    OK (LAGraph_Workspace_Delete (&ws, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//-----------------------------------------------------------------------------
+// test_Workspace_errors
+//-----------------------------------------------------------------------------
+
+void test_Workspace_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    int result = LAGraph_Workspace_New (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGraph_Workspace_Release (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    size_t inuse ;
+    result = LAGraph_Workspace_Stats (&inuse, NULL, NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LG_Workspace_Malloc (NULL, 1, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    int64_t *p = NULL ;
+    result = LG_Workspace_Malloc ((void **) &p, GrB_INDEX_MAX + 1,
+        sizeof (int64_t), msg) ;
+    TEST_CHECK (result == GrB_OUT_OF_MEMORY) ;
+    TEST_CHECK (p == NULL) ;
+
+    OK (LG_Workspace_Free (NULL, msg)) ;
+    OK (LG_Workspace_Free ((void **) &p, msg)) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//-----------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//-----------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"test_Workspace_pool", test_Workspace_pool},
+    {"test_Workspace_reuse", test_Workspace_reuse},
+    {"test_Workspace_errors", test_Workspace_errors},
+    // no brutal test needed
+    {NULL, NULL}
+};
@@ -16,9 +16,7 @@
 //------------------------------------------------------------------------------
 
 // LAGr_SampleDegree computes estimates of the mean and median of the
-// row or column degree of a graph.
-
-#define LG_FREE_ALL LAGraph_Free ((void **) &samples, NULL) ;
+// row or column degree of a graph, with LAGraph_SampleQuantiles.
 
 #include "LG_internal.h"
 
@@ -41,7 +39,6 @@ int LAGr_SampleDegree
     //--------------------------------------------------------------------------
 
     LG_CLEAR_MSG ;
-    int64_t *samples = NULL ;
     LG_ASSERT (sample_mean != NULL, GrB_NULL_POINTER) ;
     LG_ASSERT (sample_median != NULL, GrB_NULL_POINTER) ;
     nsamples = LAGRAPH_MAX (nsamples, 1) ;
@@ -65,48 +62,11 @@ int LAGr_SampleDegree
     LG_ASSERT_MSG (Degree != NULL, LAGRAPH_NOT_CACHED, "degree unknown") ;
 
     //--------------------------------------------------------------------------
-    // allocate workspace
-    //--------------------------------------------------------------------------
-
-    LG_TRY (LAGraph_Malloc ((void **) &samples, nsamples, sizeof (int64_t),
-        msg)) ;
-
-    //--------------------------------------------------------------------------
-    // pick nsamples nodes at random and determine their degree
-    //--------------------------------------------------------------------------
-
-    // See also the hashed sampling method in LG_CC_FastSV6, which computes a
-    // fast estimate of the mode of an integer vector.  This method does not
-    // require a hash table.  However, the mode estimator in LG_CC_FastSV6
-    // would be a good candidate to add as an LAGraph_SampleMode utility
-    // function.
-
-    GrB_Index n ;
-    GRB_TRY (GrB_Vector_size (&n, Degree)) ;
-
-    int64_t dsum = 0 ;
-    for (int k = 0 ; k < nsamples ; k++)
-    {
-        uint64_t result = LG_Random60 (&seed) ;
-        int64_t i = result % n ;
-        // d = Degree (i)
-        int64_t d ;
-        GRB_TRY (GrB_Vector_extractElement (&d, Degree, i)) ;
-        samples [k] = d ;
-        dsum += d ;
-    }
-
-    // find the mean degree
-    (*sample_mean) = ((double) dsum) / nsamples ;
-
-    // find the median degree
-    LG_qsort_1a (samples, nsamples) ;
-    (*sample_median) = (double) samples [nsamples/2] ;
-
-    //--------------------------------------------------------------------------
-    // free workspace and return result
+    // pick nsamples nodes at random and find their mean and median degree
     //--------------------------------------------------------------------------
 
-    LG_FREE_ALL ;
-    return (GrB_SUCCESS) ;
+    // Nodes not present in Degree have degree zero.
+    const double half = 0.5 ;
+    return (LAGraph_SampleQuantiles (sample_median, sample_mean, Degree,
+        &half, 1, nsamples, seed, msg)) ;
 }
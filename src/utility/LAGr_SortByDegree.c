@@ -37,16 +37,16 @@
 // the permutation (or P [k] = j if column j is the kth column in the
 // permutation, with byout false).
 
-#define LG_FREE_WORK                    \
-{                                       \
-    LAGraph_Free ((void **) &W, NULL) ; \
-    LAGraph_Free ((void **) &D, NULL) ; \
+#define LG_FREE_WORK                            \
+{                                               \
+    LG_Workspace_Free ((void **) &W, NULL) ;    \
+    LG_Workspace_Free ((void **) &D, NULL) ;    \
 }
 
-#define LG_FREE_ALL                     \
-{                                       \
-    LG_FREE_WORK ;                      \
-    LAGraph_Free ((void **) &P, NULL) ; \
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+    LAGraph_Free ((void **) &P, NULL) ;         \
 }
 
 #include "LG_internal.h"
@@ -109,8 +109,8 @@ int LAGr_SortByDegree
     //--------------------------------------------------------------------------
 
     LG_TRY (LAGraph_Malloc ((void **) &P, n, sizeof (int64_t), msg)) ;
-    LG_TRY (LAGraph_Malloc ((void **) &D, n, sizeof (int64_t), msg)) ;
-    LG_TRY (LAGraph_Malloc ((void **) &W, 2*n, sizeof (int64_t), msg)) ;
+    LG_TRY (LG_Workspace_Malloc ((void **) &D, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LG_Workspace_Malloc ((void **) &W, 2*n, sizeof (int64_t), msg)) ;
     int64_t *W0 = W ;
     int64_t *W1 = W + n ;
 
@@ -148,12 +148,15 @@ int LAGr_SortByDegree
         }
     }
 
-    LG_TRY (LAGraph_Free ((void **) &W, NULL)) ;
+    LG_TRY (LG_Workspace_Free ((void **) &W, NULL)) ;
 
     //--------------------------------------------------------------------------
     // sort by degrees, with ties by node id
     //--------------------------------------------------------------------------
 
+    // The degrees and node ids are both in the range 0 to n-1, so LG_msort2
+    // uses a radix sort for large graphs (see LG_rsort), unless n > 2^32.
+
     LG_TRY (LG_msort2 (D, P, n, msg)) ;
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+// LAGraph_AddEdges: add a batch of edges to a graph, updating its cache
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_AddEdges adds the entries of E to G->A: G->A<struct(E)> = E.
+// Entries of E not yet in G->A are new edges; entries already in G->A replace
+// the weights of those edges.  If G is undirected, E' is added as well (an
+// entry E(i,j) takes precedence over E(j,i)), so G->A stays symmetric.
+
+// The cached properties of G are updated rather than deleted, with work
+// proportional to the number of entries in E (and the number of nodes, for
+// the degrees), not the number of entries in G->A:
+
+//      G->AT:          G->AT<struct(E')> = E'
+//      G->out_degree,
+//      G->in_degree:   incremented by the degrees of the new edges
+//      G->nself_edges: incremented by the number of new self-edges
+//      G->is_symmetric_structure: checked against the new edges if true,
+//                      unknown otherwise (for a directed graph)
+//      G->emin,
+//      G->emax:        min (G->emin, min (E)), and likewise for G->emax.
+//                      These become a BOUND if an existing edge was changed,
+//                      since the old min or max edge may have been replaced.
+
+// If an error occurs after G->A has been modified, all cached properties of G
+// are deleted, so G remains valid.
+
+#include "LG_internal.h"
+
+//------------------------------------------------------------------------------
+// LG_edge_bound: G->emin = min (G->emin, min (E)), or likewise for G->emax
+//------------------------------------------------------------------------------
+
+static int LG_edge_bound
+(
+    // input/output:
+    GrB_Scalar bound,       // G->emin or G->emax
+    // input:
+    GrB_Vector v,           // workspace vector of size 2, same type as bound
+    GrB_Scalar s,           // workspace scalar, same type as bound
+    GrB_Monoid monoid,      // min or max monoid for the type of bound
+    GrB_Matrix E,           // edges added to G->A
+    char *msg
+)
+{
+    // v = [bound, reduce (E)], and then bound = reduce (v)
+    GRB_TRY (GrB_Vector_clear (v)) ;
+    GRB_TRY (GrB_Vector_setElement_Scalar (v, bound, 0)) ;
+    GRB_TRY (GrB_reduce (s, NULL, monoid, E, NULL)) ;
+    GRB_TRY (GrB_Vector_setElement_Scalar (v, s, 1)) ;
+    GRB_TRY (GrB_reduce (bound, NULL, monoid, v, NULL)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_AddEdges
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#undef  LG_FREE_ALL
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&ES) ;                \
+    GrB_free (&ET) ;                \
+    GrB_free (&New) ;               \
+    GrB_free (&v) ;                 \
+    GrB_free (&s) ;                 \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    if (modified)                           \
+    {                                       \
+        LAGraph_DeleteCached (G, NULL) ;    \
+    }                                       \
+}
+
+int LAGraph_AddEdges
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to modify
+    // input:
+    const GrB_Matrix E,     // edges to add, or whose weights are changed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix ES = NULL, ET = NULL, New = NULL ;
+    GrB_Vector v = NULL ;
+    GrB_Scalar s = NULL ;
+    bool modified = false ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+    LG_ASSERT (E != NULL, GrB_NULL_POINTER) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n, nrows, ncols, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, E)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, E)) ;
+    LG_ASSERT_MSG (nrows == n && ncols == n, GrB_DIMENSION_MISMATCH,
+        "E must have the same size as G->A") ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, E)) ;
+    if (nvals == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    GrB_Type etype, atype ;
+    LG_TRY (LAGraph_Matrix_TypeName (type_name, E, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, type_name, msg)) ;
+    LG_TRY (LAGraph_Matrix_TypeName (type_name, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&atype, type_name, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // ES = E + E' for an undirected graph, with E taking precedence
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix Eadd = E ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED)
+    {
+        GRB_TRY (GrB_Matrix_new (&ES, etype, n, n)) ;
+        GRB_TRY (GrB_transpose (ES, NULL, NULL, E, NULL)) ;
+        GRB_TRY (GrB_assign (ES, E, NULL, E, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        Eadd = ES ;
+        GRB_TRY (GrB_Matrix_nvals (&nvals, Eadd)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // New = the entries of Eadd not already in A
+    //--------------------------------------------------------------------------
+
+    GrB_Index nnew ;
+    GRB_TRY (GrB_Matrix_new (&New, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_assign (New, Eadd, NULL, (bool) true, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_S)) ;
+    GRB_TRY (GrB_assign (New, A, NULL, New, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_RSC)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nnew, New)) ;
+
+    //--------------------------------------------------------------------------
+    // A<struct(Eadd)> = Eadd and AT<struct(Eadd')> = Eadd'
+    //--------------------------------------------------------------------------
+
+    modified = true ;
+    GRB_TRY (GrB_assign (A, Eadd, NULL, Eadd, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_S)) ;
+    if (G->AT != NULL)
+    {
+        GRB_TRY (GrB_Matrix_new (&ET, etype, n, n)) ;
+        GRB_TRY (GrB_transpose (ET, NULL, NULL, Eadd, NULL)) ;
+        GRB_TRY (GrB_assign (G->AT, ET, NULL, ET, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_S)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update G->emin and G->emax
+    //--------------------------------------------------------------------------
+
+    if (G->emin != NULL || G->emax != NULL)
+    {
+        // G->emin and G->emax exist only for built-in types
+        GrB_Monoid min_monoid = NULL, max_monoid = NULL ;
+        LG_TRY (LG_minmax_monoids (&min_monoid, &max_monoid, atype, msg)) ;
+
+        GRB_TRY (GrB_Vector_new (&v, atype, 2)) ;
+        GRB_TRY (GrB_Scalar_new (&s, atype)) ;
+
+        // if an existing edge was changed, the old min or max may be gone
+        bool changed = (nnew < nvals) ;
+        if (G->emin != NULL)
+        {
+            LG_TRY (LG_edge_bound (G->emin, v, s, min_monoid, Eadd, msg)) ;
+            if (changed && G->emin_state == LAGraph_VALUE)
+            {
+                G->emin_state = LAGraph_BOUND ;
+            }
+        }
+        if (G->emax != NULL)
+        {
+            LG_TRY (LG_edge_bound (G->emax, v, s, max_monoid, Eadd, msg)) ;
+            if (changed && G->emax_state == LAGraph_VALUE)
+            {
+                G->emax_state = LAGraph_BOUND ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // update the degrees, G->nself_edges, and G->is_symmetric_structure
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_update_cached (G, New, true, msg)) ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,450 @@
+//------------------------------------------------------------------------------
+// LAGraph_Cached_All: compute a set of cached properties of a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_Cached_All computes the cached properties of G selected by flags,
+// a bitwise OR of LAGraph_CacheFlags, in a single call.  It gives the same
+// results as calling each LAGraph_Cached_* method in turn, but shares work
+// between them:
+
+//  (1) G->AT is computed at most once, and only if it is requested.
+//  (2) For SuiteSparse:GraphBLAS, G->A is unpacked in sorted CSR form (in
+//      O(1) time and memory, if G->A is already held by row), and
+//      G->out_degree, G->nself_edges, G->emin, and G->emax are all found in a
+//      single parallel sweep over its rows.  G->A is then packed back.
+//  (3) Otherwise, G->out_degree is the row degree of G->A, and G->emin and
+//      G->emax share the type and monoid lookup of G->A.
+//  (4) G->in_degree is the row degree of G->AT if it exists (or was just
+//      requested); otherwise it is the column degree of G->A, as in
+//      LAGraph_Cached_InDegree.  G->AT is not computed just to find
+//      G->in_degree.
+//  (5) G->is_symmetric_structure is checked after the degrees and G->AT are
+//      computed, so LAGraph_Cached_IsSymmetricStructure can use them: the
+//      check ends early if the degrees differ, and compares G->A with G->AT
+//      if it exists.
+
+// Properties that are already cached are not recomputed, except that a bound
+// on G->emin or G->emax is replaced with its value.  For an undirected graph,
+// G->AT and G->in_degree are not computed (as with LAGraph_Cached_AT and
+// LAGraph_Cached_InDegree), and G->is_symmetric_structure is true.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&x) ;                                 \
+    LAGraph_Free ((void **) &Degree, NULL) ;        \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&out_degree) ;                        \
+    GrB_free (&in_degree) ;                         \
+    GrB_free (&emin) ;                              \
+    GrB_free (&emax) ;                              \
+}
+
+#include "LG_internal.h"
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// LG_cached_csr_TYPE: one sweep over a CSR matrix, for each built-in type
+//------------------------------------------------------------------------------
+
+// The bool entries are accessed as uint8_t, so the smallest and largest
+// entries are their logical AND and OR.
+
+#define LG_cached_csr LG_cached_csr_BOOL
+#define LG_ctype uint8_t
+#define LG_CTYPE_MIN 0
+#define LG_CTYPE_MAX 1
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_INT8
+#define LG_ctype int8_t
+#define LG_CTYPE_MIN INT8_MIN
+#define LG_CTYPE_MAX INT8_MAX
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_INT16
+#define LG_ctype int16_t
+#define LG_CTYPE_MIN INT16_MIN
+#define LG_CTYPE_MAX INT16_MAX
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_INT32
+#define LG_ctype int32_t
+#define LG_CTYPE_MIN INT32_MIN
+#define LG_CTYPE_MAX INT32_MAX
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_INT64
+#define LG_ctype int64_t
+#define LG_CTYPE_MIN INT64_MIN
+#define LG_CTYPE_MAX INT64_MAX
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_UINT8
+#define LG_ctype uint8_t
+#define LG_CTYPE_MIN 0
+#define LG_CTYPE_MAX UINT8_MAX
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_UINT16
+#define LG_ctype uint16_t
+#define LG_CTYPE_MIN 0
+#define LG_CTYPE_MAX UINT16_MAX
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_UINT32
+#define LG_ctype uint32_t
+#define LG_CTYPE_MIN 0
+#define LG_CTYPE_MAX UINT32_MAX
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_UINT64
+#define LG_ctype uint64_t
+#define LG_CTYPE_MIN 0
+#define LG_CTYPE_MAX UINT64_MAX
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_FP32
+#define LG_ctype float
+#define LG_CTYPE_MIN (-INFINITY)
+#define LG_CTYPE_MAX INFINITY
+#include "LG_cached_csr_template.h"
+
+#define LG_cached_csr LG_cached_csr_FP64
+#define LG_ctype double
+#define LG_CTYPE_MIN (-INFINITY)
+#define LG_CTYPE_MAX INFINITY
+#include "LG_cached_csr_template.h"
+
+//------------------------------------------------------------------------------
+// LG_cached_all_TYPE: unpack A, sweep over it, and pack it back
+//------------------------------------------------------------------------------
+
+// A is unpacked in CSR form, with sorted indices, and packed back after the
+// sweep; no GraphBLAS errors can occur between the unpack and pack.  emin and
+// emax, if not NULL, are GrB_Scalars of the same type as A, and are left
+// empty if A has no entries.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+#define LG_CACHED_ALL(suffix,ctype)                                         \
+static int LG_cached_all_ ## suffix                                         \
+(                                                                           \
+    int64_t *degree, int64_t *nself_edges, GrB_Scalar emin,                 \
+    GrB_Scalar emax, GrB_Matrix A, int nthreads, char *msg                  \
+)                                                                           \
+{                                                                           \
+    GrB_Index *Ap = NULL, *Aj = NULL ;                                      \
+    void *Ax = NULL ;                                                       \
+    GrB_Index Ap_size, Aj_size, Ax_size, nrows ;                            \
+    bool iso ;                                                              \
+    ctype amin = 0, amax = 0 ;                                              \
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;                                \
+    GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,   \
+        &Ax_size, &iso, NULL, NULL)) ;                                      \
+    GrB_Index nvals = Ap [nrows] ;                                          \
+    LG_cached_csr_ ## suffix (degree, nself_edges,                          \
+        (emin == NULL) ? NULL : &amin, (emax == NULL) ? NULL : &amax,       \
+        Ap, Aj, Ax, iso, (int64_t) nrows, nthreads) ;                       \
+    GRB_TRY (GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size,       \
+        Ax_size, iso, /* A is not jumbled: */ false, NULL)) ;               \
+    if (nvals > 0 && emin != NULL)                                          \
+    {                                                                       \
+        GRB_TRY (GrB_Scalar_setElement (emin, amin)) ;                      \
+    }                                                                       \
+    if (nvals > 0 && emax != NULL)                                          \
+    {                                                                       \
+        GRB_TRY (GrB_Scalar_setElement (emax, amax)) ;                      \
+    }                                                                       \
+    return (GrB_SUCCESS) ;                                                  \
+}
+
+LG_CACHED_ALL (BOOL  , uint8_t ) ;
+LG_CACHED_ALL (INT8  , int8_t  ) ;
+LG_CACHED_ALL (INT16 , int16_t ) ;
+LG_CACHED_ALL (INT32 , int32_t ) ;
+LG_CACHED_ALL (INT64 , int64_t ) ;
+LG_CACHED_ALL (UINT8 , uint8_t ) ;
+LG_CACHED_ALL (UINT16, uint16_t) ;
+LG_CACHED_ALL (UINT32, uint32_t) ;
+LG_CACHED_ALL (UINT64, uint64_t) ;
+LG_CACHED_ALL (FP32  , float   ) ;
+LG_CACHED_ALL (FP64  , double  ) ;
+
+typedef int (*LG_cached_all_f)
+(
+    int64_t *, int64_t *, GrB_Scalar, GrB_Scalar, GrB_Matrix, int, char *
+) ;
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&out_degree) ;                        \
+    GrB_free (&in_degree) ;                         \
+    GrB_free (&emin) ;                              \
+    GrB_free (&emax) ;                              \
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_All
+//------------------------------------------------------------------------------
+
+int LAGraph_Cached_All
+(
+    // input/output:
+    LAGraph_Graph G,    // graph for which to compute cached properties
+    // input:
+    int flags,          // bitwise OR of LAGraph_CacheFlags
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // clear msg and check G
+    //--------------------------------------------------------------------------
+
+    GrB_Vector x = NULL, out_degree = NULL, in_degree = NULL ;
+    GrB_Scalar emin = NULL, emax = NULL ;
+    int64_t *Degree = NULL ;
+    GrB_Index *I = NULL ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+    LG_ASSERT_MSG ((flags & ~LAGraph_CACHE_ALL) == 0, GrB_INVALID_VALUE,
+        "flags not recognized") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index nrows, ncols ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, A)) ;
+
+    bool undirected = (G->kind == LAGraph_ADJACENCY_UNDIRECTED) ;
+    bool want_sym = (flags & LAGraph_CACHE_IS_SYMMETRIC_STRUCTURE) &&
+        (G->is_symmetric_structure == LAGRAPH_UNKNOWN) ;
+    bool want_out = (flags & LAGraph_CACHE_OUT_DEGREE) &&
+        (G->out_degree == NULL) ;
+    bool want_in  = (flags & LAGraph_CACHE_IN_DEGREE) &&
+        (G->in_degree == NULL) && !undirected ;
+    bool want_nself = (flags & LAGraph_CACHE_NSELF_EDGES) &&
+        (G->nself_edges == LAGRAPH_UNKNOWN) ;
+    // a bound on emin or emax is replaced with its value
+    bool want_emin = (flags & LAGraph_CACHE_EMIN) &&
+        (G->emin == NULL || G->emin_state != LAGraph_VALUE) ;
+    bool want_emax = (flags & LAGraph_CACHE_EMAX) &&
+        (G->emax == NULL || G->emax_state != LAGraph_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // determine the type of G->A and its min/max monoids
+    //--------------------------------------------------------------------------
+
+    char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (atype_name, A, msg)) ;
+    GrB_Type atype ;
+    LG_TRY (LAGraph_TypeFromName (&atype, atype_name, msg)) ;
+    GrB_Monoid min_monoid = NULL, max_monoid = NULL ;
+    if (want_emin || want_emax)
+    {
+        LG_TRY (LG_minmax_monoids (&min_monoid, &max_monoid, atype, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // G->AT = (G->A)', computed once for all properties that need it
+    //--------------------------------------------------------------------------
+
+    if (!undirected && G->AT == NULL && (flags & LAGraph_CACHE_AT))
+    {
+        LG_TRY (LAGraph_Cached_AT (G, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // G->out_degree, G->nself_edges, G->emin, G->emax: one sweep over G->A
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+    if (want_out || want_nself || want_emin || want_emax)
+    {
+        int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+        nthreads = LAGRAPH_MIN (nthreads, nrows / 1024) ;
+        nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+        // allocate all workspace and outputs before G->A is unpacked
+        if (want_out)
+        {
+            LG_TRY (LAGraph_Malloc ((void **) &Degree, LAGRAPH_MAX (nrows, 1),
+                sizeof (int64_t), msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (nrows, 1),
+                sizeof (GrB_Index), msg)) ;
+            GRB_TRY (GrB_Vector_new (&out_degree, GrB_INT64, nrows)) ;
+        }
+        if (want_emin)
+        {
+            GRB_TRY (GrB_Scalar_new (&emin, atype)) ;
+        }
+        if (want_emax)
+        {
+            GRB_TRY (GrB_Scalar_new (&emax, atype)) ;
+        }
+
+        // the entries of a user-defined type are not accessed
+        LG_cached_all_f sweep = LG_cached_all_BOOL ;
+        if      (atype == GrB_INT8  ) sweep = LG_cached_all_INT8   ;
+        else if (atype == GrB_INT16 ) sweep = LG_cached_all_INT16  ;
+        else if (atype == GrB_INT32 ) sweep = LG_cached_all_INT32  ;
+        else if (atype == GrB_INT64 ) sweep = LG_cached_all_INT64  ;
+        else if (atype == GrB_UINT8 ) sweep = LG_cached_all_UINT8  ;
+        else if (atype == GrB_UINT16) sweep = LG_cached_all_UINT16 ;
+        else if (atype == GrB_UINT32) sweep = LG_cached_all_UINT32 ;
+        else if (atype == GrB_UINT64) sweep = LG_cached_all_UINT64 ;
+        else if (atype == GrB_FP32  ) sweep = LG_cached_all_FP32   ;
+        else if (atype == GrB_FP64  ) sweep = LG_cached_all_FP64   ;
+
+        int64_t nself_edges ;
+        LG_TRY (sweep (Degree, want_nself ? &nself_edges : NULL, emin, emax,
+            A, nthreads, msg)) ;
+
+        if (want_out)
+        {
+            // G->out_degree = the nonzero row degrees
+            GrB_Index nz = 0 ;
+            for (GrB_Index i = 0 ; i < nrows ; i++)
+            {
+                if (Degree [i] > 0)
+                {
+                    I [nz] = i ;
+                    Degree [nz] = Degree [i] ;
+                    nz++ ;
+                }
+            }
+            GRB_TRY (GrB_Vector_build (out_degree, I, Degree, nz,
+                GrB_PLUS_INT64)) ;
+            G->out_degree = out_degree ;
+            out_degree = NULL ;
+        }
+        if (want_nself)
+        {
+            G->nself_edges = nself_edges ;
+        }
+        if (want_emin)
+        {
+            GrB_free (&(G->emin)) ;
+            G->emin = emin ;
+            emin = NULL ;
+            G->emin_state = LAGraph_VALUE ;
+        }
+        if (want_emax)
+        {
+            GrB_free (&(G->emax)) ;
+            G->emax = emax ;
+            emax = NULL ;
+            G->emax_state = LAGraph_VALUE ;
+        }
+        want_out = want_nself = want_emin = want_emax = false ;
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // G->out_degree and G->in_degree: the row degrees of G->A and G->AT
+    //--------------------------------------------------------------------------
+
+    if (want_out || want_in)
+    {
+        // x = zeros (ncols,1), shared by both degrees if A is square
+        GRB_TRY (GrB_Vector_new (&x, GrB_INT64, ncols)) ;
+        GRB_TRY (GrB_assign (x, NULL, NULL, 0, GrB_ALL, ncols, NULL)) ;
+    }
+
+    if (want_out)
+    {
+        GRB_TRY (GrB_Vector_new (&out_degree, GrB_INT64, nrows)) ;
+        GRB_TRY (GrB_mxv (out_degree, NULL, NULL, LAGraph_plus_one_int64,
+            A, x, NULL)) ;
+        G->out_degree = out_degree ;
+        out_degree = NULL ;
+    }
+
+    if (want_in)
+    {
+        if (nrows != ncols)
+        {
+            // x = zeros (nrows,1)
+            GRB_TRY (GrB_Vector_resize (x, nrows)) ;
+            GRB_TRY (GrB_assign (x, NULL, NULL, 0, GrB_ALL, nrows, NULL)) ;
+        }
+        GRB_TRY (GrB_Vector_new (&in_degree, GrB_INT64, ncols)) ;
+        if (G->AT != NULL)
+        {
+            // G->in_degree = row degree of G->AT
+            GRB_TRY (GrB_mxv (in_degree, NULL, NULL, LAGraph_plus_one_int64,
+                G->AT, x, NULL)) ;
+        }
+        else
+        {
+            // G->in_degree = column degree of G->A
+            GRB_TRY (GrB_mxv (in_degree, NULL, NULL, LAGraph_plus_one_int64,
+                A, x, GrB_DESC_T0)) ;
+        }
+        G->in_degree = in_degree ;
+        in_degree = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // G->nself_edges
+    //--------------------------------------------------------------------------
+
+    if (want_nself)
+    {
+        LG_TRY (LG_nself_edges (&G->nself_edges, A, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // G->is_symmetric_structure
+    //--------------------------------------------------------------------------
+
+    if (want_sym)
+    {
+        // uses the degrees and G->AT computed above, if any
+        LG_TRY (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // G->emin and G->emax
+    //--------------------------------------------------------------------------
+
+    if (want_emin)
+    {
+        GrB_free (&(G->emin)) ;
+        G->emin_state = LAGRAPH_UNKNOWN ;
+        GRB_TRY (GrB_Scalar_new (&(G->emin), atype)) ;
+        GRB_TRY (GrB_reduce (G->emin, NULL, min_monoid, A, NULL)) ;
+        G->emin_state = LAGraph_VALUE ;
+    }
+    if (want_emax)
+    {
+        GrB_free (&(G->emax)) ;
+        G->emax_state = LAGRAPH_UNKNOWN ;
+        GRB_TRY (GrB_Scalar_new (&(G->emax), atype)) ;
+        GRB_TRY (GrB_reduce (G->emax, NULL, max_monoid, A, NULL)) ;
+        G->emax_state = LAGraph_VALUE ;
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -36,12 +36,14 @@ int LAGraph_Cached_EMax
 
     LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
 
-    if (G->emax != NULL)
+    if (G->emax != NULL && G->emax_state == LAGraph_VALUE)
     {
         // G->emax already computed
         return (GrB_SUCCESS) ;
     }
 
+    // G->emax may be a bound (from LAGraph_DeleteSelfEdges); recompute it
+    GrB_free (&(G->emax)) ;
     G->emax_state = LAGRAPH_UNKNOWN ;
 
     //--------------------------------------------------------------------------
@@ -36,12 +36,14 @@ int LAGraph_Cached_EMin
 
     LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
 
-    if (G->emin != NULL)
+    if (G->emin != NULL && G->emin_state == LAGraph_VALUE)
     {
         // G->emin already computed
         return (GrB_SUCCESS) ;
     }
 
+    // G->emin may be a bound (from LAGraph_DeleteSelfEdges); recompute it
+    GrB_free (&(G->emin)) ;
     G->emin_state = LAGRAPH_UNKNOWN ;
 
     //--------------------------------------------------------------------------
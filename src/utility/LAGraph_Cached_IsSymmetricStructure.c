@@ -12,21 +12,95 @@
 // DM22-0790
 
 // Contributed by Timothy A. Davis, Texas A&M University
-
 //------------------------------------------------------------------------------
 
-// Also computes G->AT if not already computed, if G is not an undirected
-// graph and G->A is square.
+// LAGraph_Cached_IsSymmetricStructure determines G->is_symmetric_structure
+// without computing the transpose of G->A, if possible:
+
+//  (1) The row and column degrees of G->A are compared first (G->out_degree
+//      and G->in_degree are computed if not already cached).  If they differ,
+//      the structure is not symmetric.  This refutes most unsymmetric graphs
+//      with O(n) extra memory.
+//  (2) If G->AT is already cached, the structures of G->A and G->AT are
+//      compared.
+//  (3) Otherwise, for SuiteSparse:GraphBLAS, G->A is unpacked in sorted CSR
+//      form (in O(1) time and memory, if G->A is already held by row), and
+//      each entry A(i,j) is checked in parallel with a binary search for
+//      A(j,i) in row j.  The check stops at the first mismatch, and G->A is
+//      packed back.  No O(nnz) temporary is allocated.
+//  (4) For other GraphBLAS libraries, G->AT is computed and used as in (2).
 
 #define LG_FREE_WORK        \
 {                           \
-    GrB_free (&S1) ;        \
-    GrB_free (&S2) ;        \
     GrB_free (&C) ;         \
 }
 
 #include "LG_internal.h"
 
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// LG_is_symmetric_csr: check the structure of a square CSR matrix
+//------------------------------------------------------------------------------
+
+// Returns true if A(j,i) exists for every A(i,j).  The column indices in each
+// row must be sorted.
+
+static bool LG_is_symmetric_csr
+(
+    const GrB_Index *LG_RESTRICT Ap,
+    const GrB_Index *LG_RESTRICT Aj,
+    const int64_t n
+)
+{
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 1024) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    bool symmetric = true ;
+
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+    for (i = 0 ; i < n ; i++)
+    {
+        // skip the rest of the rows once a mismatch is found
+        bool ok ;
+        #pragma omp atomic read
+        ok = symmetric ;
+        if (!ok) continue ;
+        for (GrB_Index p = Ap [i] ; ok && p < Ap [i+1] ; p++)
+        {
+            // binary search for i in Aj [Ap [j] ... Ap [j+1]-1]
+            GrB_Index j = Aj [p] ;
+            GrB_Index left = Ap [j], right = Ap [j+1] ;
+            while (left < right)
+            {
+                GrB_Index middle = left + (right - left) / 2 ;
+                if (Aj [middle] < (GrB_Index) i)
+                {
+                    left = middle + 1 ;
+                }
+                else
+                {
+                    right = middle ;
+                }
+            }
+            ok = (left < Ap [j+1] && Aj [left] == (GrB_Index) i) ;
+        }
+        if (!ok)
+        {
+            #pragma omp atomic write
+            symmetric = false ;
+        }
+    }
+    return (symmetric) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_Cached_IsSymmetricStructure
+//------------------------------------------------------------------------------
+
 int LAGraph_Cached_IsSymmetricStructure
 (
     // input/output:
@@ -39,7 +113,7 @@ int LAGraph_Cached_IsSymmetricStructure
     // clear msg and check G
     //--------------------------------------------------------------------------
 
-    GrB_Matrix C = NULL, S1 = NULL, S2 = NULL ;
+    GrB_Matrix C = NULL ;
     LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
 
     if (G->kind == LAGraph_ADJACENCY_UNDIRECTED)
@@ -71,13 +145,46 @@ int LAGraph_Cached_IsSymmetricStructure
     }
 
     //--------------------------------------------------------------------------
-    // compute the transpose, if not already computed
+    // compare the row and column degrees of A
     //--------------------------------------------------------------------------
 
+    bool symmetric ;
+    LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    LG_TRY (LAGraph_Cached_InDegree (G, msg)) ;
+    LG_TRY (LAGraph_Vector_IsEqual (&symmetric, G->out_degree, G->in_degree,
+        msg)) ;
+    if (!symmetric)
+    {
+        // the structure of A cannot be symmetric
+        G->is_symmetric_structure = LAGraph_FALSE ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check if A(j,i) exists for each A(i,j)
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
     if (G->AT == NULL)
     {
-        LG_TRY (LAGraph_Cached_AT (G, msg)) ;
+        // unpack A in CSR form, with sorted indices, check it, and pack it
+        // back; no GraphBLAS errors can occur between the unpack and pack
+        GrB_Index *Ap = NULL, *Aj = NULL ;
+        void *Ax = NULL ;
+        GrB_Index Ap_size, Aj_size, Ax_size ;
+        bool iso ;
+        GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+            &Ax_size, &iso, NULL, NULL)) ;
+        symmetric = LG_is_symmetric_csr (Ap, Aj, (int64_t) n) ;
+        GRB_TRY (GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size,
+            Ax_size, iso, /* A is not jumbled: */ false, NULL)) ;
+        G->is_symmetric_structure =
+            symmetric ? LAGraph_TRUE : LAGraph_FALSE ;
+        return (GrB_SUCCESS) ;
     }
+    #else
+    LG_TRY (LAGraph_Cached_AT (G, msg)) ;
+    #endif
 
     //--------------------------------------------------------------------------
     // check if the structure of A and AT are the same
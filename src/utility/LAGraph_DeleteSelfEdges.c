@@ -15,12 +15,26 @@
 
 //------------------------------------------------------------------------------
 
+// The diagonal entries are removed from G->A (and G->AT, if present) in
+// place, with a single GrB_select each, and the cached properties of G are
+// updated rather than deleted.  The values of G->A are never typecast, so
+// G->A may have any type, including a user-defined type.  Removing the
+// diagonal does not change the symmetry of the structure of G->A, so
+// G->is_symmetric_structure is kept, even if it is false.  G->emin and
+// G->emax become bounds, since the min or max edge may have been removed.
+
+#define LG_FREE_ALL                 \
+{                                   \
+    GrB_free (&D) ;                 \
+    GrB_free (&d) ;                 \
+}
+
 #include "LG_internal.h"
 
 int LAGraph_DeleteSelfEdges
 (
     // input/output:
-    LAGraph_Graph G,    // diagonal entries removed, most cached properties cleared
+    LAGraph_Graph G,    // diagonal entries removed, cached properties updated
     char *msg
 )
 {
@@ -29,6 +43,8 @@ int LAGraph_DeleteSelfEdges
     // clear msg and check G
     //--------------------------------------------------------------------------
 
+    GrB_Matrix D = NULL ;
+    GrB_Vector d = NULL ;
     LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
     if (G->nself_edges == 0)
     {
@@ -36,24 +52,66 @@ int LAGraph_DeleteSelfEdges
         return (GrB_SUCCESS) ;
     }
 
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    bool degrees = (G->out_degree != NULL || G->in_degree != NULL) ;
+
     //--------------------------------------------------------------------------
-    // delete all cached properties not affected by the removal of the diagonal
+    // d(i) = 1 if A(i,i) is present, if the degrees are cached
     //--------------------------------------------------------------------------
 
-    LAGraph_Boolean is_symmetric_structure = G->is_symmetric_structure ;
-    LG_TRY (LAGraph_DeleteCached (G, msg)) ;
-    G->is_symmetric_structure = is_symmetric_structure ;
+    if (degrees)
+    {
+        // D = struct (diag (A)), as the identity masked by the structure of
+        // G->A, so the values of G->A are not accessed
+        GRB_TRY (GrB_Vector_new (&d, GrB_INT64, n)) ;
+        GRB_TRY (GrB_assign (d, NULL, NULL, (int64_t) 1, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_Matrix_diag (&D, d, 0)) ;
+        GRB_TRY (GrB_assign (D, G->A, NULL, D, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_RS)) ;
+        GRB_TRY (GrB_Vector_clear (d)) ;
+        GRB_TRY (GrB_reduce (d, NULL, NULL, GrB_PLUS_MONOID_INT64, D, NULL)) ;
+    }
 
     //--------------------------------------------------------------------------
-    // remove diagonal entries
+    // remove the diagonal entries from G->A and G->AT
     //--------------------------------------------------------------------------
 
     GRB_TRY (GrB_select (G->A, NULL, NULL, GrB_OFFDIAG, G->A, 0, NULL)) ;
+    if (G->AT != NULL)
+    {
+        GRB_TRY (GrB_select (G->AT, NULL, NULL, GrB_OFFDIAG, G->AT, 0, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update the cached properties
+    //--------------------------------------------------------------------------
+
+    // a self-edge is counted once in both the out-degree and the in-degree
+    if (G->out_degree != NULL)
+    {
+        GRB_TRY (GrB_assign (G->out_degree, NULL, GrB_MINUS_INT64, d,
+            GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_select (G->out_degree, NULL, NULL, GrB_VALUENE_INT64,
+            G->out_degree, 0, NULL)) ;
+    }
+    if (G->in_degree != NULL)
+    {
+        GRB_TRY (GrB_assign (G->in_degree, NULL, GrB_MINUS_INT64, d,
+            GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_select (G->in_degree, NULL, NULL, GrB_VALUENE_INT64,
+            G->in_degree, 0, NULL)) ;
+    }
+
+    // the min or max edge may have been removed
+    if (G->emin_state == LAGraph_VALUE) G->emin_state = LAGraph_BOUND ;
+    if (G->emax_state == LAGraph_VALUE) G->emax_state = LAGraph_BOUND ;
 
     //--------------------------------------------------------------------------
     // free workspace, G->nself_edges now known to be zero
     //--------------------------------------------------------------------------
 
     G->nself_edges = 0 ;
+    LG_FREE_ALL ;
     return (GrB_SUCCESS) ;
 }
@@ -42,3 +42,13 @@ int LG_nthreads_inner ; // # of threads to use at the lower level of a nested
                         // parallel region, or to use inside GraphBLAS.
                         // Default: the value obtained by omp_get_max_threads
                         // if OpenMP is in use, or 1 otherwise.
+
+//------------------------------------------------------------------------------
+// sorting control
+//------------------------------------------------------------------------------
+
+// If true, the LG_msort* functions use a radix sort (LG_rsort) when the keys
+// fit in 64 bits.  Benchmarks may set it to false to compare with the
+// mergesort.
+
+bool LG_radix_sort = true ;
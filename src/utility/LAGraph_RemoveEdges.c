@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+// LAGraph_RemoveEdges: remove a batch of edges from a graph, updating its cache
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_RemoveEdges removes the edges in the structure of R from G->A; the
+// values of R are ignored, and entries of R that are not edges of G are
+// ignored.  If G is undirected, the edges in the structure of R' are removed
+// as well, so G->A stays symmetric.
+
+// The edges are removed one at a time with GrB_Matrix_removeElement, and the
+// cached properties of G are updated rather than deleted, with work
+// proportional to the number of entries in R (and the number of nodes, for
+// the degrees), not the number of entries in G->A:
+
+//      G->AT:          the transposed edges are removed from G->AT
+//      G->out_degree,
+//      G->in_degree:   decremented by the degrees of the removed edges
+//      G->nself_edges: decremented by the number of removed self-edges
+//      G->is_symmetric_structure: checked against the removed edges if true,
+//                      unknown otherwise (for a directed graph)
+//      G->emin,
+//      G->emax:        unchanged, but a VALUE becomes a BOUND, since the
+//                      min or max edge may have been removed.
+
+// If an error occurs after G->A has been modified, all cached properties of G
+// are deleted, so G remains valid.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&Gone) ;                              \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &J, NULL) ;             \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    if (modified)                                   \
+    {                                               \
+        LAGraph_DeleteCached (G, NULL) ;            \
+    }                                               \
+}
+
+#include "LG_internal.h"
+
+int LAGraph_RemoveEdges
+(
+    // input/output:
+    LAGraph_Graph G,        // graph to modify
+    // input:
+    const GrB_Matrix R,     // edges to remove
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix Gone = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    bool *X = NULL ;
+    bool modified = false ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+    LG_ASSERT (R != NULL, GrB_NULL_POINTER) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n, nrows, ncols ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, R)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, R)) ;
+    LG_ASSERT_MSG (nrows == n && ncols == n, GrB_DIMENSION_MISMATCH,
+        "R must have the same size as G->A") ;
+
+    //--------------------------------------------------------------------------
+    // Gone = the edges of G to remove
+    //--------------------------------------------------------------------------
+
+    // Gone = struct (R)
+    GRB_TRY (GrB_Matrix_new (&Gone, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_assign (Gone, R, NULL, (bool) true, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_S)) ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED)
+    {
+        // Gone = Gone + Gone'
+        GRB_TRY (GrB_transpose (Gone, NULL, GrB_LOR, Gone, NULL)) ;
+    }
+    // Gone<struct(A),replace> = Gone
+    GRB_TRY (GrB_assign (Gone, A, NULL, Gone, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_RS)) ;
+
+    GrB_Index ngone ;
+    GRB_TRY (GrB_Matrix_nvals (&ngone, Gone)) ;
+    if (ngone == 0)
+    {
+        // nothing to do
+        LG_FREE_WORK ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // remove the edges from A and AT
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, ngone, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, ngone, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, ngone, sizeof (bool), msg)) ;
+    GRB_TRY (GrB_Matrix_extractTuples (I, J, X, &ngone, Gone)) ;
+
+    modified = true ;
+    for (GrB_Index k = 0 ; k < ngone ; k++)
+    {
+        GRB_TRY (GrB_Matrix_removeElement (A, I [k], J [k])) ;
+    }
+    if (G->AT != NULL)
+    {
+        for (GrB_Index k = 0 ; k < ngone ; k++)
+        {
+            GRB_TRY (GrB_Matrix_removeElement (G->AT, J [k], I [k])) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // update the cached properties
+    //--------------------------------------------------------------------------
+
+    // the min or max edge may have been removed
+    if (G->emin_state == LAGraph_VALUE) G->emin_state = LAGraph_BOUND ;
+    if (G->emax_state == LAGraph_VALUE) G->emax_state = LAGraph_BOUND ;
+
+    LG_TRY (LG_update_cached (G, Gone, false, msg)) ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
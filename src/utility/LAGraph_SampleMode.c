@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// LAGraph_SampleMode: estimate the most frequent entry of a vector
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_SampleMode estimates the mode (most frequent value) of the entries
+// of a vector v, from nsamples entries picked at random (with replacement).
+// The values of v are typecast to int64_t, and entries not present in v are
+// taken as zero.  The samples are extracted in bulk with LG_sample, and their
+// mode is found with the hash table of LG_mode, which LG_CC_FastSV6 also uses
+// to find the largest connected component.
+
+#define LG_FREE_ALL LAGraph_Free ((void **) &samples, NULL) ;
+
+#include "LG_internal.h"
+
+int LAGraph_SampleMode
+(
+    // output:
+    int64_t *mode,          // sampled mode
+    int64_t *count,         // # of samples equal to the mode; may be NULL
+    // input:
+    const GrB_Vector v,     // vector to sample
+    int64_t nsamples,       // number of samples
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *samples = NULL ;
+    LG_ASSERT (mode != NULL && v != NULL, GrB_NULL_POINTER) ;
+    nsamples = LAGRAPH_MAX (nsamples, 1) ;
+
+    //--------------------------------------------------------------------------
+    // sample the vector and find the mode of the samples
+    //--------------------------------------------------------------------------
+
+    int64_t mode_count ;
+    LG_TRY (LG_sample (&samples, v, nsamples, &seed, msg)) ;
+    LG_TRY (LG_mode (mode, &mode_count, samples, nsamples, msg)) ;
+    if (count != NULL)
+    {
+        (*count) = mode_count ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
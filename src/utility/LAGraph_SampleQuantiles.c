@@ -0,0 +1,107 @@
+//------------------------------------------------------------------------------
+// LAGraph_SampleQuantiles: estimate the quantiles and mean of a vector
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_SampleQuantiles estimates the quantiles q [0..nq-1] and the mean of
+// the entries of a vector v of size n, from nsamples entries picked at random
+// (with replacement).  The values of v are typecast to int64_t, and entries
+// not present in v are taken as zero (so a degree vector with no explicit
+// zeros is sampled correctly).  The samples are extracted in bulk with
+// LG_sample, sorted in parallel with LG_msort1, and their mean is computed
+// with a parallel reduction.  The estimate of the q-th quantile is the sample
+// of rank floor (q * nsamples) in the sorted samples, so q = 0.5 gives the
+// sampled median, q = 0 the smallest sample, and q = 1 the largest.
+
+#define LG_FREE_ALL LAGraph_Free ((void **) &samples, NULL) ;
+
+#include "LG_internal.h"
+
+int LAGraph_SampleQuantiles
+(
+    // output:
+    double *quantiles,      // array of size nq; may be NULL if nq is zero
+    double *sample_mean,    // sampled mean; may be NULL if not needed
+    // input:
+    const GrB_Vector v,     // vector to sample
+    const double *q,        // array of size nq, each in the range [0,1]
+    int64_t nq,             // number of quantiles to estimate
+    int64_t nsamples,       // number of samples
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *samples = NULL ;
+    LG_ASSERT (v != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (nq <= 0 || (quantiles != NULL && q != NULL), GrB_NULL_POINTER) ;
+    for (int64_t k = 0 ; k < nq ; k++)
+    {
+        LG_ASSERT_MSG (q [k] >= 0 && q [k] <= 1, GrB_INVALID_VALUE,
+            "quantiles must be in the range [0,1]") ;
+    }
+    nsamples = LAGRAPH_MAX (nsamples, 1) ;
+
+    //--------------------------------------------------------------------------
+    // sample the vector
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_sample (&samples, v, nsamples, &seed, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // find the mean
+    //--------------------------------------------------------------------------
+
+    if (sample_mean != NULL)
+    {
+        int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+        nthreads = LAGRAPH_MIN (nthreads, nsamples / 4096) ;
+        nthreads = LAGRAPH_MAX (nthreads, 1) ;
+        int64_t dsum = 0 ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:dsum)
+        for (k = 0 ; k < nsamples ; k++)
+        {
+            dsum += samples [k] ;
+        }
+        (*sample_mean) = ((double) dsum) / nsamples ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the quantiles
+    //--------------------------------------------------------------------------
+
+    if (nq > 0)
+    {
+        LG_TRY (LG_msort1 (samples, nsamples, msg)) ;
+        for (int64_t k = 0 ; k < nq ; k++)
+        {
+            int64_t rank = (int64_t) (q [k] * nsamples) ;
+            rank = LAGRAPH_MIN (rank, nsamples - 1) ;
+            quantiles [k] = (double) samples [rank] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,356 @@
+//------------------------------------------------------------------------------
+// LAGraph_Workspace: a reusable pool of workspace memory
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// An LAGraph_Workspace holds blocks of memory freed by LG_Workspace_Free, in
+// free lists by size class, so that the next LG_Workspace_Malloc of a similar
+// size reuses a block instead of calling malloc.  An application that makes
+// many calls to LAGraph on the same thread (a server answering queries, for
+// example) attaches one workspace to each of its threads, with
+// LAGraph_Workspace_Attach.  The workspace then persists across calls, and
+// the large workspace arrays of the sorting methods, LAGr_SortByDegree, and
+// the connected components method are recycled instead of being returned to
+// the operating system after each call.
+
+// The attached workspace is held in a thread-local variable, so each thread
+// has its own pools and no locking is needed.  A workspace must be attached
+// to at most one thread at a time.  If no workspace is attached to the
+// calling thread, LG_Workspace_Malloc and LG_Workspace_Free fall back on
+// LAGraph_Malloc and LAGraph_Free.
+
+// Each block has a 64-byte header that records its size class and the
+// workspace that owns it.  There are 4 size classes for each power of 2, so
+// a block is at most 25% larger than the request.  Blocks allocated by
+// LG_Workspace_Malloc are only for internal workspace: they must be freed by
+// LG_Workspace_Free, and must never be passed to LAGraph_Free or handed to
+// GraphBLAS (with GxB_*_pack, for example).
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+
+//------------------------------------------------------------------------------
+// the workspace and the header of each block
+//------------------------------------------------------------------------------
+
+#define LG_WS_MAGIC 0x4C4757534B535031ULL
+#define LG_WS_HEADER 64
+#define LG_WS_MAXSIZE (((size_t) 1) << 56)
+#define LG_WS_NCLASSES 201
+
+typedef union
+{
+    struct
+    {
+        LAGraph_Workspace owner ;   // workspace that owns the block, or NULL
+        void *next ;                // next free block of the same size class
+        size_t csize ;              // size of the block, excluding the header
+        int64_t kclass ;            // size class of the block
+        uint64_t magic ;
+    }
+    h ;
+    uint8_t pad [LG_WS_HEADER] ;
+}
+LG_ws_header ;
+
+struct LAGraph_Workspace_struct
+{
+    uint64_t magic ;
+    LG_ws_header *pool [LG_WS_NCLASSES] ;   // free lists, one per size class
+    size_t inuse ;              // bytes in blocks in use
+    size_t high_water ;         // largest value of inuse
+    size_t cached ;             // bytes in blocks in the free lists
+} ;
+
+// the workspace attached to the calling thread, if any
+#if defined ( _MSC_VER ) && !defined ( __INTEL_COMPILER )
+static __declspec ( thread ) LAGraph_Workspace LG_ws_current = NULL ;
+#else
+static _Thread_local LAGraph_Workspace LG_ws_current = NULL ;
+#endif
+
+//------------------------------------------------------------------------------
+// LG_ws_class: determine the size class of a request
+//------------------------------------------------------------------------------
+
+// Class 0 holds blocks of 64 bytes.  A request of size s > 64 is rounded up
+// to (5+sub) * 2^(e-2), where 2^e <= s-1 < 2^(e+1) and sub (0 to 3) is given
+// by the two bits of s-1 after its leading bit.  The largest class holds
+// blocks of LG_WS_MAXSIZE bytes; larger requests are not pooled.
+
+static int64_t LG_ws_class (size_t size, size_t *csize)
+{
+    if (size <= 64)
+    {
+        (*csize) = 64 ;
+        return (0) ;
+    }
+    size_t s = size - 1 ;
+    int e = 6 ;
+    while ((s >> (e+1)) != 0) e++ ;
+    int sub = (int) ((s >> (e-2)) & 3) ;
+    (*csize) = ((size_t) (5 + sub)) << (e-2) ;
+    return (1 + 4 * (e-6) + sub) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Workspace_Malloc: allocate a block of workspace
+//------------------------------------------------------------------------------
+
+int LG_Workspace_Malloc
+(
+    // output:
+    void **p,               // pointer to allocated block of memory
+    // input:
+    size_t nitems,          // number of items
+    size_t size_of_item,    // size of each item
+    char *msg
+)
+{
+    // check inputs
+    LG_CLEAR_MSG ;
+    LG_ASSERT (p != NULL, GrB_NULL_POINTER) ;
+    (*p) = NULL ;
+
+    // compute the size and check for integer overflow
+    nitems = LAGRAPH_MAX (1, nitems) ;
+    size_of_item = LAGRAPH_MAX (1, size_of_item) ;
+    size_t size ;
+    bool ok = LG_Multiply_size_t (&size, nitems, size_of_item) ;
+    if (!ok || nitems > GrB_INDEX_MAX || size_of_item > GrB_INDEX_MAX)
+    {
+        // overflow
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // find the size class of the block, if a workspace is attached
+    LAGraph_Workspace ws = (size <= LG_WS_MAXSIZE) ? LG_ws_current : NULL ;
+    int64_t k = -1 ;
+    size_t csize = size ;
+    if (ws != NULL)
+    {
+        k = LG_ws_class (size, &csize) ;
+    }
+
+    LG_ws_header *b = NULL ;
+    if (ws != NULL && ws->pool [k] != NULL)
+    {
+        // reuse a block from the pool
+        b = ws->pool [k] ;
+        ws->pool [k] = b->h.next ;
+        ws->cached -= csize ;
+    }
+    else
+    {
+        // allocate a new block
+        if (csize > SIZE_MAX - LG_WS_HEADER) return (GrB_OUT_OF_MEMORY) ;
+        LG_TRY (LAGraph_Malloc ((void **) &b, csize + LG_WS_HEADER,
+            sizeof (uint8_t), msg)) ;
+        b->h.owner = ws ;
+        b->h.csize = csize ;
+        b->h.kclass = k ;
+        b->h.magic = LG_WS_MAGIC ;
+    }
+    b->h.next = NULL ;
+
+    if (ws != NULL)
+    {
+        ws->inuse += csize ;
+        ws->high_water = LAGRAPH_MAX (ws->high_water, ws->inuse) ;
+    }
+    (*p) = ((uint8_t *) b) + LG_WS_HEADER ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Workspace_Calloc: allocate a block of workspace and set it to zero
+//------------------------------------------------------------------------------
+
+int LG_Workspace_Calloc
+(
+    // output:
+    void **p,               // pointer to allocated block of memory
+    // input:
+    size_t nitems,          // number of items
+    size_t size_of_item,    // size of each item
+    char *msg
+)
+{
+    LG_TRY (LG_Workspace_Malloc (p, nitems, size_of_item, msg)) ;
+    // the size cannot overflow, since LG_Workspace_Malloc succeeded
+    memset (*p, 0, LAGRAPH_MAX (1, nitems) * LAGRAPH_MAX (1, size_of_item)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Workspace_Free: free a block of workspace
+//------------------------------------------------------------------------------
+
+// The block is returned to the pool of the workspace that allocated it, or
+// freed by LAGraph_Free if it was allocated with no workspace attached.  Does
+// nothing if p or *p are NULL.
+
+int LG_Workspace_Free
+(
+    // input/output:
+    void **p,               // pointer to block to free; set to NULL on output
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (p == NULL || (*p) == NULL) return (GrB_SUCCESS) ;
+
+    LG_ws_header *b = (LG_ws_header *) (((uint8_t *) (*p)) - LG_WS_HEADER) ;
+    ASSERT (b->h.magic == LG_WS_MAGIC) ;
+    LAGraph_Workspace ws = b->h.owner ;
+    if (ws == NULL)
+    {
+        LAGraph_Free ((void **) &b, NULL) ;
+    }
+    else
+    {
+        int64_t k = b->h.kclass ;
+        b->h.next = ws->pool [k] ;
+        ws->pool [k] = b ;
+        ws->inuse -= b->h.csize ;
+        ws->cached += b->h.csize ;
+    }
+    (*p) = NULL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Workspace_New: create a workspace
+//------------------------------------------------------------------------------
+
+int LAGraph_Workspace_New
+(
+    // output:
+    LAGraph_Workspace *ws,  // the new workspace, with empty pools
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (ws != NULL, GrB_NULL_POINTER) ;
+    (*ws) = NULL ;
+    LG_TRY (LAGraph_Calloc ((void **) ws, 1,
+        sizeof (struct LAGraph_Workspace_struct), msg)) ;
+    (*ws)->magic = LG_WS_MAGIC ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Workspace_Release: free all blocks held in the pools
+//------------------------------------------------------------------------------
+
+// The blocks in the pools are freed, and the high-water mark is reset to the
+// number of bytes currently in use.  Blocks in use are not affected.
+
+int LAGraph_Workspace_Release
+(
+    // input/output:
+    LAGraph_Workspace ws,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (ws != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (ws->magic == LG_WS_MAGIC, GrB_INVALID_OBJECT,
+        "invalid workspace") ;
+    for (int k = 0 ; k < LG_WS_NCLASSES ; k++)
+    {
+        while (ws->pool [k] != NULL)
+        {
+            LG_ws_header *b = ws->pool [k] ;
+            ws->pool [k] = b->h.next ;
+            LAGraph_Free ((void **) &b, NULL) ;
+        }
+    }
+    ws->cached = 0 ;
+    ws->high_water = ws->inuse ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Workspace_Delete: free a workspace
+//------------------------------------------------------------------------------
+
+// All blocks allocated from the workspace must have been freed.  If the
+// workspace is attached to the calling thread, it is detached.  Does nothing
+// if ws or *ws are NULL.
+
+int LAGraph_Workspace_Delete
+(
+    // input/output:
+    LAGraph_Workspace *ws,  // workspace to free; set to NULL on output
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (ws == NULL || (*ws) == NULL) return (GrB_SUCCESS) ;
+    LG_ASSERT_MSG ((*ws)->inuse == 0, GrB_INVALID_VALUE,
+        "workspace is still in use") ;
+    LG_TRY (LAGraph_Workspace_Release (*ws, msg)) ;
+    if (LG_ws_current == (*ws)) LG_ws_current = NULL ;
+    (*ws)->magic = 0 ;
+    LAGraph_Free ((void **) ws, NULL) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Workspace_Attach: attach a workspace to the calling thread
+//------------------------------------------------------------------------------
+
+// Subsequent calls to LAGraph from the calling thread take their workspace
+// from ws.  If ws is NULL, the current workspace (if any) is detached and
+// LAGraph returns to using LAGraph_Malloc and LAGraph_Free directly.
+
+int LAGraph_Workspace_Attach
+(
+    // input:
+    LAGraph_Workspace ws,   // workspace to attach, or NULL to detach
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT_MSG (ws == NULL || ws->magic == LG_WS_MAGIC,
+        GrB_INVALID_OBJECT, "invalid workspace") ;
+    LG_ws_current = ws ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Workspace_Stats: report the memory usage of a workspace
+//------------------------------------------------------------------------------
+
+int LAGraph_Workspace_Stats
+(
+    // output:
+    size_t *inuse,          // bytes in blocks in use; may be NULL
+    size_t *high_water,     // high-water mark of inuse; may be NULL
+    size_t *cached,         // bytes held in the pools for reuse; may be NULL
+    // input:
+    const LAGraph_Workspace ws,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (ws != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (ws->magic == LG_WS_MAGIC, GrB_INVALID_OBJECT,
+        "invalid workspace") ;
+    if (inuse != NULL) (*inuse) = ws->inuse ;
+    if (high_water != NULL) (*high_water) = ws->high_water ;
+    if (cached != NULL) (*cached) = ws->cached ;
+    return (GrB_SUCCESS) ;
+}
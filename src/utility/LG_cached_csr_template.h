@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+// LG_cached_csr_template: one sweep over the rows of a CSR matrix
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This file is #include'd in LAGraph_Cached_All.c to create a version of
+// LG_cached_csr for each built-in type.  The #include'ing file defines
+// LG_cached_csr (the name of the function), LG_ctype (the C type of the
+// entries), and LG_CTYPE_MIN and LG_CTYPE_MAX (the range of LG_ctype).
+
+// LG_cached_csr computes the row degrees, the number of diagonal entries, and
+// the smallest and largest entries of a matrix held in CSR form, in a single
+// parallel pass over its rows.  Outputs that are NULL are not computed, and
+// Ax is not accessed if emin and emax are both NULL.  No GraphBLAS method is
+// used, so the matrix may be unpacked while this function is called.
+
+static void LG_cached_csr
+(
+    // output:
+    int64_t *LG_RESTRICT degree,    // row degrees, size nrows, or NULL
+    int64_t *nself_edges,           // # of diagonal entries, or NULL
+    LG_ctype *emin,                 // smallest entry, or NULL
+    LG_ctype *emax,                 // largest entry, or NULL
+    // input:
+    const GrB_Index *LG_RESTRICT Ap,
+    const GrB_Index *LG_RESTRICT Aj,
+    const void *Ax_input,
+    const bool iso,
+    const int64_t nrows,
+    const int nthreads
+)
+{
+    const LG_ctype *LG_RESTRICT Ax = (const LG_ctype *) Ax_input ;
+    bool want_diag = (nself_edges != NULL) ;
+    bool want_values = (emin != NULL || emax != NULL) && !iso ;
+    int64_t ndiag = 0 ;
+    LG_ctype amin = LG_CTYPE_MAX, amax = LG_CTYPE_MIN ;
+
+    #pragma omp parallel num_threads(nthreads)
+    {
+        int64_t my_ndiag = 0 ;
+        LG_ctype my_amin = LG_CTYPE_MAX, my_amax = LG_CTYPE_MIN ;
+        int64_t i ;
+        #pragma omp for schedule(static)
+        for (i = 0 ; i < nrows ; i++)
+        {
+            GrB_Index pstart = Ap [i], pend = Ap [i+1] ;
+            if (degree != NULL)
+            {
+                degree [i] = (int64_t) (pend - pstart) ;
+            }
+            if (!(want_diag || want_values)) continue ;
+            for (GrB_Index p = pstart ; p < pend ; p++)
+            {
+                if (Aj [p] == (GrB_Index) i)
+                {
+                    my_ndiag++ ;
+                }
+                if (want_values)
+                {
+                    LG_ctype a = Ax [p] ;
+                    if (a < my_amin) my_amin = a ;
+                    if (a > my_amax) my_amax = a ;
+                }
+            }
+        }
+        #pragma omp critical
+        {
+            ndiag += my_ndiag ;
+            if (my_amin < amin) amin = my_amin ;
+            if (my_amax > amax) amax = my_amax ;
+        }
+    }
+
+    if (iso && Ap [nrows] > 0)
+    {
+        // all entries are equal to Ax [0]
+        amin = Ax [0] ;
+        amax = Ax [0] ;
+    }
+    if (nself_edges != NULL) (*nself_edges) = ndiag ;
+    if (emin != NULL) (*emin) = amin ;
+    if (emax != NULL) (*emax) = amax ;
+}
+
+#undef LG_cached_csr
+#undef LG_ctype
+#undef LG_CTYPE_MIN
+#undef LG_CTYPE_MAX
@@ -404,6 +404,34 @@ static inline void LG_eslice
 
 #define LG_BASECASE (64 * 1024)
 
+// If true (the default), the LG_msort* functions use LG_rsort for problems
+// larger than LG_BASECASE, if their keys fit in 64 bits.
+LAGRAPH_PUBLIC
+bool LG_radix_sort ;
+
+//------------------------------------------------------------------------------
+// LG_rsort: radix sort of 1, 2, or 3 arrays of size n
+//------------------------------------------------------------------------------
+
+// LG_rsort sorts the arrays in the same order as LG_msort1, LG_msort2, or
+// LG_msort3, with A_1 and/or A_2 NULL for a single array or a pair of arrays.
+// It uses a parallel LSD radix sort, if the ranges of all arrays fit together
+// in a single 64-bit key.  Otherwise, the arrays are not modified and
+// (*sorted) is returned as false.
+
+int LG_rsort
+(
+    // input/output:
+    int64_t *A_0,       // size n array
+    int64_t *A_1,       // size n array, or NULL
+    int64_t *A_2,       // size n array, or NULL (NULL if A_1 is NULL)
+    // output:
+    bool *sorted,       // true if sorted, false if the keys do not fit
+    // input:
+    const int64_t n,
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LG_msort1: sort array of size n
 //------------------------------------------------------------------------------
@@ -584,6 +612,111 @@ int LG_nself_edges
     char *msg               // error message
 ) ;
 
+//------------------------------------------------------------------------------
+// update the cached properties of a graph after an edit of G->A
+//------------------------------------------------------------------------------
+
+// LG_update_cached updates G->out_degree, G->in_degree, G->nself_edges, and
+// G->is_symmetric_structure, for LAGraph_AddEdges and LAGraph_RemoveEdges.
+
+int LG_update_cached
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose G->A has been edited
+    // input:
+    const GrB_Matrix Delta, // entries added to or removed from G->A
+    bool added,             // if true, Delta was added, else removed
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LG_minmax_monoids: find the min and max monoids for a built-in type
+//------------------------------------------------------------------------------
+
+// LG_minmax_monoids returns the monoids used to compute G->emin and G->emax
+// (LAND and LOR for GrB_BOOL), or GrB_NOT_IMPLEMENTED for other types.
+
+int LG_minmax_monoids
+(
+    // output:
+    GrB_Monoid *min_monoid,     // monoid to compute the min entry
+    GrB_Monoid *max_monoid,     // monoid to compute the max entry
+    // input:
+    const GrB_Type type,        // type of the matrix
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LG_sample: extract a random sample of the entries of a vector
+//------------------------------------------------------------------------------
+
+// LG_sample returns samples [k] = v (i) for nsamples indices i picked at
+// random, extracted with a single GrB_extract.  Entries not in v are zero.
+
+int LG_sample
+(
+    // output:
+    int64_t **samples,      // array of size nsamples
+    // input:
+    const GrB_Vector v,     // vector to sample
+    int64_t nsamples,       // number of samples, at least 1
+    uint64_t *seed,         // random number seed, modified on output
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LG_mode: find the most frequent entry in an array
+//------------------------------------------------------------------------------
+
+int LG_mode
+(
+    // output:
+    int64_t *mode,          // most frequent entry in X
+    int64_t *count,         // # of times it appears in X
+    // input:
+    const int64_t *X,       // array of size n
+    int64_t n,              // size of X, at least 1
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LG_Workspace_*: workspace from the pools of an LAGraph_Workspace
+//------------------------------------------------------------------------------
+
+// These are drop-in replacements for LAGraph_Malloc, LAGraph_Calloc, and
+// LAGraph_Free, for internal workspace only.  If an LAGraph_Workspace is
+// attached to the calling thread, the blocks are drawn from and returned to
+// its pools.  A block from LG_Workspace_Malloc or LG_Workspace_Calloc must be
+// freed by LG_Workspace_Free, and must never be returned to the user,
+// passed to LAGraph_Free, or packed into a GraphBLAS matrix or vector.
+
+int LG_Workspace_Malloc
+(
+    // output:
+    void **p,               // pointer to allocated block of memory
+    // input:
+    size_t nitems,          // number of items
+    size_t size_of_item,    // size of each item
+    char *msg
+) ;
+
+int LG_Workspace_Calloc
+(
+    // output:
+    void **p,               // pointer to allocated block of memory
+    // input:
+    size_t nitems,          // number of items
+    size_t size_of_item,    // size of each item
+    char *msg
+) ;
+
+int LG_Workspace_Free
+(
+    // input/output:
+    void **p,               // pointer to block to free; set to NULL on output
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // simple and portable random number generator (internal use only)
 //------------------------------------------------------------------------------
@@ -597,6 +730,31 @@ GrB_Index LG_Random15 (uint64_t *seed) ;
 // return a random uint64_t, in range 0 to LG_RANDOM60_MAX
 GrB_Index LG_Random60 (uint64_t *seed) ;
 
+//------------------------------------------------------------------------------
+// counter-based random number generator (internal use only)
+//------------------------------------------------------------------------------
+
+// LG_rand_mix is the 64-bit finalizer of SplitMix64 (Steele, Lea, and Flood,
+// "Fast splittable pseudorandom number generators", OOPSLA 2014), a bijection
+// on uint64_t with good avalanche in all 64 bits.  LG_rand_counter (key,c)
+// is the c-th output of the SplitMix64 sequence for a given key: it depends
+// only on key and c, so any entry of a random vector or matrix can be
+// computed independently of all others, in any order and by any thread.
+
+#define LG_RAND_GAMMA 0x9E3779B97F4A7C15ULL
+
+static inline uint64_t LG_rand_mix (uint64_t z)
+{
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL ;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL ;
+    return (z ^ (z >> 31)) ;
+}
+
+static inline uint64_t LG_rand_counter (uint64_t key, uint64_t c)
+{
+    return (LG_rand_mix (key + (c + 1) * LG_RAND_GAMMA)) ;
+}
+
 //------------------------------------------------------------------------------
 // LG_KindName: return the name of a kind
 //------------------------------------------------------------------------------
@@ -0,0 +1,100 @@
+//------------------------------------------------------------------------------
+// LG_minmax_monoids: find the min and max monoids for a built-in type
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_minmax_monoids returns the monoids that compute G->emin and G->emax for
+// a matrix of the given type: the MIN and MAX monoids, or LAND and LOR for
+// GrB_BOOL.  G->emin and G->emax exist only for built-in types, so
+// GrB_NOT_IMPLEMENTED is returned for any other type.
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+
+int LG_minmax_monoids
+(
+    // output:
+    GrB_Monoid *min_monoid,     // monoid to compute the min entry
+    GrB_Monoid *max_monoid,     // monoid to compute the max entry
+    // input:
+    const GrB_Type type,        // type of the matrix
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (min_monoid != NULL && max_monoid != NULL, GrB_NULL_POINTER) ;
+    (*min_monoid) = NULL ;
+    (*max_monoid) = NULL ;
+
+    if (type == GrB_BOOL)
+    {
+        (*min_monoid) = GrB_LAND_MONOID_BOOL ;
+        (*max_monoid) = GrB_LOR_MONOID_BOOL ;
+    }
+    else if (type == GrB_INT8)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_INT8 ;
+        (*max_monoid) = GrB_MAX_MONOID_INT8 ;
+    }
+    else if (type == GrB_INT16)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_INT16 ;
+        (*max_monoid) = GrB_MAX_MONOID_INT16 ;
+    }
+    else if (type == GrB_INT32)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_INT32 ;
+        (*max_monoid) = GrB_MAX_MONOID_INT32 ;
+    }
+    else if (type == GrB_INT64)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_INT64 ;
+        (*max_monoid) = GrB_MAX_MONOID_INT64 ;
+    }
+    else if (type == GrB_UINT8)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_UINT8 ;
+        (*max_monoid) = GrB_MAX_MONOID_UINT8 ;
+    }
+    else if (type == GrB_UINT16)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_UINT16 ;
+        (*max_monoid) = GrB_MAX_MONOID_UINT16 ;
+    }
+    else if (type == GrB_UINT32)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_UINT32 ;
+        (*max_monoid) = GrB_MAX_MONOID_UINT32 ;
+    }
+    else if (type == GrB_UINT64)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_UINT64 ;
+        (*max_monoid) = GrB_MAX_MONOID_UINT64 ;
+    }
+    else if (type == GrB_FP32)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_FP32 ;
+        (*max_monoid) = GrB_MAX_MONOID_FP32 ;
+    }
+    else if (type == GrB_FP64)
+    {
+        (*min_monoid) = GrB_MIN_MONOID_FP64 ;
+        (*max_monoid) = GrB_MAX_MONOID_FP64 ;
+    }
+    else
+    {
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,100 @@
+//------------------------------------------------------------------------------
+// LG_mode: find the most frequent entry in an array, with a hash table
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_mode returns the most frequent entry in X [0..n-1], and the number of
+// times it appears.  If more than one entry has the largest count, the first
+// one to reach that count (scanning X in order) is returned.  The entries of
+// X are inserted into an open-addressing hash table with a power-of-2 size of
+// at least 9n/8, so the work is O(n) with no sort.  This was the mode
+// estimator of LG_CC_FastSV6, which applies it to a random sample of its
+// parent vector; see also LAGraph_SampleMode.
+
+#define LG_FREE_ALL                                     \
+{                                                       \
+    LG_Workspace_Free ((void **) &ht_key, NULL) ;       \
+    LG_Workspace_Free ((void **) &ht_count, NULL) ;     \
+}
+
+#include "LG_internal.h"
+
+#define LG_HASH(x) ((((x) << 4) + (x)) & hash_mask)
+#define LG_NEXT(h) (((h) + 23) & hash_mask)
+
+int LG_mode
+(
+    // output:
+    int64_t *mode,          // most frequent entry in X
+    int64_t *count,         // # of times it appears in X
+    // input:
+    const int64_t *X,       // array of size n
+    int64_t n,              // size of X, at least 1
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    uint64_t *ht_key = NULL ;
+    int64_t *ht_count = NULL ;
+    LG_ASSERT (mode != NULL && count != NULL && X != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (n > 0, GrB_INVALID_VALUE, "n must be > 0") ;
+
+    //--------------------------------------------------------------------------
+    // allocate the hash table
+    //--------------------------------------------------------------------------
+
+    // the hash table size must be a power of 2
+    uint64_t hash_size = 16 ;
+    while (hash_size < (uint64_t) (n + n/8)) hash_size *= 2 ;
+    uint64_t hash_mask = hash_size - 1 ;
+    LG_TRY (LG_Workspace_Malloc ((void **) &ht_key, hash_size,
+        sizeof (uint64_t), msg)) ;
+    LG_TRY (LG_Workspace_Calloc ((void **) &ht_count, hash_size,
+        sizeof (int64_t), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // hash the entries and find the most frequent one
+    //--------------------------------------------------------------------------
+
+    int64_t key = X [0] ;       // most frequent entry
+    int64_t max_count = 0 ;     // frequency of most frequent entry
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        // find x in the hash table; an empty slot has a zero count
+        uint64_t x = (uint64_t) X [k] ;
+        uint64_t h = LG_HASH (x) ;
+        while (ht_count [h] != 0 && ht_key [h] != x) h = LG_NEXT (h) ;
+        // add x to the hash table
+        ht_key [h] = x ;
+        ht_count [h]++ ;
+        // keep track of the most frequent value
+        if (ht_count [h] > max_count)
+        {
+            key = X [k] ;
+            max_count = ht_count [h] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    (*mode) = key ;
+    (*count) = max_count ;
+    return (GrB_SUCCESS) ;
+}
@@ -18,7 +18,10 @@
 // A parallel mergesort of an array of 3-by-n integers.  Each key
 // consists of three integers.
 
-#define LG_FREE_ALL LAGraph_Free ((void **) &W, NULL) ;
+// If n > LG_BASECASE and LG_radix_sort is true, a parallel radix sort is used
+// instead (see LG_rsort), if the keys fit together in 64 bits.
+
+#define LG_FREE_ALL LG_Workspace_Free ((void **) &W, NULL) ;
 
 #include "LG_internal.h"
 
@@ -370,7 +373,25 @@ int LG_msort3
     //--------------------------------------------------------------------------
 
     int nthreads = LG_nthreads_outer * LG_nthreads_inner ; // # threads to use
-    if (nthreads <= 1 || n <= LG_BASECASE)
+    if (n <= LG_BASECASE)
+    {
+        // sequential quicksort
+        LG_qsort_3 (A_0, A_1, A_2, n) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // use a radix sort if the keys fit in 64 bits
+    //--------------------------------------------------------------------------
+
+    if (LG_radix_sort)
+    {
+        bool sorted ;
+        LG_TRY (LG_rsort (A_0, A_1, A_2, &sorted, n, msg)) ;
+        if (sorted) return (GrB_SUCCESS) ;
+    }
+
+    if (nthreads <= 1)
     {
         // sequential quicksort
         LG_qsort_3 (A_0, A_1, A_2, n) ;
@@ -399,8 +420,8 @@ int LG_msort3
     // allocate workspace
     //--------------------------------------------------------------------------
 
-    LG_TRY (LAGraph_Malloc ((void **) &W, 3*n + 6*ntasks + 1, sizeof (int64_t),
-        msg)) ;
+    LG_TRY (LG_Workspace_Malloc ((void **) &W, 3*n + 6*ntasks + 1,
+        sizeof (int64_t), msg)) ;
 
     int64_t *T = W ;
     int64_t *LG_RESTRICT W_0    = T ; T += n ;
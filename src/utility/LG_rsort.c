@@ -0,0 +1,285 @@
+//------------------------------------------------------------------------------
+// LG_rsort: parallel radix sort of 1, 2, or 3 int64_t arrays
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_rsort sorts the tuples (A_0 [k], A_1 [k], A_2 [k]) in ascending order,
+// in the same order as LG_msort3 (A_1 and A_2 may be NULL, for LG_msort1 and
+// LG_msort2).  It is used by the LG_msort* functions when the keys have a
+// small range, which is common: node ids are in the range 0 to n-1, and
+// degrees are in the range 0 to the max degree.
+
+// The range of each array is found first.  If the offsets A_t [k] - min (A_t)
+// of all arrays fit together in a single 64-bit key, each tuple is packed into
+// one key, the keys are sorted with a parallel LSD radix sort, and the tuples
+// are unpacked from the sorted keys.  Otherwise, the arrays are not modified
+// and (*sorted) is returned as false, and the caller must sort them itself.
+
+// Each pass of the radix sort handles up to 11 bits of the key: each thread
+// counts the digits in its slice of the keys, a cumulative sum over all
+// digits and threads gives the position of each thread in each bucket, and
+// then each thread scatters its keys.  The passes are stable, so the sort is
+// O(n*b/11) for a key of b bits, rather than O(n log n).  Passes where all
+// keys have the same digit are skipped.
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_Workspace_Free ((void **) &K, NULL) ;        \
+    LG_Workspace_Free ((void **) &Count, NULL) ;    \
+}
+
+#include "LG_internal.h"
+
+// maximum number of bits in each digit
+#define LG_RADIX_BITS 11
+
+// x << b and x >> b, for b in the range 0 to 64
+#define LG_SHL(x,b) (((b) >= 64) ? 0 : ((x) << (b)))
+#define LG_SHR(x,b) (((b) >= 64) ? 0 : ((x) >> (b)))
+
+// a mask of the low b bits, for b in the range 0 to 64
+#define LG_MASK(b) (((b) >= 64) ? UINT64_MAX : ((((uint64_t) 1) << (b)) - 1))
+
+//------------------------------------------------------------------------------
+// LG_range: find the min value of an array, and the # of bits of its range
+//------------------------------------------------------------------------------
+
+static void LG_range
+(
+    // output:
+    int64_t *amin,              // min (A)
+    int *bits,                  // # of bits in max (A) - min (A)
+    // input:
+    const int64_t *LG_RESTRICT A,
+    const int64_t n,
+    int64_t *LG_RESTRICT Work,  // workspace of size 2*nthreads
+    int nthreads
+)
+{
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t kfirst = LG_PART (tid, n, nthreads) ;
+        int64_t klast  = LG_PART (tid+1, n, nthreads) ;
+        int64_t lo = INT64_MAX, hi = INT64_MIN ;
+        for (int64_t k = kfirst ; k < klast ; k++)
+        {
+            lo = LAGRAPH_MIN (lo, A [k]) ;
+            hi = LAGRAPH_MAX (hi, A [k]) ;
+        }
+        Work [2*tid  ] = lo ;
+        Work [2*tid+1] = hi ;
+    }
+    int64_t lo = INT64_MAX, hi = INT64_MIN ;
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        lo = LAGRAPH_MIN (lo, Work [2*tid  ]) ;
+        hi = LAGRAPH_MAX (hi, Work [2*tid+1]) ;
+    }
+    // the range is computed without signed overflow
+    uint64_t range = ((uint64_t) hi) - ((uint64_t) lo) ;
+    int b = 0 ;
+    while (range != 0)
+    {
+        b++ ;
+        range >>= 1 ;
+    }
+    (*amin) = lo ;
+    (*bits) = b ;
+}
+
+//------------------------------------------------------------------------------
+// LG_rsort
+//------------------------------------------------------------------------------
+
+int LG_rsort
+(
+    // input/output:
+    int64_t *A_0,       // size n array
+    int64_t *A_1,       // size n array, or NULL
+    int64_t *A_2,       // size n array, or NULL (NULL if A_1 is NULL)
+    // output:
+    bool *sorted,       // true if sorted, false if the keys do not fit
+    // input:
+    const int64_t n,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    uint64_t *K = NULL ;
+    int64_t *Count = NULL ;
+    LG_ASSERT (A_0 != NULL && sorted != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (A_1 != NULL || A_2 == NULL, GrB_NULL_POINTER) ;
+    (*sorted) = false ;
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 4096) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // find the range of each array
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_Workspace_Malloc ((void **) &Count, 2*nthreads,
+        sizeof (int64_t), msg)) ;
+    int64_t min0 = 0, min1 = 0, min2 = 0 ;
+    int b0 = 0, b1 = 0, b2 = 0 ;
+    LG_range (&min0, &b0, A_0, n, Count, nthreads) ;
+    if (A_1 != NULL) LG_range (&min1, &b1, A_1, n, Count, nthreads) ;
+    if (A_2 != NULL) LG_range (&min2, &b2, A_2, n, Count, nthreads) ;
+    LG_Workspace_Free ((void **) &Count, NULL) ;
+
+    int nbits = b0 + b1 + b2 ;
+    if (nbits > 64)
+    {
+        // the tuples do not fit in a single 64-bit key
+        return (GrB_SUCCESS) ;
+    }
+    if (nbits == 0)
+    {
+        // all tuples are identical
+        (*sorted) = true ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int npasses = (nbits + LG_RADIX_BITS - 1) / LG_RADIX_BITS ;
+    int dbits = (nbits + npasses - 1) / npasses ;
+    int64_t nbuckets = ((int64_t) 1) << dbits ;
+    LG_TRY (LG_Workspace_Malloc ((void **) &K, 2*n, sizeof (uint64_t), msg)) ;
+    LG_TRY (LG_Workspace_Malloc ((void **) &Count, nthreads * nbuckets,
+        sizeof (int64_t), msg)) ;
+    uint64_t *LG_RESTRICT Key = K ;
+    uint64_t *LG_RESTRICT W = K + n ;
+
+    //--------------------------------------------------------------------------
+    // pack each tuple into a single key
+    //--------------------------------------------------------------------------
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        uint64_t key = ((uint64_t) A_0 [k]) - ((uint64_t) min0) ;
+        if (A_1 != NULL)
+        {
+            key = LG_SHL (key, b1) | (((uint64_t) A_1 [k]) - ((uint64_t) min1));
+        }
+        if (A_2 != NULL)
+        {
+            key = LG_SHL (key, b2) | (((uint64_t) A_2 [k]) - ((uint64_t) min2));
+        }
+        Key [k] = key ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the keys, one digit at a time
+    //--------------------------------------------------------------------------
+
+    for (int pass = 0 ; pass < npasses ; pass++)
+    {
+        int shift = pass * dbits ;
+        const uint64_t dmask = nbuckets - 1 ;
+
+        // Count [tid*nbuckets + d] = # of keys with digit d in slice tid
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t *LG_RESTRICT C = Count + tid * nbuckets ;
+            memset (C, 0, nbuckets * sizeof (int64_t)) ;
+            int64_t kfirst = LG_PART (tid, n, nthreads) ;
+            int64_t klast  = LG_PART (tid+1, n, nthreads) ;
+            for (int64_t k = kfirst ; k < klast ; k++)
+            {
+                C [(Key [k] >> shift) & dmask]++ ;
+            }
+        }
+
+        // cumulative sum, by digit and then by slice
+        int64_t s = 0 ;
+        bool skip = false ;
+        for (int64_t d = 0 ; d < nbuckets && !skip ; d++)
+        {
+            int64_t s0 = s ;
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t c = Count [tid * nbuckets + d] ;
+                Count [tid * nbuckets + d] = s ;
+                s += c ;
+            }
+            // all keys have digit d: this pass would not change the order
+            skip = (s - s0 == n) ;
+        }
+        if (skip) continue ;
+
+        // scatter the keys into W, stable within each digit
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t *LG_RESTRICT C = Count + tid * nbuckets ;
+            int64_t kfirst = LG_PART (tid, n, nthreads) ;
+            int64_t klast  = LG_PART (tid+1, n, nthreads) ;
+            for (int64_t k = kfirst ; k < klast ; k++)
+            {
+                uint64_t key = Key [k] ;
+                W [C [(key >> shift) & dmask]++] = key ;
+            }
+        }
+
+        // swap Key and W
+        uint64_t *T = Key ;
+        Key = W ;
+        W = T ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the sorted keys
+    //--------------------------------------------------------------------------
+
+    const uint64_t mask1 = LG_MASK (b1) ;
+    const uint64_t mask2 = LG_MASK (b2) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        uint64_t key = Key [k] ;
+        if (A_2 != NULL)
+        {
+            A_2 [k] = (int64_t) ((key & mask2) + ((uint64_t) min2)) ;
+            key = LG_SHR (key, b2) ;
+        }
+        if (A_1 != NULL)
+        {
+            A_1 [k] = (int64_t) ((key & mask1) + ((uint64_t) min1)) ;
+            key = LG_SHR (key, b1) ;
+        }
+        A_0 [k] = (int64_t) (key + ((uint64_t) min0)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    (*sorted) = true ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+// LG_sample: extract a random sample of the entries of a vector
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_sample picks nsamples indices i at random (with replacement) and returns
+// samples [k] = v (i), typecast to int64_t.  Entries not present in v are
+// returned as zero.  All samples are extracted with a single GrB_extract,
+// rather than one GrB_Vector_extractElement per sample.  The samples are in
+// the order in which the indices were drawn, so for a given seed they are the
+// same as a loop over LG_Random60 (seed) % n.
+
+// On output, *samples is an array of size nsamples, which the caller must
+// free with LAGraph_Free.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    LAGraph_Free ((void **) &I, NULL) ;     \
+    GrB_free (&w) ;                         \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    LAGraph_Free ((void **) &X, NULL) ;     \
+}
+
+#include "LG_internal.h"
+
+int LG_sample
+(
+    // output:
+    int64_t **samples,      // array of size nsamples
+    // input:
+    const GrB_Vector v,     // vector to sample
+    int64_t nsamples,       // number of samples, at least 1
+    uint64_t *seed,         // random number seed, modified on output
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Index *I = NULL ;
+    int64_t *X = NULL ;
+    GrB_Vector w = NULL ;
+    LG_ASSERT (samples != NULL && v != NULL && seed != NULL,
+        GrB_NULL_POINTER) ;
+    (*samples) = NULL ;
+    LG_ASSERT_MSG (nsamples > 0, GrB_INVALID_VALUE, "nsamples must be > 0") ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Vector_size (&n, v)) ;
+    LG_ASSERT_MSG (n > 0, GrB_INVALID_VALUE, "vector must not be empty") ;
+
+    //--------------------------------------------------------------------------
+    // pick the indices at random
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, nsamples, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, nsamples, sizeof (int64_t), msg)) ;
+    for (int64_t k = 0 ; k < nsamples ; k++)
+    {
+        I [k] = LG_Random60 (seed) % n ;
+    }
+
+    //--------------------------------------------------------------------------
+    // w = v (I), with zeros for entries not in v
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&w, GrB_INT64, nsamples)) ;
+    GRB_TRY (GrB_assign (w, NULL, NULL, (int64_t) 0, GrB_ALL, nsamples,
+        NULL)) ;
+    GRB_TRY (GrB_extract (w, NULL, GrB_SECOND_INT64, v, I, nsamples, NULL)) ;
+
+    // X = the values of w, which is full (I is overwritten with 0:nsamples-1)
+    GrB_Index nvals = nsamples ;
+    GRB_TRY (GrB_Vector_extractTuples (I, X, &nvals, w)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*samples) = X ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,151 @@
+//------------------------------------------------------------------------------
+// LG_update_cached: update the cached properties of G after an edit of G->A
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_update_cached updates G->out_degree, G->in_degree, G->nself_edges, and
+// G->is_symmetric_structure after entries have been added to, or removed from,
+// the structure of G->A, by LAGraph_AddEdges or LAGraph_RemoveEdges.  G->A
+// must already hold the edited matrix.  The structure of Delta is the set of
+// entries added to G->A (if added is true) or removed from G->A (if false);
+// its values are ignored.  The work is proportional to the number of entries
+// in Delta, and the size of the degree vectors, not the number of entries in
+// G->A.
+
+// G->AT, G->emin, and G->emax are not modified; they depend on the values of
+// the edges, which Delta does not hold.
+
+#define LG_FREE_ALL                 \
+{                                   \
+    GrB_free (&d) ;                 \
+    GrB_free (&C) ;                 \
+}
+
+#include "LG_internal.h"
+
+int LG_update_cached
+(
+    // input/output:
+    LAGraph_Graph G,        // graph whose G->A has been edited
+    // input:
+    const GrB_Matrix Delta, // entries added to or removed from G->A
+    bool added,             // if true, Delta was added, else removed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Vector d = NULL ;
+    GrB_Matrix C = NULL ;
+    LG_CLEAR_MSG_AND_BASIC_ASSERT (G, msg) ;
+    LG_ASSERT (Delta != NULL, GrB_NULL_POINTER) ;
+
+    GrB_Index nrows, ncols, ndelta ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, G->A)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, G->A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&ndelta, Delta)) ;
+    if (ndelta == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    GrB_BinaryOp accum = added ? GrB_PLUS_INT64 : GrB_MINUS_INT64 ;
+
+    //--------------------------------------------------------------------------
+    // G->out_degree += (or -=) the row degrees of Delta
+    //--------------------------------------------------------------------------
+
+    if (G->out_degree != NULL)
+    {
+        GRB_TRY (GrB_Vector_new (&d, GrB_INT64, nrows)) ;
+        GRB_TRY (GrB_reduce (d, NULL, NULL, GrB_PLUS_MONOID_INT64, Delta,
+            NULL)) ;
+        GRB_TRY (GrB_assign (G->out_degree, NULL, accum, d, GrB_ALL, nrows,
+            NULL)) ;
+        if (!added)
+        {
+            // G->out_degree has no explicit zeros
+            GRB_TRY (GrB_select (G->out_degree, NULL, NULL, GrB_VALUENE_INT64,
+                G->out_degree, 0, NULL)) ;
+        }
+        GrB_free (&d) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // G->in_degree += (or -=) the column degrees of Delta
+    //--------------------------------------------------------------------------
+
+    if (G->in_degree != NULL)
+    {
+        GRB_TRY (GrB_Vector_new (&d, GrB_INT64, ncols)) ;
+        GRB_TRY (GrB_reduce (d, NULL, NULL, GrB_PLUS_MONOID_INT64, Delta,
+            GrB_DESC_T0)) ;
+        GRB_TRY (GrB_assign (G->in_degree, NULL, accum, d, GrB_ALL, ncols,
+            NULL)) ;
+        if (!added)
+        {
+            // G->in_degree has no explicit zeros
+            GRB_TRY (GrB_select (G->in_degree, NULL, NULL, GrB_VALUENE_INT64,
+                G->in_degree, 0, NULL)) ;
+        }
+        GrB_free (&d) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // G->nself_edges += (or -=) the number of diagonal entries of Delta
+    //--------------------------------------------------------------------------
+
+    if (G->nself_edges != LAGRAPH_UNKNOWN)
+    {
+        GrB_Index ndiag ;
+        GRB_TRY (GrB_Matrix_new (&C, GrB_BOOL, nrows, ncols)) ;
+        GRB_TRY (GrB_select (C, NULL, NULL, GrB_DIAG, Delta, 0, NULL)) ;
+        GRB_TRY (GrB_Matrix_nvals (&ndiag, C)) ;
+        G->nself_edges += added ? ((int64_t) ndiag) : (- (int64_t) ndiag) ;
+        GrB_free (&C) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // G->is_symmetric_structure
+    //--------------------------------------------------------------------------
+
+    if (G->kind == LAGraph_ADJACENCY_DIRECTED)
+    {
+        if (G->is_symmetric_structure == LAGraph_TRUE)
+        {
+            // The old G->A had a symmetric structure.  For each entry (i,j)
+            // of Delta, find if (j,i) is now in G->A: C<struct(A)> = Delta'.
+            // If edges were added, all of them must be; if edges were
+            // removed, none of them can be.
+            GrB_Index nc ;
+            GRB_TRY (GrB_Matrix_new (&C, GrB_BOOL, nrows, ncols)) ;
+            GRB_TRY (GrB_assign (C, G->A, NULL, Delta, GrB_ALL, nrows,
+                GrB_ALL, ncols, GrB_DESC_ST0)) ;
+            GRB_TRY (GrB_Matrix_nvals (&nc, C)) ;
+            bool symmetric = added ? (nc == ndelta) : (nc == 0) ;
+            G->is_symmetric_structure = symmetric ? LAGraph_TRUE
+                : LAGraph_FALSE ;
+            GrB_free (&C) ;
+        }
+        else
+        {
+            // an unsymmetric structure may have become symmetric
+            G->is_symmetric_structure = LAGRAPH_UNKNOWN ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}